@@ -1010,6 +1010,69 @@ esac
 ])
 
 
+dnl MPFR_CHECK_GMP_RANDFNPTR
+dnl ------------------------
+dnl Check that the generator of a gmp_randstate_t can be replaced by a table
+dnl of functions with the layout of the gmp_randfnptr_t structure of
+dnl gmp-impl.h, as done by mpfr_randinit_philox. This is an internal feature
+dnl of GMP, thus it is used only with --with-gmp-build (in which case the
+dnl structure from gmp-impl.h is used) or --enable-gmp-internals.
+AC_DEFUN([MPFR_CHECK_GMP_RANDFNPTR], [
+AC_REQUIRE([MPFR_CONFIGS])dnl
+if test "$use_gmp_build" = yes || test "$enable_gmp_internals" = yes; then
+AC_CACHE_CHECK([for the GMP random generator function table],
+               mpfr_cv_gmp_randfnptr, [
+AC_RUN_IFELSE([AC_LANG_PROGRAM([[
+#include "gmp.h"
+#ifdef MPFR_HAVE_GMP_IMPL
+# include "gmp-impl.h"
+#else
+typedef struct {
+  void (*randseed_fn) (__gmp_randstate_struct *, mpz_srcptr);
+  void (*randget_fn) (__gmp_randstate_struct *, mp_ptr, unsigned long);
+  void (*randclear_fn) (__gmp_randstate_struct *);
+  void (*randiset_fn) (__gmp_randstate_struct *,
+                       const __gmp_randstate_struct *);
+} gmp_randfnptr_t;
+#endif
+static int seeded, cleared, copied;
+static void t_seed (__gmp_randstate_struct *r, mpz_srcptr s)
+{ seeded = mpz_get_ui (s) == 17; }
+static void t_get (__gmp_randstate_struct *r, mp_ptr d, unsigned long n)
+{ d[0] = 5; }
+static void t_clear (__gmp_randstate_struct *r)
+{ cleared++; }
+static void t_iset (__gmp_randstate_struct *d, const __gmp_randstate_struct *s)
+{ copied++; *d = *s; }
+static const gmp_randfnptr_t t_fnptr = { t_seed, t_get, t_clear, t_iset };
+]], [[
+  gmp_randstate_t r, s;
+
+  r->_mp_alg = GMP_RAND_ALG_DEFAULT;
+  r->_mp_algdata._mp_lc = (void *) &t_fnptr;
+  gmp_randseed_ui (r, 17);
+  if (! seeded)
+    return 1;
+  if (gmp_urandomb_ui (r, 3) != 5)
+    return 2;
+  gmp_randinit_set (s, r);
+  if (copied != 1 || gmp_urandomb_ui (s, 3) != 5)
+    return 3;
+  gmp_randclear (s);
+  gmp_randclear (r);
+  return cleared != 2;
+]])], [mpfr_cv_gmp_randfnptr="yes"],
+      [mpfr_cv_gmp_randfnptr="no"],
+      [mpfr_cv_gmp_randfnptr="cannot test, assume no"])
+])
+if test "$mpfr_cv_gmp_randfnptr" = yes; then
+  AC_DEFINE([MPFR_HAVE_GMP_RANDFNPTR],1,
+            [Define if the GMP random generator function table can be used])
+fi
+fi
+])
+
+
 dnl MPFR_CHECK_DBL2INT_BUG
 dnl ----------------------
 dnl Check for double-to-integer conversion bug
@@ -36,6 +36,7 @@ mpfr_agm (mpfr_ptr r, mpfr_srcptr op2, mpfr_srcptr op1, mpfr_rnd_t rnd_mode)
   MPFR_ZIV_DECL (loop);
   MPFR_TMP_DECL(marker);
   MPFR_SAVE_EXPO_DECL (expo);
+  MPFR_PERF_FUNC (MPFR_PREC (r));
 
   MPFR_LOG_FUNC
     (("op2[%Pd]=%.*Rg op1[%Pd]=%.*Rg rnd=%d",
@@ -88,7 +89,13 @@ mpfr_agm (mpfr_ptr r, mpfr_srcptr op2, mpfr_srcptr op1, mpfr_rnd_t rnd_mode)
       MPFR_RET_NAN;
     }
 
-  /* Precision of the following calculus */
+  /* Precision of the following calculus.
+     All the iterations are done in precision p: the AGM is not
+     self-correcting, a relative error on u or v at any iteration is a
+     relative error of the same order on the result, thus the early
+     iterations cannot be done in a smaller precision. The short products
+     (mpfr_mulhigh_n, mpfr_sqrhigh_n) are already used by mpfr_mul when
+     they are faster than a full product. */
   q = MPFR_PREC(r);
   p = q + MPFR_INT_CEIL_LOG2(q) + 15;
   MPFR_ASSERTD (p >= 7); /* see algorithms.tex */
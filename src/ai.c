@@ -622,6 +622,292 @@ mpfr_ai2 (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd)
   return mpfr_check_range (y, r, rnd);
 }
 
+/* Airy function Ai evaluated by its asymptotic expansion for large |x|,
+   see Section 9.7 of the NIST Digital Library of Mathematical Functions
+   (DLMF). With zeta = 2/3*|x|^(3/2) and the coefficients
+
+       u_0 = 1,  u_k = (6k-5)(6k-3)(6k-1) / ((2k-1)*216*k) * u_(k-1),
+
+   and writing t_k = u_k / zeta^k, we have for x > 0 (DLMF 9.7.5):
+
+       Ai(x) = exp(-zeta) / (2*sqrt(Pi)*x^(1/4)) * sum((-1)^k*t_k)
+
+   and for x < 0 (DLMF 9.7.9), with a = -x:
+
+       Ai(-a) = (cos(zeta-Pi/4)*P + sin(zeta-Pi/4)*Q) / (sqrt(Pi)*a^(1/4))
+              = ((cos(zeta)+sin(zeta))*P + (sin(zeta)-cos(zeta))*Q)
+                / (sqrt(2*Pi)*a^(1/4))
+
+   where P = sum((-1)^k*t_(2k)) and Q = sum((-1)^k*t_(2k+1)).
+
+   Since zeta is real and positive, the remainders of these sums are bounded
+   in magnitude by the first neglected term (DLMF 9.7(iv); for x < 0, this
+   follows from the corresponding property of the Hankel expansions of the
+   Bessel functions of order +/-1/3, DLMF 10.17(iii), whose coefficients
+   are the u_k). Moreover t_k/t_(k-1) = (6k-5)(6k-1)/(72*k*zeta) < k/(2*zeta),
+   thus the terms decrease as long as k <= 2*zeta. We stop at the first
+   term t_N < 2^(-wprec-1): the neglected terms t_N and t_(N+1) are then
+   both less than 2^(-wprec-1). If this does not happen for some N <= 2*zeta
+   the expansion cannot give the requested accuracy, and we return 0
+   without setting y, so that the caller uses the convergent series.
+   Otherwise, we return a non-zero value and the ternary value in *inex.
+
+   Error analysis (u = 2^(-wprec), all operations rounded to nearest):
+   zeta is computed with 3 roundings, thus |zeta' - zeta| <= 2^(EXP(zeta)+2)*u.
+   Each t_k is obtained from t_(k-1) with 5 roundings and a division by
+   zeta', thus its relative error is at most 16*k*u, and since
+   sum(t_k) <= 2, each sum S of N terms has an absolute error at most
+   (32*N + 2*N + 1)*u plus u for the truncation, i.e., less than (35N+2)*u.
+   For x > 0, S >= 1 - t_1 >= 1/2, and the other factors add a relative
+   error at most 2^(EXP(zeta)+3)*u from exp(-zeta'), plus 10*u, so that the
+   total error is at most 2^errb ulps with errb = max(ceil(log2(140N+8)),
+   EXP(zeta)+3, 4) + 3.
+   For x < 0, sin(zeta') and cos(zeta') have an absolute error at most
+   u + 2^(EXP(zeta)+2)*u, thus the bracket B has an absolute error at most
+   (140N+40)*u + 2^(EXP(zeta)+5)*u <= 2^(eB-wprec) with eB = max(ceil(log2
+   (140N+40)), EXP(zeta)+5) + 1, i.e., 2^(eB-EXP(B)+1) ulps of B, and the
+   final division adds at most 12 ulps. */
+static int
+mpfr_ai_asympt (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd, int *inex)
+{
+  MPFR_ZIV_DECL (loop);
+  MPFR_SAVE_EXPO_DECL (expo);
+  MPFR_GROUP_DECL (group);
+  mpfr_prec_t wprec, prec;
+  mpfr_exp_t errb, e;
+  mpfr_t z, t, p, q, c, sn;
+  unsigned long k;
+  int ok = 0, underflow = 0, neg = MPFR_IS_NEG (x), r = 0;
+
+  MPFR_LOG_FUNC
+    (("x[%Pd]=%.*Rg rnd=%d", mpfr_get_prec (x), mpfr_log_prec, x, rnd),
+     ("y[%Pd]=%.*Rg ok=%d", mpfr_get_prec (y), mpfr_log_prec, y, ok));
+
+  MPFR_ASSERTD (MPFR_IS_PURE_FP (x));
+
+  MPFR_SAVE_EXPO_MARK (expo);
+
+  e = MPFR_GET_EXP (x);
+  if (! neg && e > 32)
+    {
+      /* Check whether Ai(x) < exp(-zeta) underflows even in the extended
+         exponent range, in which case computing zeta with about 3/2*EXP(x)
+         bits would be useless. */
+      mpfr_init2 (z, MPFR_SMALL_PRECISION);
+      mpfr_sqrt (z, x, MPFR_RNDD);
+      mpfr_mul (z, z, x, MPFR_RNDD);
+      mpfr_mul_2ui (z, z, 1, MPFR_RNDD);
+      mpfr_div_ui (z, z, 3, MPFR_RNDD);
+      mpfr_neg (z, z, MPFR_RNDU);
+      {
+        MPFR_BLOCK_DECL (flags);
+
+        MPFR_BLOCK (flags, mpfr_exp (z, z, MPFR_RNDU));
+        underflow = MPFR_UNDERFLOW (flags);
+      }
+      mpfr_clear (z);
+      if (underflow)
+        {
+          MPFR_SAVE_EXPO_FREE (expo);
+          *inex = mpfr_underflow (y, rnd == MPFR_RNDN ? MPFR_RNDZ : rnd, 1);
+          return 1;
+        }
+    }
+
+  prec = MPFR_PREC (y);
+  /* EXP(zeta) <= 3/2*EXP(x), and x < 0 needs a few more bits, since
+     the bracket B may be smaller than 1 */
+  wprec = prec + MPFR_INT_CEIL_LOG2 (prec) + 12 + (neg ? 8 : 0)
+    + (e > 0 ? e + e / 2 : 0);
+
+  MPFR_GROUP_INIT_6 (group, wprec, z, t, p, q, c, sn);
+  MPFR_ZIV_INIT (loop, wprec);
+  for (;;)
+    {
+      /* zeta = 2/3*|x|^(3/2) */
+      mpfr_abs (t, x, MPFR_RNDN);
+      mpfr_sqrt (z, t, MPFR_RNDN);
+      mpfr_mul (z, z, t, MPFR_RNDN);
+      mpfr_mul_2ui (z, z, 1, MPFR_RNDN);
+      mpfr_div_ui (z, z, 3, MPFR_RNDN);
+      if (mpfr_cmp_ui (z, 1) < 0)
+        break; /* ok = 0 */
+
+      /* for x < 0, p = P and q = Q; for x > 0, p (resp. q) is the sum of
+         the even (resp. odd) terms, and S = p - q */
+      mpfr_set_ui (t, 1, MPFR_RNDN);
+      mpfr_set_ui (p, 1, MPFR_RNDN);
+      MPFR_SET_ZERO (q);
+      MPFR_SET_POS (q);
+      for (k = 1; ; k++)
+        {
+          /* the terms decrease as long as k <= 2*zeta */
+          if (mpfr_cmp_ui_2exp (z, k, -1) < 0)
+            break;
+          mpfr_mul_ui (t, t, 6 * k - 5, MPFR_RNDN);
+          mpfr_mul_ui (t, t, 6 * k - 1, MPFR_RNDN);
+          mpfr_div_ui (t, t, 72, MPFR_RNDN);
+          mpfr_div_ui (t, t, k, MPFR_RNDN);
+          mpfr_div (t, t, z, MPFR_RNDN);
+          if (MPFR_GET_EXP (t) < - (mpfr_exp_t) wprec)
+            {
+              ok = 1;
+              break;
+            }
+          if (k % 2 == 0)
+            ((! neg || k % 4 == 0) ? mpfr_add : mpfr_sub) (p, p, t, MPFR_RNDN);
+          else
+            ((! neg || k % 4 == 1) ? mpfr_add : mpfr_sub) (q, q, t, MPFR_RNDN);
+          MPFR_ASSERTN (k <= ULONG_MAX / 6);
+        }
+      if (! ok)
+        break;
+
+      /* now k = N is the number of terms */
+      errb = MPFR_INT_CEIL_LOG2 (k) + 8; /* >= ceil(log2(140N+40)) */
+      if (! neg)
+        {
+          MPFR_BLOCK_DECL (flags);
+
+          mpfr_sub (p, p, q, MPFR_RNDN);           /* S */
+          mpfr_neg (t, z, MPFR_RNDN);
+          MPFR_BLOCK (flags, mpfr_exp (t, t, MPFR_RNDN)); /* exp(-zeta) */
+          if (MPFR_UNDERFLOW (flags))
+            {
+              /* Ai(x) < exp(-zeta) underflows even in the extended
+                 exponent range (possible with a 32-bit exponent) */
+              underflow = 1;
+              break;
+            }
+          mpfr_mul (p, p, t, MPFR_RNDN);
+          mpfr_sqrt (t, x, MPFR_RNDN);
+          mpfr_sqrt (t, t, MPFR_RNDN);             /* x^(1/4) */
+          mpfr_const_pi (c, MPFR_RNDN);
+          mpfr_sqrt (c, c, MPFR_RNDN);
+          mpfr_mul (t, t, c, MPFR_RNDN);
+          mpfr_mul_2ui (t, t, 1, MPFR_RNDN);
+          mpfr_div (c, p, t, MPFR_RNDN);
+          errb = MAX (errb, MPFR_GET_EXP (z) + 3);
+          errb = MAX (errb, 4) + 3;
+        }
+      else
+        {
+          mpfr_sin_cos (sn, c, z, MPFR_RNDN);
+          mpfr_add (t, c, sn, MPFR_RNDN);          /* cos + sin */
+          mpfr_mul (p, p, t, MPFR_RNDN);
+          mpfr_sub (t, sn, c, MPFR_RNDN);          /* sin - cos */
+          mpfr_mul (q, q, t, MPFR_RNDN);
+          mpfr_add (p, p, q, MPFR_RNDN);           /* B */
+          if (MPFR_IS_ZERO (p))
+            goto next_loop;
+          errb = MAX (errb, MPFR_GET_EXP (z) + 5) + 1;
+          errb = MAX (errb - MPFR_GET_EXP (p) + 1, 4) + 2;
+          mpfr_neg (t, x, MPFR_RNDN);
+          mpfr_sqrt (t, t, MPFR_RNDN);
+          mpfr_sqrt (t, t, MPFR_RNDN);             /* a^(1/4) */
+          mpfr_const_pi (c, MPFR_RNDN);
+          mpfr_mul_2ui (c, c, 1, MPFR_RNDN);
+          mpfr_sqrt (c, c, MPFR_RNDN);
+          mpfr_mul (t, t, c, MPFR_RNDN);
+          mpfr_div (c, p, t, MPFR_RNDN);
+        }
+
+      if (errb < wprec &&
+          MPFR_LIKELY (MPFR_CAN_ROUND (c, wprec - errb, prec, rnd)))
+        break;
+
+    next_loop:
+      MPFR_ZIV_NEXT (loop, wprec);
+      MPFR_GROUP_REPREC_6 (group, wprec, z, t, p, q, c, sn);
+      ok = 0;
+    }
+  MPFR_ZIV_FREE (loop);
+
+  if (ok)
+    r = mpfr_set (y, c, rnd);
+  MPFR_GROUP_CLEAR (group);
+
+  if (underflow)
+    {
+      MPFR_SAVE_EXPO_FREE (expo);
+      *inex = mpfr_underflow (y, rnd == MPFR_RNDN ? MPFR_RNDZ : rnd, 1);
+      return 1;
+    }
+  MPFR_SAVE_EXPO_FREE (expo);
+  if (ok)
+    *inex = mpfr_check_range (y, r, rnd);
+  return ok;
+}
+
+/* Multiply m*2^e by d > 0, where 1/2 <= m < 1, and renormalize. This
+   allows one to compute logarithms of products without libm. */
+static void
+mpfr_ai_mul_d (double *m, long *e, double d)
+{
+  *m *= d;
+  while (*m >= 1.0)
+    {
+      *m *= 0.5;
+      (*e) ++;
+    }
+  while (*m < 0.5)
+    {
+      *m *= 2.0;
+      (*e) --;
+    }
+}
+
+/* Decide with a simple cost model whether the asymptotic expansion should
+   be used for Ai(x) at precision prec, i.e., whether it can reach the
+   target accuracy, and whether its cost is smaller than the one of the
+   series. The cost unit is a multiplication at the target precision;
+   each term of the expansion costs about one division, i.e., two
+   multiplications, plus the elementary functions. The series needs about
+   3|x| terms, each one costing about one multiplication, with a working
+   precision increased by the cancellation: about 2*zeta/log(2) bits for
+   x > 0 and zeta/log(2) bits for x < 0. The cost of a multiplication is
+   assumed to be quadratic, which is enough for this rough comparison.
+   Assumes an extended exponent range. */
+
+#define MPFR_AI_ASYMPT_ELEM 30 /* cost of exp or sin_cos, in multiplications */
+
+static int
+mpfr_ai_use_asympt (mpfr_srcptr x, mpfr_prec_t prec)
+{
+  mpfr_t t;
+  double a, zeta, target, cancel, m;
+  long e;
+  unsigned long k;
+
+  if (MPFR_IS_ZERO (x) || MPFR_GET_EXP (x) < 3) /* |x| < 4 */
+    return 0;
+  if (MPFR_GET_EXP (x) > 600) /* zeta would overflow as a double */
+    return 1;
+
+  mpfr_init2 (t, MPFR_SMALL_PRECISION);
+  mpfr_abs (t, x, MPFR_RNDN);
+  a = mpfr_get_d (t, MPFR_RNDN);
+  mpfr_sqrt (t, t, MPFR_RNDN);
+  zeta = 2.0 / 3.0 * a * mpfr_get_d (t, MPFR_RNDN);
+  mpfr_clear (t);
+  target = (double) prec + 1.5 * (double) MPFR_GET_EXP (x) + 20.0;
+
+  /* number of terms of the asymptotic expansion: t_k = m*2^e */
+  m = 0.5;
+  e = 1;
+  for (k = 1; (double) e > - target; k++)
+    {
+      if ((double) k > 2.0 * zeta)
+        return 0; /* the expansion cannot reach the target accuracy */
+      mpfr_ai_mul_d (&m, &e, (6.0 * k - 5.0) * (6.0 * k - 1.0)
+                     / (72.0 * k * zeta));
+    }
+
+  cancel = (MPFR_IS_POS (x) ? 2.0 : 1.0) * zeta * 1.4426950408889634;
+  return (2.0 * (double) k + MPFR_AI_ASYMPT_ELEM) * target * target
+    < 3.0 * a * (target + cancel) * (target + cancel);
+}
+
 /* We consider that the boundary between the area where the naive method
    should preferably be used and the area where Smith' method should preferably
    be used has the following form:
@@ -643,8 +929,9 @@ int
 mpfr_ai (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd)
 {
   mpfr_t temp1, temp2;
-  int use_ai2;
+  int use_asympt, use_ai2, inex;
   MPFR_SAVE_EXPO_DECL (expo);
+  MPFR_PERF_FUNC (MPFR_PREC (y));
 
   /* Special cases */
   if (MPFR_UNLIKELY (MPFR_IS_SINGULAR (x)))
@@ -662,6 +949,8 @@ mpfr_ai (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd)
   /* The exponent range must be large enough for the computation of temp1. */
   MPFR_SAVE_EXPO_MARK (expo);
 
+  use_asympt = mpfr_ai_use_asympt (x, MPFR_PREC (y));
+
   mpfr_init2 (temp1, MPFR_SMALL_PRECISION);
   mpfr_init2 (temp2, MPFR_SMALL_PRECISION);
 
@@ -683,6 +972,10 @@ mpfr_ai (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd)
 
   MPFR_SAVE_EXPO_FREE (expo); /* Ignore all previous exceptions. */
 
+  /* if the asymptotic expansion fails, fall back to the series */
+  if (use_asympt && mpfr_ai_asympt (y, x, rnd, &inex))
+    return inex;
+
   /* we use ai2 if |x|*AI_THRESHOLD1/3 + PREC(y)*AI_THRESHOLD2 > AI_SCALE,
      which means x cannot be zero in mpfr_ai2 */
   return use_ai2 ? mpfr_ai2 (y, x, rnd) : mpfr_ai1 (y, x, rnd);
@@ -227,14 +227,29 @@ mpfr_bernoulli_cache (unsigned long n)
         }
       MPFR_ASSERTD (bernoulli_alloc > n);
       MPFR_ASSERTD (bernoulli_size >= 0);
+      __gmpfr_cache_depth ++;
       for (i = bernoulli_size; i <= n; i++)
         mpfr_bernoulli_internal (bernoulli_table, i);
+      __gmpfr_cache_depth --;
       bernoulli_size = n+1;
     }
   MPFR_ASSERTD (bernoulli_size > n);
   return bernoulli_table[n];
 }
 
+/* Return the number of bytes held by the cache. */
+size_t
+mpfr_bernoulli_cachesize (void)
+{
+  unsigned long i;
+  size_t s;
+
+  s = bernoulli_alloc * sizeof (mpz_t);
+  for (i = 0; i < bernoulli_size; i++)
+    s += (size_t) ALLOC (bernoulli_table[i]) * MPFR_BYTES_PER_MP_LIMB;
+  return s;
+}
+
 void
 mpfr_bernoulli_freecache (void)
 {
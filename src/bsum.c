@@ -0,0 +1,102 @@
+/* Extendable sums computed by binary splitting.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-impl.h"
+
+/* When a Ziv loop fails, the series evaluated by binary splitting are
+   usually recomputed from scratch with more terms. If the sum S(0,n)
+   of the first n terms is kept as (T, P, Q), the sum with m > n terms
+   only needs S(n,m), computed by binary splitting like S(0,n), and a
+   final merge:
+     T(0,m) = T(0,n) Q(n,m) + P(0,n) T(n,m),
+     P(0,m) = P(0,n) P(n,m),
+     Q(0,m) = Q(0,n) Q(n,m).
+   This is the same merge as in the binary splitting itself, thus the
+   result is identical to the one computed from scratch (up to a power
+   of 2 common to T, P and Q). When the number of terms is increased by
+   a constant factor at each step (as in Ziv loops), the
+   cost of the previous steps is not paid again.
+
+   A mpfr_bsum_t with n = 0 is empty and its mpz_t are not initialized,
+   so that a zero-initialized static variable is a valid empty sum. */
+
+void
+mpfr_bsum_init (mpfr_bsum_ptr s)
+{
+  s->n = 0;
+}
+
+void
+mpfr_bsum_clear (mpfr_bsum_ptr s)
+{
+  if (s->n != 0)
+    {
+      mpz_clear (s->T);
+      mpz_clear (s->P);
+      mpz_clear (s->Q);
+      s->n = 0;
+    }
+}
+
+/* Extend s, which contains the sum of the terms of indices 0 to s->n - 1,
+   with the terms of indices s->n to n - 1, whose sum is given by T, P, Q
+   (P must be the full product, even if it is not needed for the sum). */
+void
+mpfr_bsum_extend (mpfr_bsum_ptr s, mpz_srcptr T, mpz_srcptr P, mpz_srcptr Q,
+                  unsigned long n)
+{
+  mp_bitcnt_t v, w;
+
+  MPFR_ASSERTN (n > s->n);
+
+  if (s->n == 0)
+    {
+      mpz_init_set (s->T, T);
+      mpz_init_set (s->P, P);
+      mpz_init_set (s->Q, Q);
+      s->n = n;
+      return;
+    }
+
+  mpz_mul (s->T, s->T, Q);
+  mpz_addmul (s->T, s->P, T);
+  mpz_mul (s->P, s->P, P);
+  mpz_mul (s->Q, s->Q, Q);
+  s->n = n;
+
+  /* remove common trailing zeros if any */
+  v = mpz_scan1 (s->T, 0);
+  if (v > 0)
+    {
+      w = mpz_scan1 (s->Q, 0);
+      if (w < v)
+        v = w;
+      w = mpz_scan1 (s->P, 0);
+      if (w < v)
+        v = w;
+      if (v > 0)
+        {
+          mpz_fdiv_q_2exp (s->T, s->T, v);
+          mpz_fdiv_q_2exp (s->P, s->P, v);
+          mpz_fdiv_q_2exp (s->Q, s->Q, v);
+        }
+    }
+}
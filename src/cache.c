@@ -52,6 +52,24 @@ mpfr_clear_cache (mpfr_cache_t cache)
     }
 }
 
+/* Return the number of bytes allocated for the cached value. */
+size_t
+mpfr_cache_size (mpfr_cache_t cache)
+{
+  size_t s = 0;
+
+  /* As in mpfr_clear_cache, the lock is used only if the cache has been
+     initialized. */
+  if (MPFR_PREC (cache->x) != 0)
+    {
+      MPFR_LOCK_READ(cache->lock);
+      if (MPFR_PREC (cache->x) != 0)
+        s = MPFR_MALLOC_SIZE (MPFR_GET_ALLOC_SIZE (cache->x));
+      MPFR_UNLOCK_READ(cache->lock);
+    }
+  return s;
+}
+
 int
 mpfr_cache (mpfr_ptr dest, mpfr_cache_t cache, mpfr_rnd_t rnd)
 {
@@ -99,7 +117,9 @@ mpfr_cache (mpfr_ptr dest, mpfr_cache_t cache, mpfr_rnd_t rnd)
               mpfr_set_prec (cache->x, cprec);
             }
 
+          __gmpfr_cache_depth ++;
           cache->inexact = (*cache->func) (cache->x, MPFR_RNDN);
+          __gmpfr_cache_depth --;
         }
 
       /* Free the cache in read-write mode */
@@ -191,5 +211,9 @@ mpfr_cache (mpfr_ptr dest, mpfr_cache_t cache, mpfr_rnd_t rnd)
   /* Free the cache in read-only mode */
   MPFR_UNLOCK_READ(cache->lock);
 
+  /* The cache is no longer used: this is a safe point to free the caches
+     if they exceed the limit set by mpfr_memory_limit. */
+  MPFR_MEMORY_CHECK ();
+
   return mpfr_check_range (dest, inexact, rnd);
 }
@@ -52,6 +52,7 @@ mpfr_cbrt (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
   mpfr_prec_t n, size_m;
   int inexact, inexact2, negative, r;
   MPFR_SAVE_EXPO_DECL (expo);
+  MPFR_PERF_FUNC (MPFR_PREC (y));
 
   MPFR_LOG_FUNC
     (("x[%Pd]=%.*Rg rnd=%d", mpfr_get_prec (x), mpfr_log_prec, x, rnd_mode),
@@ -85,7 +85,9 @@ mpfr_const_catalan_internal (mpfr_ptr g, mpfr_rnd_t rnd_mode)
 {
   mpfr_t x, y, z;
   mpz_t T, P, Q;
+  mpfr_bsum_t catalan_sum;
   mpfr_prec_t pg, p;
+  unsigned long n;
   int inex;
   MPFR_ZIV_DECL (loop);
   MPFR_GROUP_DECL (group);
@@ -119,6 +121,8 @@ mpfr_const_catalan_internal (mpfr_ptr g, mpfr_rnd_t rnd_mode)
   mpz_init (T);
   mpz_init (P);
   mpz_init (Q);
+  /* the sum of the series computed so far, freed after the Ziv loop */
+  mpfr_bsum_init (catalan_sum);
 
   MPFR_ZIV_INIT (loop, p);
   for (;;) {
@@ -127,10 +131,16 @@ mpfr_const_catalan_internal (mpfr_ptr g, mpfr_rnd_t rnd_mode)
     mpfr_log (x, x, MPFR_RNDU);
     mpfr_const_pi (y, MPFR_RNDU);
     mpfr_mul (x, x, y, MPFR_RNDN);
-    S (T, P, Q, 0, (p - 1) / 2);
-    mpz_mul_ui (T, T, 3);
+    /* only compute the terms that are not in catalan_sum yet */
+    n = (unsigned long) ((p - 1) / 2);
+    if (catalan_sum->n < n)
+      {
+        S (T, P, Q, catalan_sum->n, n);
+        mpfr_bsum_extend (catalan_sum, T, P, Q, n);
+      }
+    mpz_mul_ui (T, catalan_sum->T, 3);
     mpfr_set_z (y, T, MPFR_RNDU);
-    mpfr_set_z (z, Q, MPFR_RNDD);
+    mpfr_set_z (z, catalan_sum->Q, MPFR_RNDD);
     mpfr_div (y, y, z, MPFR_RNDN);
     mpfr_add (x, x, y, MPFR_RNDN);
     mpfr_div_2ui (x, x, 3, MPFR_RNDN);
@@ -148,6 +158,7 @@ mpfr_const_catalan_internal (mpfr_ptr g, mpfr_rnd_t rnd_mode)
   mpz_clear (T);
   mpz_clear (P);
   mpz_clear (Q);
+  mpfr_bsum_clear (catalan_sum);
 
   return inex;
 }
@@ -112,6 +112,7 @@ mpfr_const_log2_internal (mpfr_ptr x, mpfr_rnd_t rnd_mode)
   unsigned long N;
   mpz_t *T, *P, *Q;
   mpfr_t t, q;
+  mpfr_bsum_t sum;
   int inexact;
   unsigned long lgN, i;
   MPFR_GROUP_DECL(group);
@@ -124,6 +125,10 @@ mpfr_const_log2_internal (mpfr_ptr x, mpfr_rnd_t rnd_mode)
 
   w = n + MPFR_INT_CEIL_LOG2 (n) + 3;
 
+  /* The sum computed so far: after a failure of the Ziv loop, only the
+     new terms are computed. It is freed once the result is rounded. */
+  mpfr_bsum_init (sum);
+
   MPFR_TMP_MARK(marker);
   MPFR_GROUP_INIT_2(group, w, t, q);
 
@@ -135,30 +140,35 @@ mpfr_const_log2_internal (mpfr_ptr x, mpfr_rnd_t rnd_mode)
       /* the following are needed for error analysis (see algorithms.tex) */
       MPFR_ASSERTD(w >= 3 && N >= 2);
 
-      lgN = MPFR_INT_CEIL_LOG2 (N) + 1;
-      T  = (mpz_t *) MPFR_TMP_ALLOC (3 * lgN * sizeof (mpz_t));
-      P  = T + lgN;
-      Q  = T + 2*lgN;
-      for (i = 0; i < lgN; i++)
+      /* Only compute the terms that are not in sum yet. */
+      if (sum->n < N)
         {
-          mpz_init (T[i]);
-          mpz_init (P[i]);
-          mpz_init (Q[i]);
-        }
-
-      S (T, P, Q, 0, N, 0);
+          lgN = MPFR_INT_CEIL_LOG2 (N - sum->n) + 1;
+          T  = (mpz_t *) MPFR_TMP_ALLOC (3 * lgN * sizeof (mpz_t));
+          P  = T + lgN;
+          Q  = T + 2*lgN;
+          for (i = 0; i < lgN; i++)
+            {
+              mpz_init (T[i]);
+              mpz_init (P[i]);
+              mpz_init (Q[i]);
+            }
 
-      mpfr_set_z (t, T[0], MPFR_RNDN);
-      mpfr_set_z (q, Q[0], MPFR_RNDN);
-      mpfr_div (t, t, q, MPFR_RNDN);
+          S (T, P, Q, sum->n, N, 1);
+          mpfr_bsum_extend (sum, T[0], P[0], Q[0], N);
 
-      for (i = 0; i < lgN; i++)
-        {
-          mpz_clear (T[i]);
-          mpz_clear (P[i]);
-          mpz_clear (Q[i]);
+          for (i = 0; i < lgN; i++)
+            {
+              mpz_clear (T[i]);
+              mpz_clear (P[i]);
+              mpz_clear (Q[i]);
+            }
         }
 
+      mpfr_set_z (t, sum->T, MPFR_RNDN);
+      mpfr_set_z (q, sum->Q, MPFR_RNDN);
+      mpfr_div (t, t, q, MPFR_RNDN);
+
       if (MPFR_CAN_ROUND (t, w - 2, n, rnd_mode))
         break;
 
@@ -169,6 +179,7 @@ mpfr_const_log2_internal (mpfr_ptr x, mpfr_rnd_t rnd_mode)
 
   inexact = mpfr_set (x, t, rnd_mode);
 
+  mpfr_bsum_clear (sum);
   MPFR_GROUP_CLEAR(group);
   MPFR_TMP_FREE(marker);
 
@@ -138,6 +138,7 @@ mpfr_cos (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
   MPFR_ZIV_DECL (loop);
   MPFR_SAVE_EXPO_DECL (expo);
   MPFR_GROUP_DECL (group);
+  MPFR_PERF_FUNC (MPFR_PREC (y));
 
   MPFR_LOG_FUNC
     (("x[%Pd]=%.*Rg rnd=%d", mpfr_get_prec (x), mpfr_log_prec, x, rnd_mode),
@@ -157,6 +158,16 @@ mpfr_cos (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
         }
     }
 
+#if !defined(MPFR_GENERIC_ABI) && GMP_NUMB_BITS == 64
+  if (MPFR_PREC (y) <= 2 * GMP_NUMB_BITS)
+    {
+      /* fixed-point code, which fails only in rare cases */
+      inexact = mpfr_cos_fixed (y, x, rnd_mode);
+      if (MPFR_LIKELY (inexact != 0))
+        return inexact;
+    }
+#endif
+
   MPFR_SAVE_EXPO_MARK (expo);
 
   /* cos(x) = 1-x^2/2 + ..., so error < 2^(2*EXP(x)-1) */
@@ -167,7 +178,7 @@ mpfr_cos (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
   /* Compute initial precision */
   precy = MPFR_PREC (y);
 
-  if (precy >= MPFR_SINCOS_THRESHOLD)
+  if (precy >= MPFR_SINCOS_THRESHOLD || MPFR_SINCOS_SPARSE_P (x, precy))
     {
       inexact = mpfr_cos_fast (y, x, rnd_mode);
       goto end;
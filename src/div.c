@@ -642,6 +642,183 @@ mpfr_div_2 (mpfr_ptr q, mpfr_srcptr u, mpfr_srcptr v, mpfr_rnd_t rnd_mode)
     }
 }
 
+/* Given R = (r2*B^2+r1*B+r0)*B with r2:r1:r0 < v2:v1:v0 = V, where V is
+   normalized and dinv = floor((B^3-1)/(v2*B+v1)) - B, return the quotient
+   floor(R/V) and put the remainder in r2:r1:r0. This is one step of the
+   schoolbook division of GMP (mpn_sbpi1_div_qr) for a 3-limb divisor. */
+static mp_limb_t
+mpfr_div3_step (mp_limb_t *r2, mp_limb_t *r1, mp_limb_t *r0,
+                mpfr_limb_srcptr vp, mp_limb_t dinv)
+{
+  mp_limb_t q, s1, s0, n, h, l, cy, cy1;
+
+  if (MPFR_UNLIKELY(*r2 == vp[2] && *r1 == vp[1]))
+    {
+      /* the quotient is B-1 in this case */
+      mp_limb_t t[4];
+
+      t[0] = MPFR_LIMB_ZERO;
+      t[1] = *r0;
+      t[2] = *r1;
+      t[3] = *r2;
+      cy = mpn_submul_1 (t, vp, 3, MPFR_LIMB_MAX);
+      MPFR_ASSERTD(cy == t[3]);
+      *r2 = t[2];
+      *r1 = t[1];
+      *r0 = t[0];
+      return MPFR_LIMB_MAX;
+    }
+
+  /* divide r2:r1:r0 by v2:v1, and subtract q*v0 from the remainder */
+  udiv_qr_3by2 (q, s1, s0, *r2, *r1, *r0, vp[2], vp[1], dinv);
+  umul_ppmm (h, l, q, vp[0]);
+  cy = h + (l != 0);
+  n = -l;
+  cy1 = s0 < cy;
+  s0 -= cy;
+  cy = s1 < cy1;
+  s1 -= cy1;
+  if (MPFR_UNLIKELY(cy != 0)) /* q was too large by 1: add back V */
+    {
+      n += vp[0];
+      cy = n < vp[0];
+      s0 += cy;
+      cy = s0 < cy;
+      s0 += vp[1];
+      cy += s0 < vp[1];
+      s1 += vp[2] + cy;
+      q --;
+    }
+  *r2 = s1;
+  *r1 = s0;
+  *r0 = n;
+  return q;
+}
+
+/* Special code for 2*GMP_NUMB_BITS < PREC(q) <= 3*GMP_NUMB_BITS and
+   PREC(u) = PREC(v) = PREC(q) */
+static int
+mpfr_div_3 (mpfr_ptr q, mpfr_srcptr u, mpfr_srcptr v, mpfr_rnd_t rnd_mode)
+{
+  mpfr_prec_t p = MPFR_GET_PREC(q);
+  mpfr_limb_ptr qp = MPFR_MANT(q);
+  mpfr_limb_srcptr up = MPFR_MANT(u), vp = MPFR_MANT(v);
+  mpfr_exp_t qx = MPFR_GET_EXP(u) - MPFR_GET_EXP(v);
+  mpfr_prec_t sh = 3*GMP_NUMB_BITS - p;
+  mp_limb_t rb, sb, mask = MPFR_LIMB_MASK(sh);
+  mp_limb_t q2, q1, q0, r2, r1, r0;
+  mpfr_pi1_t dinv;
+  int extra;
+
+  extra = mpn_cmp (up, vp, 3) >= 0;
+  if (extra)
+    {
+      mp_limb_t t[3];
+
+      mpn_sub_n (t, up, vp, 3);
+      r2 = t[2];
+      r1 = t[1];
+      r0 = t[0];
+    }
+  else
+    {
+      r2 = up[2];
+      r1 = up[1];
+      r0 = up[0];
+    }
+
+  /* now (u-extra*v)*B^3 = (q2:q1:q0) * v + r2:r1:r0 with r2:r1:r0 < v */
+  invert_pi1 (dinv, vp[2], vp[1]);
+  q2 = mpfr_div3_step (&r2, &r1, &r0, vp, dinv.inv32);
+  q1 = mpfr_div3_step (&r2, &r1, &r0, vp, dinv.inv32);
+  q0 = mpfr_div3_step (&r2, &r1, &r0, vp, dinv.inv32);
+
+  sb = r2 | r1 | r0;
+  rb = 0;
+  if (extra)
+    {
+      qx ++;
+      rb = q0 & MPFR_LIMB_ONE; /* bit shifted out */
+      q0 = (q1 << (GMP_NUMB_BITS - 1)) | (q0 >> 1);
+      q1 = (q2 << (GMP_NUMB_BITS - 1)) | (q1 >> 1);
+      q2 = MPFR_LIMB_HIGHBIT | (q2 >> 1);
+    }
+  else if (sh == 0)
+    {
+      /* The round bit is 1 if 2*r >= v. In that case, the remaining bits
+         are those of 2*r - v, which is not zero since the exact quotient
+         cannot have p+1 bits, thus sb is still correct. */
+      mp_limb_t t2, t1, t0;
+
+      t2 = (r2 << 1) | (r1 >> (GMP_NUMB_BITS - 1));
+      t1 = (r1 << 1) | (r0 >> (GMP_NUMB_BITS - 1));
+      t0 = r0 << 1;
+      rb = (r2 >> (GMP_NUMB_BITS - 1)) != 0 || t2 > vp[2] ||
+        (t2 == vp[2] && (t1 > vp[1] || (t1 == vp[1] && t0 >= vp[0])));
+    }
+  if (sh != 0)
+    {
+      sb |= rb;
+      rb = q0 & (MPFR_LIMB_ONE << (sh - 1));
+      sb |= (q0 & mask) ^ rb;
+    }
+  qp[2] = q2;
+  qp[1] = q1;
+  qp[0] = q0 & ~mask;
+
+  MPFR_SIGN(q) = MPFR_MULT_SIGN (MPFR_SIGN (u), MPFR_SIGN (v));
+
+  /* rounding */
+  if (qx > __gmpfr_emax)
+    return mpfr_overflow (q, rnd_mode, MPFR_SIGN(q));
+
+  /* Warning: underflow should be checked *after* rounding, see the
+     comments in mpfr_div_2. */
+  if (qx < __gmpfr_emin)
+    {
+      if (rnd_mode == MPFR_RNDN &&
+          (qx < __gmpfr_emin - 1 ||
+           (qp[2] == MPFR_LIMB_HIGHBIT && qp[1] == MPFR_LIMB_ZERO &&
+            qp[0] == MPFR_LIMB_ZERO && sb == 0)))
+        rnd_mode = MPFR_RNDZ;
+      return mpfr_underflow (q, rnd_mode, MPFR_SIGN(q));
+    }
+
+  MPFR_EXP (q) = qx; /* Don't use MPFR_SET_EXP since qx might be < __gmpfr_emin
+                        in the cases "goto rounding" above. */
+  if ((rb == 0 && sb == 0) || rnd_mode == MPFR_RNDF)
+    {
+      MPFR_ASSERTD(qx >= __gmpfr_emin);
+      MPFR_RET (0);
+    }
+  else if (rnd_mode == MPFR_RNDN)
+    {
+      /* See the comment in mpfr_div_1. */
+      MPFR_ASSERTD(sb != 0);
+      if (rb == 0)
+        goto truncate;
+      else
+        goto add_one_ulp;
+    }
+  else if (MPFR_IS_LIKE_RNDZ(rnd_mode, MPFR_IS_NEG(q)))
+    {
+    truncate:
+      MPFR_ASSERTD(qx >= __gmpfr_emin);
+      MPFR_RET(-MPFR_SIGN(q));
+    }
+  else /* round away from zero */
+    {
+    add_one_ulp:
+      qp[0] += MPFR_LIMB_ONE << sh;
+      qp[1] += qp[0] == 0;
+      qp[2] += qp[1] == 0 && qp[0] == 0;
+      /* there can be no overflow in the addition above,
+         see the analysis of mpfr_div_1 */
+      MPFR_ASSERTD(qp[2] != 0);
+      MPFR_RET(MPFR_SIGN(q));
+    }
+}
+
 #endif /* !defined(MPFR_GENERIC_ABI) */
 
 /* check if {ap, an} is zero */
@@ -844,6 +1021,10 @@ mpfr_div (mpfr_ptr q, mpfr_srcptr u, mpfr_srcptr v, mpfr_rnd_t rnd_mode)
 
       if (MPFR_GET_PREC(q) == GMP_NUMB_BITS)
         return mpfr_div_1n (q, u, v, rnd_mode);
+
+      if (2 * GMP_NUMB_BITS < MPFR_GET_PREC(q) &&
+          MPFR_GET_PREC(q) <= 3 * GMP_NUMB_BITS)
+        return mpfr_div_3 (q, u, v, rnd_mode);
     }
 #endif /* !defined(MPFR_GENERIC_ABI) */
 
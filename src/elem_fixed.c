@@ -0,0 +1,1690 @@
+/* mpfr_exp_fixed, mpfr_log_fixed, mpfr_sin_fixed, mpfr_cos_fixed --
+   fixed-point evaluation of exp, log, sin and cos in small precision
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#define MPFR_NEED_LONGLONG_H
+#include "mpfr-impl.h"
+
+/* When the target precision is at most 2 limbs, the functions of this file
+   approximate exp(x), log(x), sin(x) or cos(x) with fixed-point arithmetic
+   on n limbs, where n = 2 if the target precision is at most GMP_NUMB_BITS
+   and n = 3 otherwise: a table lookup reduces the argument so that a short
+   Taylor series, evaluated by the Horner scheme, is enough. The error of
+   the n-limb approximation is bounded below, so that the correct rounding
+   is decided with mpfr_round_p, like in Ziv's strategy. If the rounding
+   cannot be decided (which is very unlikely) or the argument is out of
+   the supported range, these functions return 0 and modify neither the
+   result nor the flags, and the caller uses the general code. Otherwise
+   the result is set and the ternary value is returned, which is never 0
+   since the result is never exact (the exact cases are handled by the
+   callers).
+
+   A fixed-point number {a, n} represents a / B^n, where B = 2^64; its ulp
+   is u = B^(-n). The product of two such numbers is truncated, thus has
+   an error less than 1 ulp. The tables below have 3-limb entries rounded
+   to nearest (computed with MPFR in a larger precision); for n = 2, only
+   the 2 most significant limbs are used. Thus every table entry has an
+   error less than 1 ulp. */
+
+#if !defined(MPFR_GENERIC_ABI) && GMP_NUMB_BITS == 64
+
+#ifndef UINT64_C
+# define UINT64_C(c) c
+#endif
+
+/* floor(log(2) * 2^256) */
+static const mp_limb_t log2_tab[4] =
+  { UINT64_C(0x8a0d175b8baafa2b), UINT64_C(0x40f343267298b62d),
+    UINT64_C(0xc9e3b39803f2f6af), UINT64_C(0xb17217f7d1cf79ab) };
+
+/* floor(Pi/4 * 2^256) */
+static const mp_limb_t pio4_tab[4] =
+  { UINT64_C(0x020bbea63b139b22), UINT64_C(0x29024e088a67cc74),
+    UINT64_C(0xc4c6628b80dc1cd1), UINT64_C(0xc90fdaa22168c234) };
+
+/* 1/k! for 2 <= k <= 19 */
+static const mp_limb_t invfact_tab[18][3] =
+  {
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x8000000000000000) },
+    { UINT64_C(0xaaaaaaaaaaaaaaab), UINT64_C(0xaaaaaaaaaaaaaaaa),
+      UINT64_C(0x2aaaaaaaaaaaaaaa) },
+    { UINT64_C(0xaaaaaaaaaaaaaaab), UINT64_C(0xaaaaaaaaaaaaaaaa),
+      UINT64_C(0x0aaaaaaaaaaaaaaa) },
+    { UINT64_C(0x2222222222222222), UINT64_C(0x2222222222222222),
+      UINT64_C(0x0222222222222222) },
+    { UINT64_C(0x5b05b05b05b05b06), UINT64_C(0x05b05b05b05b05b0),
+      UINT64_C(0x005b05b05b05b05b) },
+    { UINT64_C(0x0d00d00d00d00d01), UINT64_C(0x00d00d00d00d00d0),
+      UINT64_C(0x000d00d00d00d00d) },
+    { UINT64_C(0x01a01a01a01a01a0), UINT64_C(0xa01a01a01a01a01a),
+      UINT64_C(0x0001a01a01a01a01) },
+    { UINT64_C(0xe3bc74aad8e671f5), UINT64_C(0x671f5583911ca002),
+      UINT64_C(0x00002e3bc74aad8e) },
+    { UINT64_C(0xe392d8777c170b65), UINT64_C(0xd71cbbc05b4fa999),
+      UINT64_C(0x0000049f93edde27) },
+    { UINT64_C(0x71c7880adcbc46db), UINT64_C(0x138e3f9d1f92e0df),
+      UINT64_C(0x0000006b99159fd5) },
+    { UINT64_C(0xf425f600e7ba5b3d), UINT64_C(0x6c4bdaa26d4c3d67),
+      UINT64_C(0x00000008f76c77fc) },
+    { UINT64_C(0xd7b4269d9babdfa2), UINT64_C(0x43684be51c198e91),
+      UINT64_C(0x00000000b092309d) },
+    { UINT64_C(0xfd1f2754668c46d5), UINT64_C(0x603e4e905d6f8a2e),
+      UINT64_C(0x000000000c9cba54) },
+    { UINT64_C(0x774657f48f5eaf64), UINT64_C(0x399dc0f88ec32b58),
+      UINT64_C(0x0000000000d73f9f) },
+    { UINT64_C(0x8774657f48f5eaf6), UINT64_C(0xf399dc0f88ec32b5),
+      UINT64_C(0x00000000000d73f9) },
+    { UINT64_C(0xcbbb8d7ff53ba469), UINT64_C(0x3b81856a53593028),
+      UINT64_C(0x000000000000ca96) },
+    { UINT64_C(0x4435161554bc33cd), UINT64_C(0x3c31dcbecbbdd802),
+      UINT64_C(0x0000000000000b41) },
+    { UINT64_C(0xf61dbdcb3a5abf5c), UINT64_C(0xa4da340a0ab92650),
+      UINT64_C(0x0000000000000097) }
+  };
+
+/* 1/k for 2 <= k <= 16 */
+static const mp_limb_t inv_tab[15][3] =
+  {
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x8000000000000000) },
+    { UINT64_C(0x5555555555555555), UINT64_C(0x5555555555555555),
+      UINT64_C(0x5555555555555555) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x4000000000000000) },
+    { UINT64_C(0x3333333333333333), UINT64_C(0x3333333333333333),
+      UINT64_C(0x3333333333333333) },
+    { UINT64_C(0xaaaaaaaaaaaaaaab), UINT64_C(0xaaaaaaaaaaaaaaaa),
+      UINT64_C(0x2aaaaaaaaaaaaaaa) },
+    { UINT64_C(0x9249249249249249), UINT64_C(0x4924924924924924),
+      UINT64_C(0x2492492492492492) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x2000000000000000) },
+    { UINT64_C(0x71c71c71c71c71c7), UINT64_C(0xc71c71c71c71c71c),
+      UINT64_C(0x1c71c71c71c71c71) },
+    { UINT64_C(0x999999999999999a), UINT64_C(0x9999999999999999),
+      UINT64_C(0x1999999999999999) },
+    { UINT64_C(0x45d1745d1745d174), UINT64_C(0x745d1745d1745d17),
+      UINT64_C(0x1745d1745d1745d1) },
+    { UINT64_C(0x5555555555555555), UINT64_C(0x5555555555555555),
+      UINT64_C(0x1555555555555555) },
+    { UINT64_C(0xb13b13b13b13b13b), UINT64_C(0x3b13b13b13b13b13),
+      UINT64_C(0x13b13b13b13b13b1) },
+    { UINT64_C(0x4924924924924925), UINT64_C(0x2492492492492492),
+      UINT64_C(0x1249249249249249) },
+    { UINT64_C(0x1111111111111111), UINT64_C(0x1111111111111111),
+      UINT64_C(0x1111111111111111) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x1000000000000000) }
+  };
+
+/* exp(j/64)/2 for 0 <= j <= 44 */
+static const mp_limb_t exp1_tab[45][3] =
+  {
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x8000000000000000) },
+    { UINT64_C(0xb790820fa313b766), UINT64_C(0x5c3259f4822735a2),
+      UINT64_C(0x8204055aaef1c8bd) },
+    { UINT64_C(0x55280bc292234036), UINT64_C(0x05e841d5d4064bd3),
+      UINT64_C(0x84102b00893f64c7) },
+    { UINT64_C(0xed3ac5a3043be482), UINT64_C(0x967f31eb2594af50),
+      UINT64_C(0x862491b414f45e14) },
+    { UINT64_C(0xdd14aabac3e1237c), UINT64_C(0xd8d00cf112e4d4a8),
+      UINT64_C(0x88415abbe9a76bea) },
+    { UINT64_C(0x3204d2b5252590b6), UINT64_C(0xaf50ce3713ce2f05),
+      UINT64_C(0x8a66a7e4c4e6b22a) },
+    { UINT64_C(0xf3da3da8ea6c3274), UINT64_C(0x9e8c66dd40755e14),
+      UINT64_C(0x8c949b83a7066b44) },
+    { UINT64_C(0x7629b2da6a391230), UINT64_C(0xac7a4d3206c3015f),
+      UINT64_C(0x8ecb5877f873c9e8) },
+    { UINT64_C(0x3c5f864254ab82bf), UINT64_C(0x76b441c27035c6a1),
+      UINT64_C(0x910b022db7ae67ce) },
+    { UINT64_C(0x6763c7e86356c038), UINT64_C(0xeb9860044d070592),
+      UINT64_C(0x9353bc9fb00b215a) },
+    { UINT64_C(0x32a1762230f5450f), UINT64_C(0x9bb3e062cebec9a5),
+      UINT64_C(0x95a5ac59b963ca80) },
+    { UINT64_C(0x7458999f764049f2), UINT64_C(0xeae44b1a7ffaabe3),
+      UINT64_C(0x9800f67b00d7b805) },
+    { UINT64_C(0x847358538982478c), UINT64_C(0x7062465be33249a2),
+      UINT64_C(0x9a65c0b85ac1a96a) },
+    { UINT64_C(0xa664dd104af46af5), UINT64_C(0xa34f397a1f83baa8),
+      UINT64_C(0x9cd4315e9e0832fb) },
+    { UINT64_C(0xabbb03b010a259ca), UINT64_C(0xbbdee0206028ab6b),
+      UINT64_C(0x9f4c6f5508ee5d51) },
+    { UINT64_C(0xf4863dfce7ffff91), UINT64_C(0xd268bc652de9f407),
+      UINT64_C(0xa1cea21faf8ac771) },
+    { UINT64_C(0x621c438b25df1585), UINT64_C(0x3de1db4dd55f29a7),
+      UINT64_C(0xa45af1e1f40c333b) },
+    { UINT64_C(0x185380d5269b57ef), UINT64_C(0xa911f650b893501c),
+      UINT64_C(0xa6f1876108f3009d) },
+    { UINT64_C(0x63232c3e9bfa0a11), UINT64_C(0x16cc14c91b4fdb27),
+      UINT64_C(0xa9928c067d67bb65) },
+    { UINT64_C(0xc41ae021229ddf15), UINT64_C(0x0e93c017936f2fa0),
+      UINT64_C(0xac3e29e2d3d7813b) },
+    { UINT64_C(0x4ed9617806799386), UINT64_C(0x89923298baa201e1),
+      UINT64_C(0xaef48bb022ffa9da) },
+    { UINT64_C(0xe87614216a080a78), UINT64_C(0x39863ee4919e1311),
+      UINT64_C(0xb1b5dcd4c192c269) },
+    { UINT64_C(0x5c9b53139de09777), UINT64_C(0xd7cc08291bd3a598),
+      UINT64_C(0xb4824965fca1967e) },
+    { UINT64_C(0xae77b3d86e708487), UINT64_C(0xeb266eee5f9881bf),
+      UINT64_C(0xb759fe2ad8f3ada4) },
+    { UINT64_C(0xbc7d210f9a5c6dbf), UINT64_C(0xa3c5b2cd849202e2),
+      UINT64_C(0xba3d289edf7b5311) },
+    { UINT64_C(0xbbe4009de4a416f5), UINT64_C(0xfdaedb7097ac8074),
+      UINT64_C(0xbd2bf6f4f511ef19) },
+    { UINT64_C(0x65aa4053e1347405), UINT64_C(0x65cddb8c44a5ecea),
+      UINT64_C(0xc026981a3daa2e5d) },
+    { UINT64_C(0x973c231f3b6732a6), UINT64_C(0xee10dd0a52ad1394),
+      UINT64_C(0xc32d3bb90b262a0a) },
+    { UINT64_C(0x89bf106785527ef9), UINT64_C(0x26da076c298885f7),
+      UINT64_C(0xc640123bd8007ee1) },
+    { UINT64_C(0x8c19dc51eab2bd20), UINT64_C(0x9bfe7ce9f9e4fa85),
+      UINT64_C(0xc95f4cd04df7fdb9) },
+    { UINT64_C(0x54110fd9a996a9ba), UINT64_C(0x8c7b829a74501497),
+      UINT64_C(0xcc8b1d6a58ee609b) },
+    { UINT64_C(0xee329dc278c9882c), UINT64_C(0xc0bf5eb90cc0f4e8),
+      UINT64_C(0xcfc3b6c7462b3282) },
+    { UINT64_C(0xfb28f8b60985a3ad), UINT64_C(0x96ff7d5b6f99fcd8),
+      UINT64_C(0xd3094c70f034de4b) },
+    { UINT64_C(0x2cd600ba87d1bd8c), UINT64_C(0xdbec9f0a23f3b4e3),
+      UINT64_C(0xd65c12c0f772a298) },
+    { UINT64_C(0xf615c6cde704fea7), UINT64_C(0x6670eb831541ab5f),
+      UINT64_C(0xd9bc3ee407caf517) },
+    { UINT64_C(0xaa3a07c9381a9085), UINT64_C(0x7809cf1c1ae0267b),
+      UINT64_C(0xdd2a06dd2b72af4b) },
+    { UINT64_C(0xba617fe1f3f4f548), UINT64_C(0x955289dd211002f5),
+      UINT64_C(0xe0a5a1892b223221) },
+    { UINT64_C(0x8fafb8d83d97c538), UINT64_C(0x1461033040027983),
+      UINT64_C(0xe42f46a1fbe683dd) },
+    { UINT64_C(0x583cd3bb6f678cca), UINT64_C(0x66c74a26eccc4bb2),
+      UINT64_C(0xe7c72ec23ac545bf) },
+    { UINT64_C(0x4b0053d1427b591d), UINT64_C(0xc77fd14b89153eb8),
+      UINT64_C(0xeb6d9368b66b3bf1) },
+    { UINT64_C(0xca170f74050387f1), UINT64_C(0x44bd8397b6d52de2),
+      UINT64_C(0xef22aefc071e02e5) },
+    { UINT64_C(0x412646d9182a7ae3), UINT64_C(0x2542fa88dd47dc64),
+      UINT64_C(0xf2e6bcce352a7191) },
+    { UINT64_C(0x5c03bf5836404c22), UINT64_C(0xabd8e26ffed26645),
+      UINT64_C(0xf6b9f9206e0a0fc3) },
+    { UINT64_C(0x48f4753e3841bbd4), UINT64_C(0xb68e7a573b84c167),
+      UINT64_C(0xfa9ca126c87af32b) },
+    { UINT64_C(0x12708a7aad8263b2), UINT64_C(0x61db684632cb9121),
+      UINT64_C(0xfe8ef30c17c644e9) }
+  };
+
+/* exp(j/4096)-1 for 0 <= j <= 63 */
+static const mp_limb_t exp2_tab[64][3] =
+  {
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x0000000000000000) },
+    { UINT64_C(0xc4df26269e70cc5f), UINT64_C(0x7777d27df7e11e14),
+      UINT64_C(0x0010008002aab555) },
+    { UINT64_C(0xb19a3e5c922e8087), UINT64_C(0x445b06186326382a),
+      UINT64_C(0x0020020015560004) },
+    { UINT64_C(0x6502165c217f628a), UINT64_C(0x6769a08b2258a3ac),
+      UINT64_C(0x0030048048036020) },
+    { UINT64_C(0x54811d5145a75424), UINT64_C(0xe38e6ce86e9277aa),
+      UINT64_C(0x00400800aab555dd) },
+    { UINT64_C(0x9f165151d2ff5657), UINT64_C(0xc05f30f14ef8aab4),
+      UINT64_C(0x00500c814d6f61a0) },
+    { UINT64_C(0x8b966e82a48e0a79), UINT64_C(0x0d9d1272ce89353c),
+      UINT64_C(0x006012024036040d) },
+    { UINT64_C(0x88d393c20aa9d28a), UINT64_C(0xe7b53cab72a3eb53),
+      UINT64_C(0x00701883930ebe16) },
+    { UINT64_C(0x9bae49a2157e9d0d), UINT64_C(0x7d41d5bd72f4c8f3),
+      UINT64_C(0x0080200556001112) },
+    { UINT64_C(0xe48672bef63730c4), UINT64_C(0x158b543333b678d3),
+      UINT64_C(0x0090288799117ec4) },
+    { UINT64_C(0x9b14142810b0cece), UINT64_C(0x180a449c83a3f023),
+      UINT64_C(0x00a0320a6c4b8970) },
+    { UINT64_C(0xed7186b85c4d4360), UINT64_C(0x14e98f4c1f60125e),
+      UINT64_C(0x00b03c8ddfb7b3eb) },
+    { UINT64_C(0x052b6d48cb0a9c1f), UINT64_C(0xce894e3dfc9a70cc),
+      UINT64_C(0x00c04812036081a9) },
+    { UINT64_C(0x939f2fd3a7feb7b4), UINT64_C(0x4402432fdfc8620b),
+      UINT64_C(0x00d05496e75176d1) },
+    { UINT64_C(0x3df7ab6a06d1b799), UINT64_C(0xbca9fdf6bfe9e088),
+      UINT64_C(0x00e0621c9b971846) },
+    { UINT64_C(0xb0e3b79e2aa2dfff), UINT64_C(0xd497c31c7c81db73),
+      UINT64_C(0x00f070a3303eebbf) },
+    { UINT64_C(0xbcf00c930cec0ede), UINT64_C(0x8a2a42d26aa9ee67),
+      UINT64_C(0x0100802ab55777d2) },
+    { UINT64_C(0x5e8676380dc1e5ad), UINT64_C(0x4c8e30463ef9c8ae),
+      UINT64_C(0x011090b33af04405) },
+    { UINT64_C(0xd04c1b41205a768e), UINT64_C(0x0b45c967dadaefa5),
+      UINT64_C(0x0120a23cd119d8df) },
+    { UINT64_C(0x9c5278cb3920adf9), UINT64_C(0x46b15f2f84d1f8ae),
+      UINT64_C(0x0130b4c787e5bff7) },
+    { UINT64_C(0x00bb9c91766249a3), UINT64_C(0x2198ee751446d792),
+      UINT64_C(0x0140c8536f668406) },
+    { UINT64_C(0xe792b4ec5422a8d0), UINT64_C(0x73b6d9699a666f57),
+      UINT64_C(0x0150dce097afb0f4) },
+    { UINT64_C(0x383f5de063724020), UINT64_C(0xdd43d1c612d83616),
+      UINT64_C(0x0160f26f10d5d3eb) },
+    { UINT64_C(0x8bc6cd397e0b499e), UINT64_C(0xdb8403c2a8337160),
+      UINT64_C(0x017108feeaee7b66) },
+    { UINT64_C(0x7cb757c3ce5e4817), UINT64_C(0xde5591eb196059a8),
+      UINT64_C(0x0181209036103740) },
+    { UINT64_C(0x28e97dc4fcbdb1a9), UINT64_C(0x5ec071e5ce625015),
+      UINT64_C(0x01913923025298c6) },
+    { UINT64_C(0x571308b41a70e0f4), UINT64_C(0xf687ba442c69451d),
+      UINT64_C(0x01a152b75fce32c4) },
+    { UINT64_C(0x6d6fa2250b659660), UINT64_C(0x78bc7173ba797784),
+      UINT64_C(0x01b16d4d5e9c999b) },
+    { UINT64_C(0x7288161b93f7ee39), UINT64_C(0x0b51ede8a979d440),
+      UINT64_C(0x01c188e50ed8634a) },
+    { UINT64_C(0x2e872504050e33aa), UINT64_C(0x41b3d79b540a7948),
+      UINT64_C(0x01d1a57e809d2782) },
+    { UINT64_C(0xc3c9f1b7f00d3828), UINT64_C(0x385ddaf34c263055),
+      UINT64_C(0x01e1c319c4077fb7) },
+    { UINT64_C(0x59c5d8f4b15ccc4b), UINT64_C(0xb1751d3b8e43244d),
+      UINT64_C(0x01f1e1b6e935072d) },
+    { UINT64_C(0x6f63923ddae1f48d), UINT64_C(0x326382bc73689d32),
+      UINT64_C(0x0202015600445b0c) },
+    { UINT64_C(0xdb192ec3698059f3), UINT64_C(0x2274d698fd81346a),
+      UINT64_C(0x021221f719551a6b) },
+    { UINT64_C(0x38ffcb78863aa31b), UINT64_C(0xea75e48e1b12b67e),
+      UINT64_C(0x0222439a4487e664) },
+    { UINT64_C(0x6ba21d4acb1f1bf5), UINT64_C(0x155594b38176c98d),
+      UINT64_C(0x0232663f91fe6226) },
+    { UINT64_C(0xd53083bef0fc3c4a), UINT64_C(0x71c8195ebeb17169),
+      UINT64_C(0x024289e711db32fd) },
+    { UINT64_C(0x0e27c89f87339959), UINT64_C(0x34ec3f4a2614ac81),
+      UINT64_C(0x0252ae90d442006c) },
+    { UINT64_C(0x2e6b8585c6407ebe), UINT64_C(0x1df2f0223d02a8c2),
+      UINT64_C(0x0262d43ce9577436) },
+    { UINT64_C(0x60a057a67e7b5323), UINT64_C(0x9ac8f79d4f527637),
+      UINT64_C(0x0272faeb61413a71) },
+    { UINT64_C(0x9f9b429c95b38a1d), UINT64_C(0xedc31b41d51da74b),
+      UINT64_C(0x0283229c4c260197) },
+    { UINT64_C(0x6d8d36950c25562d), UINT64_C(0x544c9501560ffd9b),
+      UINT64_C(0x02934b4fba2d7a95) },
+    { UINT64_C(0x5eda99bcd19389c8), UINT64_C(0x2e9800ce78b516c2),
+      UINT64_C(0x02a37505bb8058d9) },
+    { UINT64_C(0xda23a0b15336e77f), UINT64_C(0x2852cd55eeb307d8),
+      UINT64_C(0x02b39fbe60485266) },
+    { UINT64_C(0xe6de850ac49f4051), UINT64_C(0x625b4002f163f947),
+      UINT64_C(0x02c3cb79b8b01fe2) },
+    { UINT64_C(0xcf2b4be582686eae), UINT64_C(0x9d791c7904d4203e),
+      UINT64_C(0x02d3f837d4e37ca7) },
+    { UINT64_C(0x4b858c0e1ab6d6cd), UINT64_C(0x6618ffadb9cce872),
+      UINT64_C(0x02e425f8c50f26d3) },
+    { UINT64_C(0x8b20eda120a80e1f), UINT64_C(0x410a7ece2a49c0e1),
+      UINT64_C(0x02f454bc9960df57) },
+    { UINT64_C(0x65b11db81591418b), UINT64_C(0xd9411a1cee76ca2d),
+      UINT64_C(0x0304848362076a08) },
+    { UINT64_C(0x1ee98da9aa03643b), UINT64_C(0x2e9813f64b2d9d9c),
+      UINT64_C(0x0314b54d2f328db2) },
+    { UINT64_C(0x351d322296c69ba5), UINT64_C(0xc5993c295dc88a33),
+      UINT64_C(0x0324e71a11131421) },
+    { UINT64_C(0x9f38f791726179e5), UINT64_C(0xd846bfd60c18fa63),
+      UINT64_C(0x033519ea17daca3a) },
+    { UINT64_C(0x9731ef8a613b90a7), UINT64_C(0x87e80e008252399e),
+      UINT64_C(0x03454dbd53bc8005) },
+    { UINT64_C(0x996f4535e1096f2b), UINT64_C(0x0fd9e10c0bce86cc),
+      UINT64_C(0x03558293d4ec08bf) },
+    { UINT64_C(0xb46d86b2ba205214), UINT64_C(0xf9617d5016b94810),
+      UINT64_C(0x0365b86dab9e3ae9) },
+    { UINT64_C(0xc2bc4c9970b0ecf0), UINT64_C(0x508334fb35de4e82),
+      UINT64_C(0x0375ef4ae808f05e) },
+    { UINT64_C(0xe9a315a00a66cd2e), UINT64_C(0xd9dc4178f723669e),
+      UINT64_C(0x0386272b9a630659) },
+    { UINT64_C(0xfd7c7412ea2967df), UINT64_C(0x498002906886f512),
+      UINT64_C(0x0396600fd2e45d90) },
+    { UINT64_C(0x8fb26d561b98e34e), UINT64_C(0x7ad8b37228e41856),
+      UINT64_C(0x03a699f7a1c5da3b) },
+    { UINT64_C(0xcef502aa55840044), UINT64_C(0xa98ba5ede532b71b),
+      UINT64_C(0x03b6d4e31741642b) },
+    { UINT64_C(0x7eb3fd0615635f7a), UINT64_C(0xab61140826800b29),
+      UINT64_C(0x03c710d24391e6d7) },
+    { UINT64_C(0xa53edbb2714ee461), UINT64_C(0x2b2f982a58729894),
+      UINT64_C(0x03d74dc536f3516d) },
+    { UINT64_C(0xbe91aa80d1089b34), UINT64_C(0xe4cb5c27f3d31b9e),
+      UINT64_C(0x03e78bbc01a296e0) },
+    { UINT64_C(0xeb5decac8509af83), UINT64_C(0xe1f90f54bc4accb6),
+      UINT64_C(0x03f7cab6b3ddadfe) }
+  };
+
+/* For 128 <= i <= 255, c1 = ceil(2^16/i): if the 8 most significant bits
+   of m in [1/2,1) give i, then 1 <= m * c1/2^8 < 1 + 79/2^13 */
+static const unsigned short logc_tab[128] =
+  {
+    512, 509, 505, 501, 497, 493, 490, 486, 482, 479, 475, 472,
+    469, 465, 462, 459, 456, 452, 449, 446, 443, 440, 437, 435,
+    432, 429, 426, 423, 421, 418, 415, 413, 410, 408, 405, 403,
+    400, 398, 395, 393, 391, 388, 386, 384, 382, 379, 377, 375,
+    373, 371, 369, 367, 365, 363, 361, 359, 357, 355, 353, 351,
+    349, 347, 345, 344, 342, 340, 338, 337, 335, 333, 331, 330,
+    328, 327, 325, 323, 322, 320, 319, 317, 316, 314, 313, 311,
+    310, 308, 307, 305, 304, 303, 301, 300, 298, 297, 296, 294,
+    293, 292, 290, 289, 288, 287, 285, 284, 283, 282, 281, 279,
+    278, 277, 276, 275, 274, 272, 271, 270, 269, 268, 267, 266,
+    265, 264, 263, 262, 261, 260, 259, 258
+  };
+
+/* log(c1/2^8) for the values of c1 of logc_tab */
+static const mp_limb_t log1_tab[128][3] =
+  {
+    { UINT64_C(0x40f343267298b62e), UINT64_C(0xc9e3b39803f2f6af),
+      UINT64_C(0xb17217f7d1cf79ab) },
+    { UINT64_C(0xa5a09dbe56cb5026), UINT64_C(0xe93de3ce48220cf9),
+      UINT64_C(0xaff0f6d68c48c46a) },
+    { UINT64_C(0x7c45e063e89345b1), UINT64_C(0xc6d36d95a2e31620),
+      UINT64_C(0xadebe98738e398df) },
+    { UINT64_C(0x62ac9ba47e5a8c97), UINT64_C(0x58b886efcdbc6753),
+      UINT64_C(0xabe2bf99b78c842d) },
+    { UINT64_C(0x69b72a463d03a3be), UINT64_C(0x6e9f5a3b58daba82),
+      UINT64_C(0xa9d5682dccdbe554) },
+    { UINT64_C(0xdeb76066f6cee028), UINT64_C(0x6ae9c862ac6766b0),
+      UINT64_C(0xa7c3d1fa8137442e) },
+    { UINT64_C(0x1b11377c71eab2c3), UINT64_C(0x4766e98c37ec33b6),
+      UINT64_C(0xa633cd7e6771cd8b) },
+    { UINT64_C(0xefbe78337535ca72), UINT64_C(0xaf45d980fe84b0c1),
+      UINT64_C(0xa41a9e8f5446fb9e) },
+    { UINT64_C(0xb774c2fe7ce6611b), UINT64_C(0x93dcdb0770cb6c1b),
+      UINT64_C(0xa1fcff17ce733bd3) },
+    { UINT64_C(0x4c1319c2b0f2e29a), UINT64_C(0xf22de7fc9e0a897c),
+      UINT64_C(0xa063d24406e74914) },
+    { UINT64_C(0x6428483e214f6995), UINT64_C(0x7f248fda412dff28),
+      UINT64_C(0x9e3e3fffb9902e41) },
+    { UINT64_C(0x1717c9e700413260), UINT64_C(0x221301b6f8c38f62),
+      UINT64_C(0x9c9f069ab150cd4e) },
+    { UINT64_C(0x664649ca12086050), UINT64_C(0x7d46809643620924),
+      UINT64_C(0x9afd276e9b750012) },
+    { UINT64_C(0xd425b66b30969665), UINT64_C(0x1a47dcb894777bab),
+      UINT64_C(0x98cbd07d3ff350eb) },
+    { UINT64_C(0x794a2964475e2e71), UINT64_C(0xa10c34910d589296),
+      UINT64_C(0x9723a1b720134202) },
+    { UINT64_C(0x09b70926d2f3f6b1), UINT64_C(0x83229256758013fd),
+      UINT64_C(0x9578af81320568e5) },
+    { UINT64_C(0x527d7309433bbdf4), UINT64_C(0xc1f9edcb438ffc03),
+      UINT64_C(0x93caf0944d88d75b) },
+    { UINT64_C(0xbcdfcc1f5b0c6c60), UINT64_C(0xf1b439165240a471),
+      UINT64_C(0x918986bdf5fa1416) },
+    { UINT64_C(0x1815855aefe6b3b6), UINT64_C(0x5ee3de864ebe3f85),
+      UINT64_C(0x8fd51a5c384a6060) },
+    { UINT64_C(0x4c2379b2ef8dce38), UINT64_C(0xa7c766fde2efc77f),
+      UINT64_C(0x8e1dc0fb89e125e4) },
+    { UINT64_C(0x4a5a6964362de537), UINT64_C(0x9450b0b19c7bd954),
+      UINT64_C(0x8c63707fae78305d) },
+    { UINT64_C(0x3a330f341cf1faee), UINT64_C(0x799d1cb2f14054ed),
+      UINT64_C(0x8aa61e97a6af4d4c) },
+    { UINT64_C(0xb33d8124a38b3ded), UINT64_C(0x70f563f992055ba7),
+      UINT64_C(0x88e5c0bc3e67c204) },
+    { UINT64_C(0x0f03ba3465769dd8), UINT64_C(0x088773b63396c205),
+      UINT64_C(0x87b920e4da4bea75) },
+    { UINT64_C(0x366fbbf35d3ed11b), UINT64_C(0xc4bdd99effe69b64),
+      UINT64_C(0x85f39721295415b4) },
+    { UINT64_C(0x138bf88f7cbaa284), UINT64_C(0xb04dc93e62f9fca4),
+      UINT64_C(0x842ae4425a2872e0) },
+    { UINT64_C(0x1c88e1e218e0a7e1), UINT64_C(0xe60804593bed4da1),
+      UINT64_C(0x825efced4936932f) },
+    { UINT64_C(0x7f813df41d0c9c77), UINT64_C(0x86ea0422eef3c95d),
+      UINT64_C(0x808fd5892ffc50c0) },
+    { UINT64_C(0x4cd354c3b077d0b2), UINT64_C(0x27a9e98a9728ab5b),
+      UINT64_C(0x7f593c83d855c729) },
+    { UINT64_C(0x4829981609381f6e), UINT64_C(0x15b0f2db34148654),
+      UINT64_C(0x7d848fe9c0a2b185) },
+    { UINT64_C(0xa79b9a321b209fe8), UINT64_C(0x1b8ebe47bfa42723),
+      UINT64_C(0x7bac83190377d0d6) },
+    { UINT64_C(0xa073ced7f7134fd2), UINT64_C(0xbafc7dbe13068b9a),
+      UINT64_C(0x7a6fe9966187d591) },
+    { UINT64_C(0x07be2ec9c3da432d), UINT64_C(0xf63d16552918d8a8),
+      UINT64_C(0x78922069f1b09872) },
+    { UINT64_C(0x50684ce6bafcfd59), UINT64_C(0x989a927476e1fe9f),
+      UINT64_C(0x7751a813071282fb) },
+    { UINT64_C(0x3a0362f4419bb461), UINT64_C(0x20c03da9fcaf6f51),
+      UINT64_C(0x756dfe6b8b1a0f2c) },
+    { UINT64_C(0xf42fe386786844a3), UINT64_C(0x6670896207930e04),
+      UINT64_C(0x74298eb9c8799095) },
+    { UINT64_C(0x8ecbd4e8235b8363), UINT64_C(0x97607bcbfee6892b),
+      UINT64_C(0x723fdf1e6a6886b0) },
+    { UINT64_C(0x18e57d814099fe7a), UINT64_C(0xcf052dea69b60bb5),
+      UINT64_C(0x70f75e9f36b535ce) },
+    { UINT64_C(0x311ea419e6ba62fc), UINT64_C(0xe8707055995edbfd),
+      UINT64_C(0x6f07822c36b42909) },
+    { UINT64_C(0xd0e50a47cc8e39e9), UINT64_C(0x24332cd95c388d79),
+      UINT64_C(0x6dbad674f3cd7675) },
+    { UINT64_C(0xb1285b021b4c7d52), UINT64_C(0x479608a2c5575e43),
+      UINT64_C(0x6c6c783af7f16da4) },
+    { UINT64_C(0x1fc8ee26768c44ea), UINT64_C(0x213fd4bc950d7be1),
+      UINT64_C(0x6a73b26a68212635) },
+    { UINT64_C(0xadea18d6c6bda28d), UINT64_C(0xf29adc3ad3a4b273),
+      UINT64_C(0x6921024396ec28af) },
+    { UINT64_C(0x7d20ffb34547d7c3), UINT64_C(0xda35d9bd01488606),
+      UINT64_C(0x67cc8fb2fe612fca) },
+    { UINT64_C(0xdb8e4afa251912db), UINT64_C(0xa4bbb11e0c6fdd25),
+      UINT64_C(0x667656045f822b2e) },
+    { UINT64_C(0x57d84071a184a8d9), UINT64_C(0x1f51dcb51ef48bf1),
+      UINT64_C(0x64719fad16a0f61f) },
+    { UINT64_C(0x2f0de74fad484c16), UINT64_C(0x54b0205fa6b2545e),
+      UINT64_C(0x6316df2162d22a1f) },
+    { UINT64_C(0x925f7be907b866a9), UINT64_C(0xf362dfd6fbaf5d18),
+      UINT64_C(0x61ba4668cc2e8027) },
+    { UINT64_C(0x91e7b68b97fca812), UINT64_C(0xdc35fb48fe3e02f5),
+      UINT64_C(0x605bd076835256d6) },
+    { UINT64_C(0xd4e7913d2bbdd611), UINT64_C(0x7c3467fe5a4130a6),
+      UINT64_C(0x5efb7828debefe78) },
+    { UINT64_C(0xf9a70095ca237ad3), UINT64_C(0x9514d8512843a96f),
+      UINT64_C(0x5d993848e76f3b04) },
+    { UINT64_C(0x0ad2d30427013ed4), UINT64_C(0x99bf714395378e6a),
+      UINT64_C(0x5c350b89e248d756) },
+    { UINT64_C(0x141ae8011533d0aa), UINT64_C(0x7a93326784d060de),
+      UINT64_C(0x5aceec88d650f625) },
+    { UINT64_C(0x21c8060ce937940f), UINT64_C(0x6c2be3bee0efb006),
+      UINT64_C(0x5966d5cc0f87ca07) },
+    { UINT64_C(0xaab8e6abfbe7cc64), UINT64_C(0xcf88281c848eebf9),
+      UINT64_C(0x57fcc1c29e4f4f21) },
+    { UINT64_C(0x56572fcb95c9f930), UINT64_C(0x434821165c35be57),
+      UINT64_C(0x5690aac3d33f8671) },
+    { UINT64_C(0xd9c451d7b1cf1acb), UINT64_C(0x31840e7b9124fad7),
+      UINT64_C(0x55228b0eb7498b3f) },
+    { UINT64_C(0x66cdcca2e54691cf), UINT64_C(0x578268823a180c30),
+      UINT64_C(0x53b25cc98009a6bd) },
+    { UINT64_C(0x33ad6cb1e5c9a028), UINT64_C(0x01e5f07441208b64),
+      UINT64_C(0x52401a0100274330) },
+    { UINT64_C(0x5a0d900f896d629f), UINT64_C(0x6ce8ea536fcb01aa),
+      UINT64_C(0x50cbbca813a04ed6) },
+    { UINT64_C(0xc5c8a5230ecd9c75), UINT64_C(0xd9a395e36732453c),
+      UINT64_C(0x4f553e9707dc3e1c) },
+    { UINT64_C(0xc15baf48fe6fd0a7), UINT64_C(0x53ac4fdd0432bc86),
+      UINT64_C(0x4ddc998aff616bc9) },
+    { UINT64_C(0xe174b4cf89f43b02), UINT64_C(0xe533b3f64c86b997),
+      UINT64_C(0x4c61c725510613ea) },
+    { UINT64_C(0x77ad6fb226f15213), UINT64_C(0xb3246a14206cf37b),
+      UINT64_C(0x4ba38aeb8474c270) },
+    { UINT64_C(0x8eab2f9615eadf8a), UINT64_C(0xd24c13f040e58b5a),
+      UINT64_C(0x4a25684f7a1a8d7a) },
+    { UINT64_C(0x9aad37a78762e748), UINT64_C(0x0a14f69d750cbd2e),
+      UINT64_C(0x48a507ef3de59689) },
+    { UINT64_C(0x882eeb5ecaf5d936), UINT64_C(0x1a39d500e3bbc33b),
+      UINT64_C(0x47226305a667ebef) },
+    { UINT64_C(0x155bfade651e6707), UINT64_C(0x3d1b0e4d1469c533),
+      UINT64_C(0x466034b7508dbd9d) },
+    { UINT64_C(0x635cec26ba4b4e62), UINT64_C(0x66298edd249f5ad2),
+      UINT64_C(0x44da1c0a4ea2c17b) },
+    { UINT64_C(0xb517c34f9620f505), UINT64_C(0xf640e1e5ec92e667),
+      UINT64_C(0x4351ad5e6add2c81) },
+    { UINT64_C(0x0dbfd046d21fd151), UINT64_C(0x5c1fe5ef7a008065),
+      UINT64_C(0x41c6e17f35643474) },
+    { UINT64_C(0x7660cbc0efa11c83), UINT64_C(0x89ef42d7ee95e444),
+      UINT64_C(0x41009652d341036b) },
+    { UINT64_C(0x40584455b22c817b), UINT64_C(0xaa8cd86f29a59412),
+      UINT64_C(0x3f7230dabc7c551a) },
+    { UINT64_C(0xa014b61d50fa02ce), UINT64_C(0x2fb6fe80c61b8198),
+      UINT64_C(0x3eaa14ac96f66e0e) },
+    { UINT64_C(0xb269a9044f8a14e7), UINT64_C(0x3f8b8c806ecaef71),
+      UINT64_C(0x3d1804a554b4bfd2) },
+    { UINT64_C(0xa8a3c08973a90bc8), UINT64_C(0xa628ccc5b7e0ee95),
+      UINT64_C(0x3b83794157d8fac1) },
+    { UINT64_C(0x673d12bf9c69752e), UINT64_C(0x221acbf26a00e1e3),
+      UINT64_C(0x3ab842d69f7722b7) },
+    { UINT64_C(0xc765ea7411adc1b1), UINT64_C(0x4bb03de5ff734495),
+      UINT64_C(0x391fef8f35344358) },
+    { UINT64_C(0x3d49f4cd19c53da0), UINT64_C(0x108e3ae024a807c0),
+      UINT64_C(0x3852d0ab18318146) },
+    { UINT64_C(0x0dc4f7de1af9f5e8), UINT64_C(0x13fee0cf0d027b9e),
+      UINT64_C(0x36b6a33d1f6b48dd) },
+    { UINT64_C(0x69b8b9a5d50ca14a), UINT64_C(0x9cc0326f99eb9767),
+      UINT64_C(0x35e7929d017fe5b1) },
+    { UINT64_C(0xe36cdb1665bcc381), UINT64_C(0x6e2360f533184fc7),
+      UINT64_C(0x3447783fc56ac632) },
+    { UINT64_C(0x2ae1aabc82456b5c), UINT64_C(0xaf18f801f0612879),
+      UINT64_C(0x33766c5cfbf706ab) },
+    { UINT64_C(0x38ddf18a505d5b77), UINT64_C(0xb13d72d4c4807034),
+      UINT64_C(0x31d251bd10da8154) },
+    { UINT64_C(0x5704b6b7eb4ebea3), UINT64_C(0x401202fb932ef5a5),
+      UINT64_C(0x30ff40ca41922120) },
+    { UINT64_C(0xfc2929b1021656af), UINT64_C(0xc6d65ad40c100c8f),
+      UINT64_C(0x2f57120421b21237) },
+    { UINT64_C(0xa80ef0a0497218ea), UINT64_C(0x66fe755ecc92f416),
+      UINT64_C(0x2e81f1ea806f4993) },
+    { UINT64_C(0xf5e439264e5cf2c8), UINT64_C(0xbfc6c7855d367f54),
+      UINT64_C(0x2cd59a84e55aa1bd) },
+    { UINT64_C(0xd55c7355fdf3e632), UINT64_C(0xe7c4140e424775fc),
+      UINT64_C(0x2bfe60e14f27a790) },
+    { UINT64_C(0xf10db27ca994a594), UINT64_C(0x8b7555d4a0c560e1),
+      UINT64_C(0x2b2671b330410ba6) },
+    { UINT64_C(0x010974a31dc36f85), UINT64_C(0x4c0de61b3aafefb4),
+      UINT64_C(0x29746de734abcab4) },
+    { UINT64_C(0xcaf99174f60aa4f8), UINT64_C(0xa7b2a1f0fc3c1882),
+      UINT64_C(0x289a56d996fa3ccf) },
+    { UINT64_C(0xf326daa75290329f), UINT64_C(0x9b2d8abc627f2e81),
+      UINT64_C(0x26e3f8403d1ee877) },
+    { UINT64_C(0x68499d8cf5ea542a), UINT64_C(0x28c704d3edc0b50c),
+      UINT64_C(0x2607ae31c8ffa5fd) },
+    { UINT64_C(0xfbc9070f7e29fbad), UINT64_C(0x0bb8e203edf4d109),
+      UINT64_C(0x252aa5f03fea4698) },
+    { UINT64_C(0x8fd9099532ec12a7), UINT64_C(0x0c08d1cb35ce7e77),
+      UINT64_C(0x236e55aa5ecf4052) },
+    { UINT64_C(0x3781e73cc9d9f0da), UINT64_C(0x4409f1d3f839bd93),
+      UINT64_C(0x228f0b08ce8558d1) },
+    { UINT64_C(0x4cb4fd8d03860ef9), UINT64_C(0x2ee2f481855d1c48),
+      UINT64_C(0x21aefcf9a11cb2cd) },
+    { UINT64_C(0x91e2ba81202ec615), UINT64_C(0x2e5199f9324e3bfe),
+      UINT64_C(0x1fec9131dbeabaaa) },
+    { UINT64_C(0xa68e9a66eb6a4b2d), UINT64_C(0x7cc9716eeb32f131),
+      UINT64_C(0x1f0a30c01162a661) },
+    { UINT64_C(0xb94ebc4017f6f958), UINT64_C(0xea87ffe1fe9e155d),
+      UINT64_C(0x1e27076e2af2e5e9) },
+    { UINT64_C(0xc9b44946a8fe9eed), UINT64_C(0x4376547643e8904a),
+      UINT64_C(0x1d4313d66cb35d5e) },
+    { UINT64_C(0xd8f01a56e250c978), UINT64_C(0x43c678193f1049e9),
+      UINT64_C(0x1b78c82bb0eda108) },
+    { UINT64_C(0x9f67e22ed398d01e), UINT64_C(0x0bd22a9c3aa4c79a),
+      UINT64_C(0x1a926d3a4ad56365) },
+    { UINT64_C(0xa68d14682a70e81b), UINT64_C(0xecc3c7cf62e3c895),
+      UINT64_C(0x19ab42462033acdb) },
+    { UINT64_C(0x02603e40d7c4c4b4), UINT64_C(0xacb42a65edab4357),
+      UINT64_C(0x18c345d6319b20f5) },
+    { UINT64_C(0xd17a663c1e02c74b), UINT64_C(0x4480c89afb3da115),
+      UINT64_C(0x17da766d7b12cc84) },
+    { UINT64_C(0x48ed8883f197f649), UINT64_C(0xdee9c4f79259c66d),
+      UINT64_C(0x160658a93750c3b1) },
+    { UINT64_C(0xc9c7e09bc3e10dec), UINT64_C(0x278e686a2f91584b),
+      UINT64_C(0x151b073f06183f69) },
+    { UINT64_C(0x763da19b3cbd62d9), UINT64_C(0xba9f26b32d925d19),
+      UINT64_C(0x142edcbea646f03b) },
+    { UINT64_C(0x1a0eca5b78467951), UINT64_C(0x998376104d137502),
+      UINT64_C(0x1341d7961bd1d092) },
+    { UINT64_C(0xc0a5b681bc070672), UINT64_C(0xfb69a700ecc0a2d3),
+      UINT64_C(0x1253f62f0a1416f8) },
+    { UINT64_C(0xa42905a6685a6aad), UINT64_C(0x625c173dd325e46d),
+      UINT64_C(0x116536eea37ae0e8) },
+    { UINT64_C(0xd3474d3375b52596), UINT64_C(0xbe64b8b775997898),
+      UINT64_C(0x0f85186008b15330) },
+    { UINT64_C(0x63edccec34ecfab4), UINT64_C(0xf1e2992bfea38e76),
+      UINT64_C(0x0e93b5c56d85a908) },
+    { UINT64_C(0xbce26340fc53dc9e), UINT64_C(0x468a63ecfb66e94a),
+      UINT64_C(0x0da16eb88cb8df61) },
+    { UINT64_C(0x83ddbaefec66d058), UINT64_C(0xb41d00a417e330f8),
+      UINT64_C(0x0cae41876471f5be) },
+    { UINT64_C(0x9bf701b2a89d8cb0), UINT64_C(0x1a7950f7252c163c),
+      UINT64_C(0x0bba2c7b196e7e23) },
+    { UINT64_C(0x26146c24c8704d77), UINT64_C(0x3547a963a91bb301),
+      UINT64_C(0x0ac52dd7e4726a46) },
+    { UINT64_C(0x5eb87846f4c603a4), UINT64_C(0x80ad90155c8a7235),
+      UINT64_C(0x09cf43dcff5eafd4) },
+    { UINT64_C(0xd1fe3399d400c423), UINT64_C(0x651776453b7e8254),
+      UINT64_C(0x08d86cc491ecbfe1) },
+    { UINT64_C(0xaefae14cddf35ad2), UINT64_C(0x3e3f04f1ef229fae),
+      UINT64_C(0x07e0a6c39e0cc013) },
+    { UINT64_C(0xf6d4cc7d14dcddcc), UINT64_C(0xf5196dd62379867f),
+      UINT64_C(0x06e7f009ebe465fe) },
+    { UINT64_C(0x53c40a9487466227), UINT64_C(0x49fd531c5af00773),
+      UINT64_C(0x05ee46c1f56c46aa) },
+    { UINT64_C(0x83cb8c4d2677fdbc), UINT64_C(0xcd295bf531790cc6),
+      UINT64_C(0x04f3a910d1a95d3b) },
+    { UINT64_C(0xeb03be903ddc5336), UINT64_C(0xf3db4e9a6f57aadb),
+      UINT64_C(0x03f815161f807c79) },
+    { UINT64_C(0x85250c0074fc191f), UINT64_C(0xa4a25e0b0837cd42),
+      UINT64_C(0x02fb88ebf0214edb) },
+    { UINT64_C(0xb3db2c3ef9a073a8), UINT64_C(0xc37690391dc282d2),
+      UINT64_C(0x01fe02a6b106788f) }
+  };
+
+/* -log(c2/2^26) with c2 = 2^26 - j*2^13 + j^2 for 0 <= j <= 79 */
+static const mp_limb_t log2j_tab[80][3] =
+  {
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x0000000000000000) },
+    { UINT64_C(0xbfe62cee339b9d14), UINT64_C(0xc445999e2bc2bc64),
+      UINT64_C(0x0007ffdffeaaa6aa) },
+    { UINT64_C(0xf473b7b62aad77fb), UINT64_C(0x88dde026e26c98af),
+      UINT64_C(0x000fff7ff5551558) },
+    { UINT64_C(0xec871678fce3fe1d), UINT64_C(0x5098f3d74eff84bf),
+      UINT64_C(0x0017fedfdbfebc18) },
+    { UINT64_C(0xadb40e3f399cb85a), UINT64_C(0x26678ad8a86e208d),
+      UINT64_C(0x001ffdffaaa6ab11) },
+    { UINT64_C(0x32b51d70852a18bc), UINT64_C(0x26bc1d0294f94a28),
+      UINT64_C(0x0027fcdf594b928e) },
+    { UINT64_C(0xc88723fb356c88c2), UINT64_C(0x8cad1d3fd5d96810),
+      UINT64_C(0x002ffb7edfebc30a) },
+    { UINT64_C(0x356a7402f702d303), UINT64_C(0xc2d89a5013fe2569),
+      UINT64_C(0x0037f9de36852d3d) },
+    { UINT64_C(0x38db7ff540cd2f39), UINT64_C(0x7809a08dcf43d179),
+      UINT64_C(0x003ff7fd55156227) },
+    { UINT64_C(0xa85f4631dfd7c3b8), UINT64_C(0xb79fb64b9033da05),
+      UINT64_C(0x0047f5dc3399931b) },
+    { UINT64_C(0x816cbd6b96c461e5), UINT64_C(0x05b8cc47913c8795),
+      UINT64_C(0x004ff37aca0e91cf) },
+    { UINT64_C(0xad196ab6d9680c4f), UINT64_C(0x7f1dfba11f41dc4e),
+      UINT64_C(0x0057f0d91070d062) },
+    { UINT64_C(0x84dc8ddd15884025), UINT64_C(0xfcf36aa6f27cda3b),
+      UINT64_C(0x005fedf6febc616f) },
+    { UINT64_C(0x01b497e93a0970ce), UINT64_C(0x3c2bb1c1b7ce25ab),
+      UINT64_C(0x0067ead48cecf816) },
+    { UINT64_C(0xc066b19a5d6f62f6), UINT64_C(0x08bf19a9eff39588),
+      UINT64_C(0x006fe771b2fde805) },
+    { UINT64_C(0x226904eb53a586a5), UINT64_C(0x6ca70c042d747002),
+      UINT64_C(0x0077e3ce68ea2589) },
+    { UINT64_C(0x1fc7db11e2339ab7), UINT64_C(0xe29e0f6a93947007),
+      UINT64_C(0x007fdfeaa6ac4599) },
+    { UINT64_C(0x5cb3c8c1323fc9ab), UINT64_C(0x8ca4a7d64830e316),
+      UINT64_C(0x0087dbc6643e7de2) },
+    { UINT64_C(0xc12776d2eefab7d1), UINT64_C(0x6e4b74475013d9a5),
+      UINT64_C(0x008fd761999aa4d1) },
+    { UINT64_C(0xecdebfbcb3b0defc), UINT64_C(0xaac2e27509062b26),
+      UINT64_C(0x0097d2bc3eba31a2) },
+    { UINT64_C(0x4425030ca0bb9064), UINT64_C(0xc6b0d13d26b89560),
+      UINT64_C(0x009fcdd64b963c6c) },
+    { UINT64_C(0x3207859d5820d3b7), UINT64_C(0xedcc7a72bf7d2a4a),
+      UINT64_C(0x00a7c8afb8277e2c) },
+    { UINT64_C(0x7f3bfba3843aab48), UINT64_C(0x3c40fc9a93bb34fa),
+      UINT64_C(0x00afc3487c6650d3) },
+    { UINT64_C(0x226620cf9e98d5cb), UINT64_C(0x0bd6dd0d4f0762ff),
+      UINT64_C(0x00b7bda0904aaf4f) },
+    { UINT64_C(0xde2e3865fbcf9af1), UINT64_C(0x44e4dae40bd6f9ec),
+      UINT64_C(0x00bfb7b7ebcc359b) },
+    { UINT64_C(0x18c94a43072cb634), UINT64_C(0xb3086afee2ddd757),
+      UINT64_C(0x00c7b18e86e220ca) },
+    { UINT64_C(0x36896e681f15cb59), UINT64_C(0x5da63560c54a92dd),
+      UINT64_C(0x00cfab2459834f14) },
+    { UINT64_C(0x34d2e00e7383a227), UINT64_C(0xe432ec074d40fde3),
+      UINT64_C(0x00d7a4795ba63fdf) },
+    { UINT64_C(0x9877466ad84c52e0), UINT64_C(0xde44d350922812c9),
+      UINT64_C(0x00df9d8d854113d1) },
+    { UINT64_C(0x1070cd1e9a319dcf), UINT64_C(0x3f6e53ec669bd664),
+      UINT64_C(0x00e79660ce498cd8) },
+    { UINT64_C(0xa291bbeb1fa61d50), UINT64_C(0xbee1ee41b41462d4),
+      UINT64_C(0x00ef8ef32eb50e36) },
+    { UINT64_C(0x66a531046c0da0c9), UINT64_C(0x42dfe71bec97f417),
+      UINT64_C(0x00f787449e789c93) },
+    { UINT64_C(0x0444cbff8f6fe7fe), UINT64_C(0x4fee055fc515062c),
+      UINT64_C(0x00ff7f551588de02) },
+    { UINT64_C(0x9f63bea153cdcf1b), UINT64_C(0x7bd9b8719b4a0d18),
+      UINT64_C(0x010777248bda1a13) },
+    { UINT64_C(0x348537ece26925d3), UINT64_C(0xe484fee31068b2a7),
+      UINT64_C(0x010f6eb2f96039dd) },
+    { UINT64_C(0xc8e9a6aa922e1fc8), UINT64_C(0xaa7e64e87de97fdb),
+      UINT64_C(0x01176600560ec80c) },
+    { UINT64_C(0x5f833fe4633f01b9), UINT64_C(0x6f647201fc491450),
+      UINT64_C(0x011f5d0c99d8f0eb) },
+    { UINT64_C(0xab7ff35629125c2f), UINT64_C(0xd814dd2ebba837f4),
+      UINT64_C(0x012753d7bcb18272) },
+    { UINT64_C(0xd4505caf315dbfc9), UINT64_C(0x12a7deec6c82d8ac),
+      UINT64_C(0x012f4a61b68aec55) },
+    { UINT64_C(0xf8317ce200915619), UINT64_C(0x6037f82f6ae611f6),
+      UINT64_C(0x013740aa7f57400a) },
+    { UINT64_C(0x3d8c00553cb0b326), UINT64_C(0xa276856b48b95e96),
+      UINT64_C(0x013f36b20f0830dd) },
+    { UINT64_C(0x6c69fa02563017cb), UINT64_C(0xed0d74ae33d1b939),
+      UINT64_C(0x01472c785d8f13f8) },
+    { UINT64_C(0x30a3789d31db0729), UINT64_C(0x1ace75bc8a9d6799),
+      UINT64_C(0x014f21fd62dce072) },
+    { UINT64_C(0x4f83c84684199f35), UINT64_C(0x66affb04be432288),
+      UINT64_C(0x0157174116e22f57) },
+    { UINT64_C(0xa68d8f4dd7b92234), UINT64_C(0x0898622e630df449),
+      UINT64_C(0x015f0c43718f3bbc) },
+    { UINT64_C(0xba99fefb1300edb9), UINT64_C(0xd5f79af207ef2d12),
+      UINT64_C(0x016701046ad3e2c4) },
+    { UINT64_C(0xf2fe372763d909b2), UINT64_C(0xe62fa2d21bbfe446),
+      UINT64_C(0x016ef583fa9fa3b4) },
+    { UINT64_C(0x94614d582c0aad33), UINT64_C(0x3acc2c37caba5483),
+      UINT64_C(0x0176e9c218e19ffa) },
+    { UINT64_C(0xfe2a55dc57bb82b1), UINT64_C(0x6b89c761585faa56),
+      UINT64_C(0x017eddbebd889b3a) },
+    { UINT64_C(0x48fd9f0daf2e21f0), UINT64_C(0x562ce37a09a74b42),
+      UINT64_C(0x0186d179e082fb5f) },
+    { UINT64_C(0x11a014b6a0bef733), UINT64_C(0xd228fe1e38e7deb3),
+      UINT64_C(0x018ec4f379bec8a3) },
+    { UINT64_C(0x5d393576a60bbc87), UINT64_C(0x68185778a8672fc0),
+      UINT64_C(0x0196b82b8129ada0) },
+    { UINT64_C(0x4acf938bc0df0c8c), UINT64_C(0x0d04811099e307e2),
+      UINT64_C(0x019eab21eeb0f758) },
+    { UINT64_C(0xfe37d51776dd28c0), UINT64_C(0xe1801d4a98b11c56),
+      UINT64_C(0x01a69dd6ba419544) },
+    { UINT64_C(0x9123090612113254), UINT64_C(0xf49225884145c5ab),
+      UINT64_C(0x01ae9049dbc81964) },
+    { UINT64_C(0x4f52f3dbb049960e), UINT64_C(0x0a730cbda4072fa7),
+      UINT64_C(0x01b6827b4b30b847) },
+    { UINT64_C(0x8affb35708205c60), UINT64_C(0x671c143d2a4bb4d9),
+      UINT64_C(0x01be746b00674917) },
+    { UINT64_C(0xbcc531cdad6f004a), UINT64_C(0x9ca92865233ce1fc),
+      UINT64_C(0x01c66618f35745ac) },
+    { UINT64_C(0xdb59b2cb17d14334), UINT64_C(0x5d8d9ac45313e078),
+      UINT64_C(0x01ce57851bebca94) },
+    { UINT64_C(0x4be5fbb1c05f3d4e), UINT64_C(0x529c0f3509be7b3e),
+      UINT64_C(0x01d648af720f9720) },
+    { UINT64_C(0x28ddad60a5a26495), UINT64_C(0xf4e1f15866744d2d),
+      UINT64_C(0x01de3997edad0d72) },
+    { UINT64_C(0x2232cff1abe1f904), UINT64_C(0x6b56c7c58418a3f4),
+      UINT64_C(0x01e62a3e86ae328c) },
+    { UINT64_C(0x081b1fcd695377de), UINT64_C(0x6c5fba2a5675f5f9),
+      UINT64_C(0x01ee1aa334fcae57) },
+    { UINT64_C(0x7bcb813ecdd52b66), UINT64_C(0x23279f86026a2e25),
+      UINT64_C(0x01f60ac5f081cbb6) },
+    { UINT64_C(0x1a418e13170247c5), UINT64_C(0x18cbe98e72fe3e8f),
+      UINT64_C(0x01fdfaa6b126788f) },
+    { UINT64_C(0x5ea2f1a16c6a0abc), UINT64_C(0x215ec23cdb1e1c97),
+      UINT64_C(0x0205ea456ed345da) },
+    { UINT64_C(0x34ef46171b7f8374), UINT64_C(0x4cbeb066b7373881),
+      UINT64_C(0x020dd9a2217067ad) },
+    { UINT64_C(0xf1f34960951c9bbb), UINT64_C(0xdb441832bb696a4e),
+      UINT64_C(0x0215c8bcc0e5b549) },
+    { UINT64_C(0x0f6b521f26d4fa77), UINT64_C(0x3644ec22ea2fe93b),
+      UINT64_C(0x021db795451aa929) },
+    { UINT64_C(0x9cec54c1c3cc7c48), UINT64_C(0xec6ee356d473ee02),
+      UINT64_C(0x0225a62ba5f66109) },
+    { UINT64_C(0x25ebf2c123866b41), UINT64_C(0xb1f88992bed7d6be),
+      UINT64_C(0x022d947fdb5f9dfc) },
+    { UINT64_C(0xdda57b819a381b36), UINT64_C(0x64a97d8218b6c1eb),
+      UINT64_C(0x02358291dd3cc471) },
+    { UINT64_C(0x30eabb8f5b5408db), UINT64_C(0x13ba319557d05ad6),
+      UINT64_C(0x023d7061a373dc44) },
+    { UINT64_C(0xb5d640ee5e00027c), UINT64_C(0x0b8b83c4e7e1b971),
+      UINT64_C(0x02455def25ea90ca) },
+    { UINT64_C(0xb69387787aeee2e7), UINT64_C(0xe536806c6f81816d),
+      UINT64_C(0x024d4b3a5c8630de) },
+    { UINT64_C(0x16a3bd7c6c08c2af), UINT64_C(0x99f4a45b33759650),
+      UINT64_C(0x025538433f2baef1) },
+    { UINT64_C(0x1b6e12a193e9a66d), UINT64_C(0x9a60f21fdf628461),
+      UINT64_C(0x025d2509c5bfa111) },
+    { UINT64_C(0x464ce0fb7e2f04b0), UINT64_C(0xe9922e7f6e26e7bb),
+      UINT64_C(0x0265118de82640fb) },
+    { UINT64_C(0x5ed1e895347273e2), UINT64_C(0x3c0e97f0556e6461),
+      UINT64_C(0x026cfdcf9e436c28) },
+    { UINT64_C(0xa1334daffba8273e), UINT64_C(0x1a996cdc7706eca8),
+      UINT64_C(0x0274e9cedffaa3d6) }
+  };
+
+/* sin(j/128) for 0 <= j <= 100 */
+static const mp_limb_t sin_tab[101][3] =
+  {
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x0000000000000000) },
+    { UINT64_C(0xca4a3d8632d90613), UINT64_C(0x6e8744e61221010c),
+      UINT64_C(0x01fffeaaaaeeeee8) },
+    { UINT64_C(0x62c181f7f5624024), UINT64_C(0xaa938cac1f113dca),
+      UINT64_C(0x03fff5555dddda9d) },
+    { UINT64_C(0x848a2e8e5e37ac6b), UINT64_C(0xefe2b51527336737),
+      UINT64_C(0x05ffdc0040cc9541) },
+    { UINT64_C(0xe5790d2ec611113c), UINT64_C(0x2bf904ddb51e4655),
+      UINT64_C(0x07ffaaabbbba1ba3) },
+    { UINT64_C(0x36a42cf366df98be), UINT64_C(0xec54203d1c114647),
+      UINT64_C(0x09ff595896a2ea94) },
+    { UINT64_C(0x75f5ca5a34d0d55c), UINT64_C(0xcc841722cd0cc475),
+      UINT64_C(0x0bfee008197dd454) },
+    { UINT64_C(0x1fb4cf74ed0929d8), UINT64_C(0x393f40f6fc8d840b),
+      UINT64_C(0x0dfe36bc2c36d606) },
+    { UINT64_C(0xfb074dfbb9cbf2d8), UINT64_C(0x5d259b2f692d4aca),
+      UINT64_C(0x0ffd557776a76d5a) },
+    { UINT64_C(0x9d01f5671333b123), UINT64_C(0x0b34643106c367f3),
+      UINT64_C(0x11fc343d808bee83) },
+    { UINT64_C(0x058ee45ef70faa39), UINT64_C(0x79bab59ae5d278c9),
+      UINT64_C(0x13facb12d1755a9b) },
+    { UINT64_C(0x70bc6bdc62f294a2), UINT64_C(0x9ec3f505bbf76e6d),
+      UINT64_C(0x15f911fd10b736bf) },
+    { UINT64_C(0xe59085f4c393f5ab), UINT64_C(0xfc2d1800501a1007),
+      UINT64_C(0x17f701032550e41a) },
+    { UINT64_C(0xf8f43d554bce6927), UINT64_C(0xa5b5fab077057fed),
+      UINT64_C(0x19f4902d55d1f949) },
+    { UINT64_C(0x127f32744b090172), UINT64_C(0x461077a9331f2958),
+      UINT64_C(0x1bf1b78568391d7a) },
+    { UINT64_C(0xb4bff38cc6e6a3e7), UINT64_C(0xe0e3a091d31ab219),
+      UINT64_C(0x1dee6f16c1cce5d5) },
+    { UINT64_C(0x5995027b5e671884), UINT64_C(0x069a86721f89f85a),
+      UINT64_C(0x1feaaeee86ee35ca) },
+    { UINT64_C(0x694337c5efa586a3), UINT64_C(0x234392787cf273ae),
+      UINT64_C(0x21e66f1bbae3a2ec) },
+    { UINT64_C(0x4194f3c5bf5269e1), UINT64_C(0x8357b344b2da517a),
+      UINT64_C(0x23e1a7af5f9d5d48) },
+    { UINT64_C(0x959ee0bfb7a1e36f), UINT64_C(0x9787d108fd438cf5),
+      UINT64_C(0x25dc50bc95711d0d) },
+    { UINT64_C(0x38c5142bb56a489f), UINT64_C(0xeb335b365c87d594),
+      UINT64_C(0x27d66258bacd96a3) },
+    { UINT64_C(0x34906c3dd105473b), UINT64_C(0x276cab01cbf04269),
+      UINT64_C(0x29cfd49b8be4f665) },
+    { UINT64_C(0xb9faf5648c3244d4), UINT64_C(0x5de7ce03b2514952),
+      UINT64_C(0x2bc89f9f424de548) },
+    { UINT64_C(0xaf47ed2dcf58b12d), UINT64_C(0xb34e8dd1f8db9df7),
+      UINT64_C(0x2dc0bb80b49a97ff) },
+    { UINT64_C(0x769af396e0189ef7), UINT64_C(0x56a1c4792f856258),
+      UINT64_C(0x2fb8205f75e56a2b) },
+    { UINT64_C(0x6eba6799983d7012), UINT64_C(0x82ece9a235671324),
+      UINT64_C(0x31aec65df552876f) },
+    { UINT64_C(0x3f4639ce938477af), UINT64_C(0x10f602c44df4fa51),
+      UINT64_C(0x33a4a5a19d862467) },
+    { UINT64_C(0x59c98d4e54555de5), UINT64_C(0xdf12a0a4c8561de1),
+      UINT64_C(0x3599b652f40ec999) },
+    { UINT64_C(0x26ea336c768f68c3), UINT64_C(0x0d2b53d865582e45),
+      UINT64_C(0x378df09db8c332ce) },
+    { UINT64_C(0xb150c21a675ab855), UINT64_C(0xb97b21bc1ca6a337),
+      UINT64_C(0x39814cb10513453c) },
+    { UINT64_C(0x087f1753fa64b087), UINT64_C(0x8ef9499c81f0d965),
+      UINT64_C(0x3b73c2bf6b4b9f66) },
+    { UINT64_C(0x39a8a40626609204), UINT64_C(0x0fca854698aba330),
+      UINT64_C(0x3d654aff15cb457a) },
+    { UINT64_C(0xdd5676648d7db526), UINT64_C(0x13bd7b8e6a3d1635),
+      UINT64_C(0x3f55dda9e62aed75) },
+    { UINT64_C(0xc0ba050cdb527011), UINT64_C(0x73d620271388dd47),
+      UINT64_C(0x414572fd94556e64) },
+    { UINT64_C(0xa87150438275b774), UINT64_C(0x4f5f36c1d4b84451),
+      UINT64_C(0x4334033bcd90d660) },
+    { UINT64_C(0x969f47166ab88cf9), UINT64_C(0xbbf2524f52e3a06a),
+      UINT64_C(0x452186aa5377ab20) },
+    { UINT64_C(0xbb2ede618ebc6078), UINT64_C(0x076fe0dcff47fe31),
+      UINT64_C(0x470df5931ae1d946) },
+    { UINT64_C(0xeccad880b0d24b5a), UINT64_C(0xf7fccb100e7a1b26),
+      UINT64_C(0x48f948446abcd6b0) },
+    { UINT64_C(0xce07dc08a1471775), UINT64_C(0xa9c4cf96c03519b9),
+      UINT64_C(0x4ae37710fad27c8a) },
+    { UINT64_C(0xbded4f9e7702b047), UINT64_C(0xcb6b40c302c651f7),
+      UINT64_C(0x4ccc7a50127e1de0) },
+    { UINT64_C(0x8603ffadb3eb2543), UINT64_C(0x07aaa090f0734e28),
+      UINT64_C(0x4eb44a5da74f6002) },
+    { UINT64_C(0x18859f18b37169a6), UINT64_C(0x638a8fa3a60a1994),
+      UINT64_C(0x509adf9a7b9a5a0f) },
+    { UINT64_C(0x93f2bce3c4eb4ee4), UINT64_C(0x3ba6bb08eac82c20),
+      UINT64_C(0x5280326c3cf48182) },
+    { UINT64_C(0xe66c83bf4dddd949), UINT64_C(0x57155eef0f332fb3),
+      UINT64_C(0x54643b3da29de9b3) },
+    { UINT64_C(0xee826d9674a00247), UINT64_C(0x3a5d61ff06572290),
+      UINT64_C(0x5646f27e8bd65cbe) },
+    { UINT64_C(0xcdfa8f3189be794e), UINT64_C(0x7f602ea244cdbbbf),
+      UINT64_C(0x582850a41e1dd46c) },
+    { UINT64_C(0xed2b5d17c0b1afc4), UINT64_C(0x76dfdbbb5531d74c),
+      UINT64_C(0x5a084e28e35fda27) },
+    { UINT64_C(0xe6734bcab2e07624), UINT64_C(0xbc14ee9da0d36483),
+      UINT64_C(0x5be6e38ce8095542) },
+    { UINT64_C(0x51320ff5528a6afb), UINT64_C(0xa94675a2498de5d8),
+      UINT64_C(0x5dc40955d9084f48) },
+    { UINT64_C(0x057ff42ae0fdf130), UINT64_C(0xc432540a50e22c53),
+      UINT64_C(0x5f9fb80f21b53649) },
+    { UINT64_C(0xf8b5753cd0105d94), UINT64_C(0x40e9b5face03e525),
+      UINT64_C(0x6179e84a09a5258a) },
+    { UINT64_C(0xbd9695fc8def3caf), UINT64_C(0xa02ea766325d8aa8),
+      UINT64_C(0x6352929dd264bd44) },
+    { UINT64_C(0xd7dc5368b0a47957), UINT64_C(0x31ec197c0a840a11),
+      UINT64_C(0x6529afa7d51b1296) },
+    { UINT64_C(0x65ea0585bcbf9b1a), UINT64_C(0xe39a320b0a3fa5fd),
+      UINT64_C(0x66ff380ba0144109) },
+    { UINT64_C(0x7630d755850c0655), UINT64_C(0x3bc712bcc4ccddc4),
+      UINT64_C(0x68d3247314332797) },
+    { UINT64_C(0xbe456b9e13349caa), UINT64_C(0xb60a761fe3f9e559),
+      UINT64_C(0x6aa56d8e8249db4e) },
+    { UINT64_C(0x7036a0b40887a0b6), UINT64_C(0xdbd34660ae6c52ac),
+      UINT64_C(0x6c760c14c8585a51) },
+    { UINT64_C(0xa446ac4c215d26b0), UINT64_C(0x752d093c00f4d47b),
+      UINT64_C(0x6e44f8c36eb10a1c) },
+    { UINT64_C(0x382e038379b09cf0), UINT64_C(0xff33abf4fd340ccc),
+      UINT64_C(0x70122c5ec5028c8c) },
+    { UINT64_C(0xe3aac247b1c57cea), UINT64_C(0x3acb970a9f6729c6),
+      UINT64_C(0x71dd9fb1ff467785) },
+    { UINT64_C(0x769bf4779bad0e3b), UINT64_C(0x1baf6928eb3fb021),
+      UINT64_C(0x73a74b8f52947b68) },
+    { UINT64_C(0x734ecdfb582fdb75), UINT64_C(0xa44a75fc29c779bd),
+      UINT64_C(0x756f28d011d98528) },
+    { UINT64_C(0xfa8e1ede5f052fd3), UINT64_C(0x4c6e171fd99e6b39),
+      UINT64_C(0x77353054ca72690d) },
+    { UINT64_C(0x224d08bc20631ea9), UINT64_C(0x6df7bd981dc38c61),
+      UINT64_C(0x78f95b0560a9a3bd) },
+    { UINT64_C(0x92f45b4fcaf13cd6), UINT64_C(0xd92f0d93f60ded99),
+      UINT64_C(0x7abba1d12c17bfa1) },
+    { UINT64_C(0xaba6c0741b5362bc), UINT64_C(0x212f8a7525bfb113),
+      UINT64_C(0x7c7bfdaf13e5ed17) },
+    { UINT64_C(0x172961c921823a4f), UINT64_C(0x6542bcb4028d0964),
+      UINT64_C(0x7e3a679daaf25c67) },
+    { UINT64_C(0x1f24e8038419c0b4), UINT64_C(0x54c97482db5159df),
+      UINT64_C(0x7ff6d8a34bd5e8fa) },
+    { UINT64_C(0x74206c32ca951a93), UINT64_C(0xe650f8d09fd4d6aa),
+      UINT64_C(0x81b149ce34caa5a4) },
+    { UINT64_C(0xb2b493f6f5cb2e39), UINT64_C(0xb5c8a71fe36ce1e0),
+      UINT64_C(0x8369b434a372da7e) },
+    { UINT64_C(0x80c2e9e0775ffc61), UINT64_C(0x378bd8dd614753d0),
+      UINT64_C(0x852010f4f0800521) },
+    { UINT64_C(0x62dfcefeaa782185), UINT64_C(0xe421e822dee54f35),
+      UINT64_C(0x86d45935ab396cb4) },
+    { UINT64_C(0x00c143a5cb16637d), UINT64_C(0x3133101330225272),
+      UINT64_C(0x88868625b4e1dbb2) },
+    { UINT64_C(0x48a41251514bbed8), UINT64_C(0x9535e2739a8512f4),
+      UINT64_C(0x8a3690fc5bfc11bf) },
+    { UINT64_C(0x6dfceeeb739cc895), UINT64_C(0xf2b88171243d63d6),
+      UINT64_C(0x8be472f9776d809a) },
+    { UINT64_C(0x492cd36d42d82ada), UINT64_C(0x9bce3cd128060119),
+      UINT64_C(0x8d902565817ee783) },
+    { UINT64_C(0x21417d46f19a2223), UINT64_C(0xa3fa4f41d5a3ffd4),
+      UINT64_C(0x8f39a191b2ba6122) },
+    { UINT64_C(0xc72ca78abe571bfb), UINT64_C(0x6cc92c8ea8c2815b),
+      UINT64_C(0x90e0e0d81ca67879) },
+    { UINT64_C(0x75aab6ff7929a8d3), UINT64_C(0x3d02457bcce59c41),
+      UINT64_C(0x9285dc9bc45dd9ea) },
+    { UINT64_C(0xf5d1d8185c99fa01), UINT64_C(0x41c4cbd2920497a8),
+      UINT64_C(0x94288e48bd0335fc) },
+    { UINT64_C(0x5fa61a156ebb10f6), UINT64_C(0x91c49bd2aa09e851),
+      UINT64_C(0x95c8ef544210ec0b) },
+    { UINT64_C(0x6817bf94ce349902), UINT64_C(0xaafc1cfc6fc28abb),
+      UINT64_C(0x9766f93cd18413a6) },
+    { UINT64_C(0x03f54d14c8172e0d), UINT64_C(0x68412b426b675ed5),
+      UINT64_C(0x9902a58a45e27bed) },
+    { UINT64_C(0x2033ead73b89e28f), UINT64_C(0x93f3d7820781de29),
+      UINT64_C(0x9a9bedcdf01b38d9) },
+    { UINT64_C(0x6a547cd7ceb1ac8b), UINT64_C(0x05256c4f857991ca),
+      UINT64_C(0x9c32cba2b14156ef) },
+    { UINT64_C(0x0feece34886cfefe), UINT64_C(0x9ac582d0f8582659),
+      UINT64_C(0x9dc738ad14204e68) },
+    { UINT64_C(0x9040c45ec3f0a747), UINT64_C(0x6a3c7aa3c1019984),
+      UINT64_C(0x9f592e9b66a9cf90) },
+    { UINT64_C(0xecfad43f3e534358), UINT64_C(0x11fa50fd9e9a15ff),
+      UINT64_C(0xa0e8a725d33c828c) },
+    { UINT64_C(0x82c66160cb1d9eb8), UINT64_C(0x527c32b55f5405c1),
+      UINT64_C(0xa2759c0e79c35582) },
+    { UINT64_C(0xf105e1301afe642c), UINT64_C(0xd6b173825e038346),
+      UINT64_C(0xa400072188acf49c) },
+    { UINT64_C(0x16c3e9bd08d93793), UINT64_C(0x6d02b9c662cdd293),
+      UINT64_C(0xa587e23555bb0808) },
+    { UINT64_C(0x96dabf88c3079247), UINT64_C(0xda0ec90712bb748b),
+      UINT64_C(0xa70d272a76a8d4b6) },
+    { UINT64_C(0x20f7e7fbe735f8bd), UINT64_C(0xe2f3c76ef9e24399),
+      UINT64_C(0xa88fcfebd9a8dd47) },
+    { UINT64_C(0x3193b47f187f1472), UINT64_C(0x2c28520d3911b8a0),
+      UINT64_C(0xaa0fd66eddb92123) },
+    { UINT64_C(0xdc2e7109fce43d56), UINT64_C(0x10ed343ec65d7e3a),
+      UINT64_C(0xab8d34b36acd9872) },
+    { UINT64_C(0x636e74e76f51e09c), UINT64_C(0xa3a9057bb0ac24b8),
+      UINT64_C(0xad07e4c409d08c4f) },
+    { UINT64_C(0x476747c2646425fc), UINT64_C(0x966e1d6af140a488),
+      UINT64_C(0xae7fe0b5fc786b2d) },
+    { UINT64_C(0x9a5dfd5a6c228e0b), UINT64_C(0xd9defdc416e33f5e),
+      UINT64_C(0xaff522a954f2ba16) },
+    { UINT64_C(0xc3c1225e078baa0c), UINT64_C(0x4cf5493b7cc23bd3),
+      UINT64_C(0xb167a4c90d63c424) },
+    { UINT64_C(0xe6d838c03e29c1bd), UINT64_C(0xdf2d6e20a77e1ca3),
+      UINT64_C(0xb2d7614b1f3aaa24) },
+    { UINT64_C(0x11f0433eb2b133f8), UINT64_C(0x05913765434a59d1),
+      UINT64_C(0xb44452709a597529) }
+  };
+
+/* cos(j/128) for 0 <= j <= 100, cos(0) = 1 being replaced by 1 - 2^(-192) */
+static const mp_limb_t cos_tab[101][3] =
+  {
+    { UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+      UINT64_C(0xffffffffffffffff) },
+    { UINT64_C(0x283c5951585b1e5f), UINT64_C(0x4034032db5b41832),
+      UINT64_C(0xfffe0000aaaa93e9) },
+    { UINT64_C(0x104dd21b8d241e94), UINT64_C(0x4514074bde6ace45),
+      UINT64_C(0xfff8000aaaa4fa51) },
+    { UINT64_C(0x135c240050c100b2), UINT64_C(0xdb5d0d2ef79e495c),
+      UINT64_C(0xffee0035ffbf335c) },
+    { UINT64_C(0x419c52ed4a661fc5), UINT64_C(0x576da4ec94946fb9),
+      UINT64_C(0xffe000aaa93e9589) },
+    { UINT64_C(0xebe3652d45d15a02), UINT64_C(0x8fa5f362cdf8fb4f),
+      UINT64_C(0xffce01a0a53dd0cc) },
+    { UINT64_C(0x299a949cee13e78a), UINT64_C(0xc4a9f9b72a141836),
+      UINT64_C(0xffb8035fefccf674) },
+    { UINT64_C(0xde514ab6004fb873), UINT64_C(0x56dbddc0e6638e54),
+      UINT64_C(0xff9e064081d18948) },
+    { UINT64_C(0xf80466e85a2928be), UINT64_C(0x070f73284de215b8),
+      UINT64_C(0xff800aaa4fa69a65) },
+    { UINT64_C(0xe564aa36c0fe04fe), UINT64_C(0x4d24d3d531dc4f1c),
+      UINT64_C(0xff5e1115477cf85e) },
+    { UINT64_C(0xb9df9716ae6d2f79), UINT64_C(0x05e641b4834be062),
+      UINT64_C(0xff381a094f7b771a) },
+    { UINT64_C(0xc5c1d16abd40392d), UINT64_C(0x5636fa83b5fd8a7d),
+      UINT64_C(0xff0e261e439f57ea) },
+    { UINT64_C(0xc3813d8eb961faae), UINT64_C(0x2056a6bf1b6b28df),
+      UINT64_C(0xfee035fbf35cda63) },
+    { UINT64_C(0xe3ad01168db3438b), UINT64_C(0xc4b9a583683996b6),
+      UINT64_C(0xfeae4a5a1effff68) },
+    { UINT64_C(0xd38361e93aa13761), UINT64_C(0x1ebc368c35611b2a),
+      UINT64_C(0xfe78640074cd88f5) },
+    { UINT64_C(0xbd08c2eb52fc525d), UINT64_C(0xba488fb6d0a10db2),
+      UINT64_C(0xfe3e83c68de4420e) },
+    { UINT64_C(0x649bab98783f8311), UINT64_C(0x1e6a129df6f18ce5),
+      UINT64_C(0xfe00aa93eade9b6d) },
+    { UINT64_C(0xbc7d13e5c9f01e19), UINT64_C(0xb5be9ecb56262d4b),
+      UINT64_C(0xfdbed95ff034aa43) },
+    { UINT64_C(0x578c42df76b5a002), UINT64_C(0x54c7b317625d2cc1),
+      UINT64_C(0xfd791131e25e97ab) },
+    { UINT64_C(0xa7b873aff1014b10), UINT64_C(0x9b4dda2f98f79caa),
+      UINT64_C(0xfd2f5320e1b79020) },
+    { UINT64_C(0x9dc71aa16f922acc), UINT64_C(0x6d60c76e8c45bf0a),
+      UINT64_C(0xfce1a053e621438b) },
+    { UINT64_C(0xddb0cc4c07d22e1a), UINT64_C(0x7e05962b0d9fdf1f),
+      UINT64_C(0xfc8ffa01ba680741) },
+    { UINT64_C(0xb5e59d3ef153a426), UINT64_C(0x5d63d99a9d439e1d),
+      UINT64_C(0xfc3a6170f767ac73) },
+    { UINT64_C(0xcea20c8f3f676b47), UINT64_C(0xaa43b8abf4f6a457),
+      UINT64_C(0xfbe0d7f7fef11e70) },
+    { UINT64_C(0xea358867e9cdb38a), UINT64_C(0xe6fe7924697eea13),
+      UINT64_C(0xfb835efcf670dd2c) },
+    { UINT64_C(0x674a92b4df80d9c9), UINT64_C(0x00ac1fe28ac5fd76),
+      UINT64_C(0xfb21f7f5c156696b) },
+    { UINT64_C(0x5bfd68296ecd1cca), UINT64_C(0xd069f01d8ea33ade),
+      UINT64_C(0xfabca467fb3cb8f1) },
+    { UINT64_C(0x3d7470a4ab0f4ccf), UINT64_C(0xbe1db5d76ae64d98),
+      UINT64_C(0xfa5365e8f1d3ca27) },
+    { UINT64_C(0x1fd7fa2fe11e09fc), UINT64_C(0x2e296bae5b5ed9c1),
+      UINT64_C(0xf9e63e1d9e8b6f6f) },
+    { UINT64_C(0xfb0f8d5b875ae63d), UINT64_C(0x842beadab054a932),
+      UINT64_C(0xf9752eba9fff6b98) },
+    { UINT64_C(0x1fc733d97354d426), UINT64_C(0x40416c1984b6cbed),
+      UINT64_C(0xf90039843324f9b9) },
+    { UINT64_C(0xffc95b275ad99540), UINT64_C(0x0e4ec5825059a789),
+      UINT64_C(0xf887604e2c39dbb2) },
+    { UINT64_C(0x1426dbe79edc4a02), UINT64_C(0x83d33cb95f94f8a4),
+      UINT64_C(0xf80aa4fbef750ba7) },
+    { UINT64_C(0x8cb1ab822aeb446b), UINT64_C(0xbc9ee42591b7c5a6),
+      UINT64_C(0xf78a098069792daa) },
+    { UINT64_C(0x53e3c50afe8b22f4), UINT64_C(0x05b8fe88789e4f42),
+      UINT64_C(0xf7058fde0788dfc8) },
+    { UINT64_C(0xefb96d5b46c031f0), UINT64_C(0x4bd6d42af8c0067f),
+      UINT64_C(0xf67d3a26af7d07aa) },
+    { UINT64_C(0x80d01ce3c0f82bae), UINT64_C(0x0c1da8b578427832),
+      UINT64_C(0xf5f10a7bb77d3dfa) },
+    { UINT64_C(0x4995667f5547baff), UINT64_C(0x0ea9f4a32c652155),
+      UINT64_C(0xf561030ddd7a7896) },
+    { UINT64_C(0x0b7ace2a51c0631c), UINT64_C(0x369c8758630d2ac0),
+      UINT64_C(0xf4cd261d3e6c15bb) },
+    { UINT64_C(0xb52df1ee8ddf7c65), UINT64_C(0x2f5fb76b14d2a64a),
+      UINT64_C(0xf43575f94d4f6b27) },
+    { UINT64_C(0x102beb569f101ee4), UINT64_C(0xae9957263dab8877),
+      UINT64_C(0xf399f500c9e9fd37) },
+    { UINT64_C(0xe69b7b15a945e8e6), UINT64_C(0x61fa05f9177380e8),
+      UINT64_C(0xf2faa5a1b74e82fd) },
+    { UINT64_C(0xf5ea6f479eae2eb6), UINT64_C(0x6bfa2eb2f99cc674),
+      UINT64_C(0xf2578a595224dd2e) },
+    { UINT64_C(0x8eb9ae2ac7070517), UINT64_C(0x86c55feadc8d0dcc),
+      UINT64_C(0xf1b0a5b406b526d8) },
+    { UINT64_C(0x5142ac8ad54dfb09), UINT64_C(0x7d44e04272520443),
+      UINT64_C(0xf105fa4d66b607a6) },
+    { UINT64_C(0xf74f3dc8d0efb0f5), UINT64_C(0xa39c09dc6b984afe),
+      UINT64_C(0xf0578ad01ede707f) },
+    { UINT64_C(0xfcf9189462261126), UINT64_C(0x4eb03319278a2d41),
+      UINT64_C(0xefa559f5ec3aec3a) },
+    { UINT64_C(0xe2e4d7e15d93f48d), UINT64_C(0xf9b95ea2ea0ac0d3),
+      UINT64_C(0xeeef6a879146af0b) },
+    { UINT64_C(0x262e3b609db604e2), UINT64_C(0xcd91ddb734d3a47e),
+      UINT64_C(0xee35bf5ccac89052) },
+    { UINT64_C(0x1c6f6b85d8f8aca6), UINT64_C(0x93c56bcb9d338a15),
+      UINT64_C(0xed785b5c44741b44) },
+    { UINT64_C(0xf14666006fb431d9), UINT64_C(0xc37aba4073aa48f1),
+      UINT64_C(0xecb7417b8d4ee3fe) },
+    { UINT64_C(0xd3013b5942b1abfd), UINT64_C(0x447e56a093626798),
+      UINT64_C(0xebf274bf0bda4f62) },
+    { UINT64_C(0x15c85230a4e8ea4b), UINT64_C(0xb93796827916a78f),
+      UINT64_C(0xeb29f839f201fd13) },
+    { UINT64_C(0xba47383855c3b405), UINT64_C(0x976ef0b1ec26515f),
+      UINT64_C(0xea5dcf0e30cf03e6) },
+    { UINT64_C(0xb1f6b2c1e97f7922), UINT64_C(0x0dd3089cbdd18a75),
+      UINT64_C(0xe98dfc6c6be031e6) },
+    { UINT64_C(0x89b3b101c3677f74), UINT64_C(0xa563d83491b61011),
+      UINT64_C(0xe8ba8393eca7821a) },
+    { UINT64_C(0x7f5c132a6455bf06), UINT64_C(0xb6aa11e5419cd005),
+      UINT64_C(0xe7e367d2956cfb16) },
+    { UINT64_C(0x021074d7e702e77d), UINT64_C(0x2737662213429e14),
+      UINT64_C(0xe708ac84d4172a3e) },
+    { UINT64_C(0xe47aca550111df69), UINT64_C(0x70b15d41d4c0e483),
+      UINT64_C(0xe62a551594b970a7) },
+    { UINT64_C(0xbc7c0d5f61702451), UINT64_C(0xabf5bd0e5cf1b1a8),
+      UINT64_C(0xe54864fe33e8575c) },
+    { UINT64_C(0xa0547011202bf5ab), UINT64_C(0x3d1a15901228f146),
+      UINT64_C(0xe462dfc670d421ab) },
+    { UINT64_C(0x2b3d109e76c0dc30), UINT64_C(0xc4808aa497c2057b),
+      UINT64_C(0xe379c9045f29d517) },
+    { UINT64_C(0x66acd9eb4fc2808c), UINT64_C(0x225e232abc003c43),
+      UINT64_C(0xe28d245c58baef72) },
+    { UINT64_C(0xb2a1911c94e7b5f2), UINT64_C(0xa1422fa74807ecef),
+      UINT64_C(0xe19cf580eeec046a) },
+    { UINT64_C(0x56566b3a89f43eac), UINT64_C(0xbddd9da2fafad985),
+      UINT64_C(0xe0a94032dbea7ced) },
+    { UINT64_C(0xec583b8366cc2b55), UINT64_C(0x7ae2c515342890b5),
+      UINT64_C(0xdfb20840f3a9b36f) },
+    { UINT64_C(0x0bf8bb48f20ae8c3), UINT64_C(0xbbcc88c109cd41c5),
+      UINT64_C(0xdeb7518814a7a931) },
+    { UINT64_C(0x69c64a0094bcf0b9), UINT64_C(0xbd2452d0a3889f51),
+      UINT64_C(0xddb91ff318799172) },
+    { UINT64_C(0x939ecada62843b54), UINT64_C(0x68f31e3eb780ce9c),
+      UINT64_C(0xdcb7777ac4207051) },
+    { UINT64_C(0xc65335198b0ab629), UINT64_C(0xf6e7bc98ec991b70),
+      UINT64_C(0xdbb25c25b8260c14) },
+    { UINT64_C(0x2e1b17143e7244fd), UINT64_C(0xfde51c09e855e993),
+      UINT64_C(0xdaa9d20860827063) },
+    { UINT64_C(0xfd54d78e8c768454), UINT64_C(0xd4a3a3ed95204106),
+      UINT64_C(0xd99ddd44e44a43d4) },
+    { UINT64_C(0x75eb26f65d246c57), UINT64_C(0xd561efbc0c1a9a53),
+      UINT64_C(0xd88e820b1526311d) },
+    { UINT64_C(0xe3a04258814acb03), UINT64_C(0xc9d868b906bbc6bb),
+      UINT64_C(0xd77bc4985e93a607) },
+    { UINT64_C(0x9c1d7051faf31a9f), UINT64_C(0x6d51bad6d988a441),
+      UINT64_C(0xd665a937b4ef2b1f) },
+    { UINT64_C(0x5eba9fbfd7439dbb), UINT64_C(0x8f853f0655f1ba69),
+      UINT64_C(0xd54c3441844897fc) },
+    { UINT64_C(0xd86f8d34cb1d5fcd), UINT64_C(0xf031c2f63c8d9304),
+      UINT64_C(0xd42f6a1b9f0168cd) },
+    { UINT64_C(0x27846fef214b1d1a), UINT64_C(0x661c5fa8a7d9b266),
+      UINT64_C(0xd30f4f392c357ab0) },
+    { UINT64_C(0xd7eb44b8ad2232f7), UINT64_C(0x48a26bcd32d6e922),
+      UINT64_C(0xd1ebe81a95ee752e) },
+    { UINT64_C(0xde0af1ca344b13bd), UINT64_C(0x5e25736c03574707),
+      UINT64_C(0xd0c5394d77222819) },
+    { UINT64_C(0x7bcc1ed00179a257), UINT64_C(0xbfe750dd3f308eaf),
+      UINT64_C(0xcf9b476c897c25c5) },
+    { UINT64_C(0xefae248413efc0e6), UINT64_C(0x32225327ec440dda),
+      UINT64_C(0xce6e171f92f2e27f) },
+    { UINT64_C(0xfaccbc4eeba9604f), UINT64_C(0x59f993f4f5108819),
+      UINT64_C(0xcd3dad1b5328a2e4) },
+    { UINT64_C(0xbd7ea2b04e081bea), UINT64_C(0xff00911e11a07ee3),
+      UINT64_C(0xcc0a0e21709883a3) },
+    { UINT64_C(0xa773f87987a780b2), UINT64_C(0x204bbc0f3a66a0e6),
+      UINT64_C(0xcad33f00658fe5e8) },
+    { UINT64_C(0x981e414bdaf6aae1), UINT64_C(0x11ff93fe64b3ddb7),
+      UINT64_C(0xc99944936cf48c89) },
+    { UINT64_C(0x122876bfbf157de1), UINT64_C(0x14ef546c47929682),
+      UINT64_C(0xc85c23c26ed7b6f0) },
+    { UINT64_C(0x7d9adcb9dfb0a1d7), UINT64_C(0xe2da5615a03cca20),
+      UINT64_C(0xc71be181ecd6875c) },
+    { UINT64_C(0x4f82ed4cf93655d2), UINT64_C(0x7c07d28e981e3480),
+      UINT64_C(0xc5d882d2ee48030c) },
+    { UINT64_C(0x66371ac4c2052ca9), UINT64_C(0x1b38827db08884fc),
+      UINT64_C(0xc4920cc2ec38fb89) },
+    { UINT64_C(0x35b4e9c0c51b4c14), UINT64_C(0x8ffe2bfe9dd1381a),
+      UINT64_C(0xc348846bbd363133) },
+    { UINT64_C(0xfe814ec2343e53ae), UINT64_C(0x5a613ec8722f643f),
+      UINT64_C(0xc1fbeef380e4ffdd) },
+    { UINT64_C(0xebcb8bed4356fb50), UINT64_C(0xba37a3eeb90cb15a),
+      UINT64_C(0xc0ac518c8b6ae710) },
+    { UINT64_C(0xb4e483061877c028), UINT64_C(0x75969296567cf3e3),
+      UINT64_C(0xbf59b17550a44068) },
+    { UINT64_C(0xd75a5560243de8f2), UINT64_C(0x614946a88cbf4da1),
+      UINT64_C(0xbe0413f84f2a771c) },
+    { UINT64_C(0x8ab14808c64a4e73), UINT64_C(0xb122c574a376bec9),
+      UINT64_C(0xbcab7e6bfb2a14a9) },
+    { UINT64_C(0xe0bfb8f20e7e44e7), UINT64_C(0xc151839cb9d993b4),
+      UINT64_C(0xbb4ff632a908f73e) },
+    { UINT64_C(0x12230f14becacdd1), UINT64_C(0x628e135a95082990),
+      UINT64_C(0xb9f180ba77dd0751) },
+    { UINT64_C(0x053730bbdf940fa9), UINT64_C(0xb614a0539016bfa1),
+      UINT64_C(0xb890237d3bb3c284) },
+    { UINT64_C(0xf203f6b3f0224a4b), UINT64_C(0x50dbdb7a14c3d7d4),
+      UINT64_C(0xb72be40067aaf2c0) },
+    { UINT64_C(0x3e73b6e5e74fe752), UINT64_C(0xac786ccf4b1a498d),
+      UINT64_C(0xb5c4c7d4f7dae915) }
+  };
+
+/* the n most significant limbs of a table entry */
+#define FX_TOP(t,n) ((t) + 3 - (n))
+
+/* {r, n} = floor({a, n} * {b, n} / B^n), where r may be a or b */
+static void
+fx_mul (mp_limb_t *r, mpfr_limb_srcptr a, mpfr_limb_srcptr b, mp_size_t n)
+{
+  mp_limb_t t[6];
+
+  mpn_mul_n (t, a, b, n);
+  MPN_COPY (r, t + n, n);
+}
+
+/* Set {a, n} to c[0] - x*(c[1] - x*(... - x*c[m-1])) if sub is non-zero,
+   to c[0] + x*(c[1] + x*(... + x*c[m-1])) otherwise, where c[i] is the
+   table entry tab[i*stride]. The caller ensures that all the partial sums
+   are in [0,1). If x < 2^(-12), the error is less than 2 ulps: each new
+   partial sum has an error less than 1 ulp from c[i], less than 1 ulp
+   from the truncated product, plus the previous error multiplied by x. */
+static void
+fx_horner (mp_limb_t *a, mpfr_limb_srcptr x, const mp_limb_t (*tab)[3],
+           int stride, int m, int sub, mp_size_t n)
+{
+  mp_limb_t t[3];
+  int i;
+
+  MPN_COPY (a, FX_TOP (tab[(m - 1) * stride], n), n);
+  for (i = m - 2; i >= 0; i--)
+    {
+      fx_mul (t, x, a, n);
+      if (sub)
+        mpn_sub_n (a, FX_TOP (tab[i * stride], n), t, n);
+      else
+        mpn_add_n (a, FX_TOP (tab[i * stride], n), t, n);
+    }
+}
+
+/* Set {X, n+1} to floor(|x| * B^n), assuming |x| < B. */
+static void
+fx_set (mp_limb_t *X, mpfr_srcptr x, mp_size_t n)
+{
+  mpfr_limb_srcptr xp = MPFR_MANT (x);
+  mp_size_t xn = MPFR_LIMB_SIZE (x), k, i;
+  mpfr_exp_t s;
+  mp_limb_t t[4];
+
+  MPFR_ASSERTD (MPFR_GET_EXP (x) <= GMP_NUMB_BITS);
+  /* |x| * B^n = ({xp, xn} / B^xn) * B^(n+1) / 2^s, with s >= 0 */
+  s = GMP_NUMB_BITS - MPFR_GET_EXP (x);
+  k = s / GMP_NUMB_BITS;
+  MPN_ZERO (X, n + 1);
+  if (k > n)
+    return;
+  /* {t, n+1-k} = floor({xp, xn} / B^(xn-n-1+k)) */
+  for (i = 0; i < n + 1 - k; i++)
+    t[i] = xn - (n + 1 - k) + i >= 0 ? xp[xn - (n + 1 - k) + i] : 0;
+  if (s % GMP_NUMB_BITS != 0)
+    mpn_rshift (X, t, n + 1 - k, s % GMP_NUMB_BITS);
+  else
+    MPN_COPY (X, t, n + 1 - k);
+}
+
+/* An approximation of |x| for the argument reduction, from {X, n+1}. */
+#define FX_GET_D(X,n) ((double) (X)[n] + (double) ((X)[(n) - 1] >> 32) \
+                       / 4294967296.0)
+
+/* Round the normalized approximation {v, n} of a non-zero real number of
+   sign neg (0 for positive, 1 for negative) times 2^e, whose error is less
+   than 2^(-err) relative to v, to the precision of y. Return 0 if the
+   rounding cannot be decided, or if e is not in the current exponent range
+   (so that the general code handles the underflow), otherwise return the
+   ternary value. */
+static int
+fx_round (mpfr_ptr y, mp_limb_t *v, mp_size_t n, mpfr_exp_t err,
+          mpfr_exp_t e, int neg, mpfr_rnd_t rnd_mode)
+{
+  mpfr_prec_t p = MPFR_PREC (y);
+  int inex;
+
+  MPFR_ASSERTD (v[n - 1] & MPFR_LIMB_HIGHBIT);
+  /* round toward zero for MPFR_RNDF, so that the ternary value is
+     non-zero: a zero return value would mean failure, while y has been
+     modified (it may be the input) */
+  if (rnd_mode == MPFR_RNDF)
+    rnd_mode = MPFR_RNDZ;
+  if (MPFR_UNLIKELY (e < __gmpfr_emin || e > __gmpfr_emax ||
+                     ! mpfr_round_p (v, n, err, p + (rnd_mode == MPFR_RNDN))))
+    return 0;
+  if (MPFR_UNLIKELY (mpfr_round_raw (MPFR_MANT (y), v, n * GMP_NUMB_BITS,
+                                     neg, p, rnd_mode, &inex)))
+    {
+      e++;
+      MPFR_MANT (y)[MPFR_LIMB_SIZE (y) - 1] = MPFR_LIMB_HIGHBIT;
+    }
+  if (neg)
+    MPFR_SET_NEG (y);
+  else
+    MPFR_SET_POS (y);
+  MPFR_EXP (y) = e;
+  MPFR_ASSERTD (inex != 0);
+  return mpfr_check_range (y, inex, rnd_mode);
+}
+
+/* Assuming x is regular and PREC(y) <= 2*GMP_NUMB_BITS, compute exp(x).
+
+   We write |x| = k*log(2) + r with 0 <= r < log(2) if x > 0, and
+   |x| = k*log(2) - r if x < 0, so that exp(x) = 2^(+/-k) * exp(r). With
+   r = j1/64 + j2/4096 + s, 0 <= s < 2^(-12), exp(r)/2 is the product of
+   exp(j1/64)/2, 1 + (exp(j2/4096)-1) and 1 + (exp(s)-1), where exp(s)-1
+   is computed as s + s*(s*(1/2! + s*(1/3! + ... + s/N!))), the remainder
+   of the series being less than 2 s^(N+1)/(N+1)! < 2^(-64n-2).
+
+   Error analysis, in ulps: the truncation of |x| and the truncation of
+   k*log(2) (computed with 256 bits of log(2) and k < 2^48) each give an
+   error less than 1 ulp, thus the error on r, which gives a relative error
+   on exp(r), is less than 2 ulps. The Horner scheme has an error less than
+   2 ulps, thus exp(s)-1 has an error less than 1.1 ulps (including the
+   remainder of the series). Then h = exp(j1/64)/2 * exp(j2/4096) has an
+   error less than 3.1 ulps (1 for each table entry and 1 for the product),
+   and v = h + h*(exp(s)-1) an error less than 3.1*1.02 + 1 + 1.1 < 5.3
+   ulps. With the error on r, the error on v is less than 8 ulps, and v is
+   in [1/2,1), thus we can use err = 64n - 3. */
+int
+mpfr_exp_fixed (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
+{
+  mp_limb_t X[4], r[4], t[5], h[3], v[3];
+  mp_size_t n = MPFR_PREC (y) <= GMP_NUMB_BITS ? 2 : 3;
+  mp_limb_t k;
+  mpfr_exp_t e;
+  int neg = MPFR_IS_NEG (x), j1, j2;
+
+  MPFR_ASSERTD (MPFR_IS_PURE_FP (x));
+  MPFR_ASSERTD (MPFR_PREC (y) <= 2 * GMP_NUMB_BITS);
+
+  if (MPFR_GET_EXP (x) > 32)
+    return 0;
+
+  fx_set (X, x, n);
+  k = (mp_limb_t) (FX_GET_D (X, n) * 1.4426950408889634) + neg;
+  for (;;)
+    {
+      /* {t + 4 - n, n+1} = floor(k * log(2) * B^n) */
+      t[4] = mpn_mul_1 (t, log2_tab, 4, k);
+      if (neg ? mpn_sub_n (r, t + 4 - n, X, n + 1)
+              : mpn_sub_n (r, X, t + 4 - n, n + 1))
+        k += neg ? 1 : -1;  /* r < 0 */
+      else if (r[n] != 0 || mpn_cmp (r, log2_tab + 4 - n, n) > 0)
+        k += neg ? -1 : 1;  /* r > log(2) */
+      else
+        break;
+    }
+  e = neg ? 1 - (mpfr_exp_t) k : 1 + (mpfr_exp_t) k;
+
+  j1 = r[n - 1] >> (GMP_NUMB_BITS - 6);
+  j2 = (r[n - 1] >> (GMP_NUMB_BITS - 12)) & 63;
+  MPFR_ASSERTD (j1 <= 44);
+  r[n - 1] &= MPFR_LIMB_MASK (GMP_NUMB_BITS - 12);  /* s */
+
+  fx_mul (h, FX_TOP (exp1_tab[j1], n), FX_TOP (exp2_tab[j2], n), n);
+  mpn_add_n (h, h, FX_TOP (exp1_tab[j1], n), n);
+
+  /* v = exp(s) - 1 */
+  fx_horner (v, r, invfact_tab, 1, n == 2 ? 8 : 12, 0, n);
+  fx_mul (v, v, r, n);
+  fx_mul (v, v, r, n);
+  mpn_add_n (v, v, r, n);
+
+  fx_mul (v, v, h, n);
+  if (MPFR_UNLIKELY (mpn_add_n (v, v, h, n) != 0))
+    return 0;  /* exp(r) is very close to 2 */
+
+  return fx_round (y, v, n, n * GMP_NUMB_BITS - 3, e, 0, rnd_mode);
+}
+
+/* Compute log(1+t) for |t| < 2^(-13), where t = +/-{w, n} is exact, the
+   sign being negative if neg is non-zero, and 1+t = x.
+
+   We write log(1+t) = t - t^2*R with R = 1/2 - t/3 + t^2/4 - ..., and
+   compute |t| * (1 -/+ |t|*R) with relative error: with |t| < 2^(-sigma)
+   and the series truncated at the term in t^(N-2)/N, the remainder gives
+   a relative error less than 2^(1-sigma*N)/(N+1) < 2^(-64n-2) since
+   sigma*N >= 64n+3. The Horner scheme gives an error less than 2 ulps on
+   R, thus t*R has an error less than 1.01 ulps, and 1 -/+ t*R an error less
+   than 2 ulps (for t > 0, we use the one's complement). With the truncated
+   product by the normalized |t| and at most 1 bit of normalization, the
+   error is less than 6 ulps (< 2^(3-64n) relative to the result). */
+static int
+fx_log_near1 (mpfr_ptr y, mp_limb_t *w, int neg, mp_size_t n,
+              mpfr_rnd_t rnd_mode)
+{
+  mp_limb_t tn[3], a[3];
+  mpfr_exp_t sigma;
+  int cnt, N, i;
+
+  /* normalize |t| = tn * 2^(-sigma), with 1/2 <= tn < 1 */
+  i = n - 1;
+  while (w[i] == 0)
+    i--;
+  count_leading_zeros (cnt, w[i]);
+  sigma = (mpfr_exp_t) (n - 1 - i) * GMP_NUMB_BITS + cnt;
+  MPFR_ASSERTD (sigma >= 13);
+  MPN_ZERO (tn, n - 1 - i);
+  if (cnt != 0)
+    mpn_lshift (tn + n - 1 - i, w, i + 1, cnt);
+  else
+    MPN_COPY (tn + n - 1 - i, w, i + 1);
+
+  N = (n * GMP_NUMB_BITS + 3 + sigma - 1) / sigma;
+  N = MAX (N, 2);
+  fx_horner (a, w, inv_tab, 1, N - 1, ! neg, n);
+  fx_mul (a, a, w, n);
+  if (neg)
+    {
+      /* log(1-|t|) = -|t| * (1 + |t|*R), with (1 + |t|*R)/2 in [1/2,1) */
+      mpn_rshift (a, a, n, 1);
+      a[n - 1] |= MPFR_LIMB_HIGHBIT;
+      sigma--;
+    }
+  else
+    mpn_com (a, a, n);  /* 1 - |t|*R - u */
+  fx_mul (a, a, tn, n);
+  if (! (a[n - 1] & MPFR_LIMB_HIGHBIT))
+    {
+      mpn_lshift (a, a, n, 1);
+      sigma++;
+    }
+  return fx_round (y, a, n, n * GMP_NUMB_BITS - 3, - sigma, neg, rnd_mode);
+}
+
+/* Assuming x > 0, x <> 1 and PREC(y) <= 2*GMP_NUMB_BITS, compute log(x).
+
+   Write x = m * 2^e with 1/2 <= m < 1. If x is close to 1 (|x-1| < 2^(-13)
+   roughly), log(x) is computed by fx_log_near1 with a relative error bound.
+   Otherwise |log(x)| > 2^(-14), and we compute log(x) = e*log(2) + log(m)
+   with an absolute error bound, where log(m) = log(1+t) - log(c1/2^8)
+   - log(c2/2^26) with 1+t = m * c1/2^8 * c2/2^26 computed exactly, the
+   integer c1 being given by the 8 most significant bits of m, and c2 by
+   the next bits of the product, so that 0 <= t < 2^(-13) + 2^(-20).
+
+   Error analysis, in ulps: the truncation of m to n limbs (if x has more
+   than n limbs) gives an error less than 2 ulps on log(m), and t an error
+   less than 1 ulp. As in fx_log_near1, log(1+t) = t - t*(t*R) has an
+   error less than 1 + 1.1 ulps (the remainder of the series truncated at
+   the term t^N/N is less than 2^(-64n-2)). The table entries have an error
+   less than 1 ulp each, and the truncation of |e|*log(2), computed with
+   256 bits of log(2), less than 1.25 ulps. Thus the error on the sum R is
+   less than 8 ulps, i.e. 2^(3-64n). After normalization, which truncates
+   the result if |R| >= 1, the error is less than 2^(max(3,EXP(R))+1-64n). */
+int
+mpfr_log_fixed (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
+{
+  mpfr_limb_srcptr xp = MPFR_MANT (x);
+  mp_size_t xn = MPFR_LIMB_SIZE (x), n = MPFR_PREC (y) <= GMP_NUMB_BITS ? 2 : 3;
+  mpfr_exp_t e = MPFR_GET_EXP (x), ex;
+  mp_limb_t m[3], a[4], w[3], z[5], R[4], c2, *v;
+  int i, j, cnt;
+
+  MPFR_ASSERTD (MPFR_IS_PURE_FP (x) && MPFR_IS_POS (x));
+  MPFR_ASSERTD (MPFR_PREC (y) <= 2 * GMP_NUMB_BITS);
+
+  if (xn >= n)
+    MPN_COPY (m, xp + xn - n, n);
+  else
+    {
+      MPN_ZERO (m, n - xn);
+      MPN_COPY (m + n - xn, xp, xn);
+    }
+
+  if (e == 1 && m[n - 1] < MPFR_LIMB_HIGHBIT + (MPFR_LIMB_ONE << 50))
+    {
+      /* 1 < x < 1 + 2^(-13): t = 2m - 1 */
+      if (xn > n)
+        return 0;
+      mpn_lshift (w, m, n, 1);  /* the bit shifted out is the 1 */
+      return fx_log_near1 (y, w, 0, n, rnd_mode);
+    }
+  if (e == 0 && m[n - 1] >= - (MPFR_LIMB_ONE << 50))
+    {
+      /* 1 - 2^(-14) <= x < 1: t = m - 1 */
+      if (xn > n)
+        return 0;
+      mpn_neg (w, m, n);
+      return fx_log_near1 (y, w, 1, n, rnd_mode);
+    }
+
+  /* {a, n+1} = m * c1 * B^n, with a[n] in [2^8, 2^8 + 3) */
+  i = (m[n - 1] >> (GMP_NUMB_BITS - 8)) - 128;
+  a[n] = mpn_mul_1 (a, m, n, logc_tab[i]);
+  j = ((a[n] - 256) << 5) | (a[n - 1] >> (GMP_NUMB_BITS - 5));
+  MPFR_ASSERTD (a[n] >= 256 && j < 80);
+  /* {a, n+1} = m * c1 * c2 * B^n, then t */
+  c2 = (MPFR_LIMB_ONE << 26) - ((mp_limb_t) j << 13) + (mp_limb_t) j * j;
+  mpn_mul_1 (a, a, n + 1, c2);
+  MPFR_ASSERTD (a[n] >= MPFR_LIMB_ONE << 34);
+  a[n] -= MPFR_LIMB_ONE << 34;
+  mpn_rshift (a, a, n + 1, 34);
+  MPFR_ASSERTD (a[n] == 0 && a[n - 1] < MPFR_LIMB_ONE << 52);
+
+  /* w = log(1+t) */
+  fx_horner (w, a, inv_tab, 1, n == 2 ? 8 : 13, 1, n);
+  fx_mul (w, w, a, n);
+  fx_mul (w, w, a, n);
+  mpn_sub_n (w, a, w, n);
+
+  /* {R, n+1} = |e| * log(2) +/- (log(c1/2^8) + log(c2/2^26) - log(1+t)),
+     computed modulo B^(n+1) */
+  z[4] = mpn_mul_1 (z, log2_tab, 4, e >= 1 ? (mp_limb_t) e
+                    : - (mp_limb_t) e);
+  if (e >= 1)
+    {
+      mpn_sub (R, z + 4 - n, n + 1, FX_TOP (log1_tab[i], n), n);
+      mpn_add (R, R, n + 1, FX_TOP (log2j_tab[j], n), n);
+      mpn_add (R, R, n + 1, w, n);
+    }
+  else
+    {
+      mpn_add (R, z + 4 - n, n + 1, FX_TOP (log1_tab[i], n), n);
+      mpn_sub (R, R, n + 1, FX_TOP (log2j_tab[j], n), n);
+      mpn_sub (R, R, n + 1, w, n);
+    }
+
+  /* normalize */
+  if (R[n] != 0)
+    {
+      count_leading_zeros (cnt, R[n]);
+      if (cnt != 0)
+        mpn_lshift (R, R, n + 1, cnt);
+      v = R + 1;
+      ex = GMP_NUMB_BITS - cnt;
+    }
+  else
+    {
+      if (MPFR_UNLIKELY (R[n - 1] == 0))
+        return 0;
+      count_leading_zeros (cnt, R[n - 1]);
+      if (cnt != 0)
+        mpn_lshift (R, R, n, cnt);
+      v = R;
+      ex = - cnt;
+    }
+  return fx_round (y, v, n, n * GMP_NUMB_BITS - 1 - MAX (3 - ex, 0), ex,
+                   e <= 0, rnd_mode);
+}
+
+/* Assuming x is regular and PREC(y) <= 2*GMP_NUMB_BITS, compute sin(x) if
+   cos_p is zero, cos(x) otherwise.
+
+   We write |x| = q*Pi/2 + r0 with 0 <= r0 < Pi/2, then r = r0 if r0 <= Pi/4,
+   r = Pi/2 - r0 otherwise (which exchanges sin and cos), so that the result
+   is +/- sin(r) or +/- cos(r). With r = j/128 + b, 0 <= b < 2^(-7), and
+   cos(b) = 1 - dc, sin(b) = b - b*ds:
+     sin(r) = sin(j/128) - sin(j/128)*dc + cos(j/128)*sin(b),
+     cos(r) = cos(j/128) - cos(j/128)*dc - sin(j/128)*sin(b),
+   where dc = b^2*(1/2! - b^2*(1/4! - ...)) and ds = b^2*(1/3! - ...) are
+   evaluated with the Horner scheme in b^2 < 2^(-14); with the series
+   truncated at the terms b^(2K)/(2K)! and b^(2K+1)/(2K+1)!, K = 6 for
+   n = 2 and K = 9 for n = 3, the remainders are less than 2^(-64n-2).
+
+   Error analysis, in ulps: the error on r is less than 3 ulps (1 for the
+   truncation of |x|, 1 for q*Pi/2, computed with 256 bits of Pi/4, and 1
+   for Pi/2 - r0). The error on b^2 is less than 1 ulp, thus those on dc and
+   ds are less than 2.1 ulps, that on sin(b) less than 1.1 ulps, and that
+   on sin(r) or cos(r) less than 1 + 2.6 + 3.1 < 7 ulps, thus 10 ulps with
+   the error on r. Since the result v is less than 1, the error is less than
+   2^(4-64n), i.e. 2^(EXP(v)+64n-4) relative to v. */
+static int
+fx_sin_cos (mpfr_ptr y, mpfr_srcptr x, int cos_p, mpfr_rnd_t rnd_mode)
+{
+  mp_limb_t X[4], r[4], t[5], pio2[5], b2[3], dc[3], ds[3], v[3];
+  mpfr_limb_srcptr sa, ca;
+  mp_size_t n = MPFR_PREC (y) <= GMP_NUMB_BITS ? 2 : 3;
+  mp_limb_t q;
+  mpfr_exp_t ex;
+  int j, K, neg, use_cos, i, k, cnt;
+
+  MPFR_ASSERTD (MPFR_IS_PURE_FP (x));
+  MPFR_ASSERTD (MPFR_PREC (y) <= 2 * GMP_NUMB_BITS);
+
+  if (MPFR_GET_EXP (x) > 32)
+    return 0;
+
+  fx_set (X, x, n);
+  /* {pio2 + 4 - n, n+1} = floor(Pi/2 * B^n) */
+  pio2[4] = mpn_lshift (pio2, pio4_tab, 4, 1);
+  q = (mp_limb_t) (FX_GET_D (X, n) * 0.63661977236758134);
+  for (;;)
+    {
+      t[4] = mpn_mul_1 (t, pio4_tab, 4, 2 * q);
+      if (mpn_sub_n (r, X, t + 4 - n, n + 1))
+        q--;
+      else if (mpn_cmp (r, pio2 + 4 - n, n + 1) > 0)
+        q++;
+      else
+        break;
+    }
+
+  /* sin(x) = sin(r0), cos(r0), -sin(r0), -cos(r0) for q = 0, 1, 2, 3 mod 4,
+     and cos(x) = cos(r0), -sin(r0), -cos(r0), sin(r0) */
+  use_cos = (q & 1) ^ cos_p;
+  neg = cos_p ? ((q + 1) & 2) != 0 : (q & 2) != 0;
+  if (! cos_p && MPFR_IS_NEG (x))
+    neg = ! neg;
+  if (r[n] != 0 || mpn_cmp (r, pio4_tab + 4 - n, n) > 0)
+    {
+      mpn_sub_n (r, pio2 + 4 - n, r, n + 1);
+      use_cos = ! use_cos;
+    }
+  MPFR_ASSERTD (r[n] == 0);
+
+  j = r[n - 1] >> (GMP_NUMB_BITS - 7);
+  MPFR_ASSERTD (j <= 100);
+  r[n - 1] &= MPFR_LIMB_MASK (GMP_NUMB_BITS - 7);  /* b */
+  sa = FX_TOP (sin_tab[j], n);
+  ca = FX_TOP (cos_tab[j], n);
+
+  K = n == 2 ? 6 : 9;
+  fx_mul (b2, r, r, n);
+  fx_horner (dc, b2, invfact_tab, 2, K, 1, n);
+  fx_mul (dc, dc, b2, n);
+  fx_horner (ds, b2, invfact_tab + 1, 2, K, 1, n);
+  fx_mul (ds, ds, b2, n);
+  fx_mul (ds, ds, r, n);
+  mpn_sub_n (r, r, ds, n);  /* sin(b) */
+
+  if (use_cos)
+    {
+      fx_mul (v, ca, dc, n);
+      mpn_sub_n (v, ca, v, n);
+      fx_mul (ds, sa, r, n);
+      mpn_sub_n (v, v, ds, n);
+    }
+  else
+    {
+      fx_mul (v, sa, dc, n);
+      mpn_sub_n (v, sa, v, n);
+      fx_mul (ds, ca, r, n);
+      mpn_add_n (v, v, ds, n);
+    }
+
+  /* normalize */
+  for (i = n - 1; i >= 0 && v[i] == 0; i--);
+  if (MPFR_UNLIKELY (i < 0))
+    return 0;
+  count_leading_zeros (cnt, v[i]);
+  ex = - (mpfr_exp_t) (n - 1 - i) * GMP_NUMB_BITS - cnt;
+  if (cnt != 0)
+    mpn_lshift (v + n - 1 - i, v, i + 1, cnt);
+  else
+    for (k = i; k >= 0; k--)
+      v[k + n - 1 - i] = v[k];
+  MPN_ZERO (v, n - 1 - i);
+  return fx_round (y, v, n, n * GMP_NUMB_BITS - 4 + ex, ex, neg, rnd_mode);
+}
+
+int
+mpfr_sin_fixed (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
+{
+  return fx_sin_cos (y, x, 0, rnd_mode);
+}
+
+int
+mpfr_cos_fixed (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
+{
+  return fx_sin_cos (y, x, 1, rnd_mode);
+}
+
+#endif /* !defined(MPFR_GENERIC_ABI) && GMP_NUMB_BITS == 64 */
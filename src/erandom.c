@@ -77,17 +77,16 @@ E (mpfr_random_deviate_t x, gmp_randstate_t r,
     }
 }
 
-/* return an exponential random deviate with mean 1 as a MPFR  */
-int
-mpfr_erandom (mpfr_ptr z, gmp_randstate_t r, mpfr_rnd_t rnd)
+/* return an exponential random deviate with mean 1 as a MPFR, with the
+   deviate x and the temporaries p and q allocated by the caller */
+static int
+erandom (mpfr_ptr z, gmp_randstate_t r, mpfr_rnd_t rnd,
+         mpfr_random_deviate_t x,
+         mpfr_random_deviate_t p, mpfr_random_deviate_t q)
 {
-  mpfr_random_deviate_t x, p, q;
-  int inex;
   unsigned long k = 0;
 
-  mpfr_random_deviate_init (x);
-  mpfr_random_deviate_init (p);
-  mpfr_random_deviate_init (q);
+  mpfr_random_deviate_reset (x);
   while (!E(x, r, p, q))
     {
       ++k;
@@ -96,9 +95,50 @@ mpfr_erandom (mpfr_ptr z, gmp_randstate_t r, mpfr_rnd_t rnd)
       MPFR_ASSERTN (k != 0UL);
       mpfr_random_deviate_reset (x);
     }
+  return mpfr_random_deviate_value (0, k, x, z, r, rnd);
+}
+
+/* return an exponential random deviate with mean 1 as a MPFR  */
+int
+mpfr_erandom (mpfr_ptr z, gmp_randstate_t r, mpfr_rnd_t rnd)
+{
+  mpfr_random_deviate_t x, p, q;
+  int inex;
+
+  mpfr_random_deviate_init (x);
+  mpfr_random_deviate_init (p);
+  mpfr_random_deviate_init (q);
+  inex = erandom (z, r, rnd, x, p, q);
   mpfr_random_deviate_clear (q);
   mpfr_random_deviate_clear (p);
-  inex = mpfr_random_deviate_value (0, k, x, z, r, rnd);
   mpfr_random_deviate_clear (x);
   return inex;
 }
+
+/* Set z[0], ..., z[n-1] to exponential random deviates; the results are
+   the same as with n successive calls to mpfr_erandom. If inex is not a
+   null pointer, the ternary values are stored in inex[0], ..., inex[n-1].
+   Return 0 iff all the results are exact. */
+int
+mpfr_erandom_vec (const mpfr_ptr *z, int *inex, unsigned long n,
+                  gmp_randstate_t r, mpfr_rnd_t rnd)
+{
+  mpfr_random_deviate_t x, p, q;
+  unsigned long i;
+  int ret = 0;
+
+  mpfr_random_deviate_init (x);
+  mpfr_random_deviate_init (p);
+  mpfr_random_deviate_init (q);
+  for (i = 0; i < n; i++)
+    {
+      int t = erandom (z[i], r, rnd, x, p, q);
+      if (inex != NULL)
+        inex[i] = t;
+      ret |= t;
+    }
+  mpfr_random_deviate_clear (q);
+  mpfr_random_deviate_clear (p);
+  mpfr_random_deviate_clear (x);
+  return ret;
+}
@@ -0,0 +1,156 @@
+/* mpfr_exp_recip -- exponential of x and of -x
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#define MPFR_NEED_LONGLONG_H
+#include "mpfr-impl.h"
+
+/* Compute e^x and e^(-x) with two separate calls to mpfr_exp. This is
+   used for tiny inputs (for which mpfr_exp has a fast path) and when
+   e^x overflows or underflows in the extended exponent range. */
+static int
+mpfr_exp_recip_separate (mpfr_ptr ep, mpfr_ptr em, mpfr_srcptr x,
+                         mpfr_rnd_t rnd_mode)
+{
+  mpfr_t nx;
+  int inex_p, inex_m;
+
+  /* x may be ep or em, thus negate it first */
+  mpfr_init2 (nx, MPFR_PREC (x));
+  mpfr_neg (nx, x, MPFR_RNDN);
+  inex_p = mpfr_exp (ep, x, rnd_mode);
+  inex_m = mpfr_exp (em, nx, rnd_mode);
+  mpfr_clear (nx);
+  return INEX (inex_p, inex_m);
+}
+
+/* The computations are done by
+     t = o(e^x), u = o(1/t),
+   with rounding to nearest and N bits of precision. Then t has an error
+   of at most 1/2 ulp, and since t = e^x (1 + theta) with |theta| <= 2^(-N),
+   u = e^(-x) (1 + theta') with |theta'| <= 2^(1-N) + 2^(-2N), i.e., the
+   error on u is at most 3 ulps. */
+
+int
+mpfr_exp_recip (mpfr_ptr ep, mpfr_ptr em, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
+{
+  mpfr_t t, u;
+  mpfr_prec_t N;
+  mpfr_exp_t ex;
+  int inex_p, inex_m, separate = 0;
+  MPFR_ZIV_DECL (loop);
+  MPFR_SAVE_EXPO_DECL (expo);
+  MPFR_GROUP_DECL (group);
+  MPFR_PERF_FUNC (MAX (MPFR_PREC (ep), MPFR_PREC (em)));
+
+  MPFR_ASSERTN (ep != em);
+
+  MPFR_LOG_FUNC
+    (("x[%Pd]=%.*Rg rnd=%d", mpfr_get_prec (x), mpfr_log_prec, x, rnd_mode),
+     ("ep[%Pd]=%.*Rg em[%Pd]=%.*Rg",
+      mpfr_get_prec (ep), mpfr_log_prec, ep,
+      mpfr_get_prec (em), mpfr_log_prec, em));
+
+  if (MPFR_UNLIKELY (MPFR_IS_SINGULAR (x)))
+    {
+      if (MPFR_IS_NAN (x))
+        {
+          MPFR_SET_NAN (ep);
+          MPFR_SET_NAN (em);
+          MPFR_RET_NAN;
+        }
+      else if (MPFR_IS_INF (x))
+        {
+          /* e^(+Inf) = +Inf, e^(-Inf) = +0 */
+          if (MPFR_IS_POS (x))
+            {
+              MPFR_SET_INF (ep);
+              MPFR_SET_ZERO (em);
+            }
+          else
+            {
+              MPFR_SET_ZERO (ep);
+              MPFR_SET_INF (em);
+            }
+          MPFR_SET_POS (ep);
+          MPFR_SET_POS (em);
+          MPFR_RET (0);
+        }
+      else /* x is zero */
+        {
+          MPFR_ASSERTD (MPFR_IS_ZERO (x));
+          inex_p = mpfr_set_ui (ep, 1, rnd_mode);
+          inex_m = mpfr_set_ui (em, 1, rnd_mode);
+          return INEX (inex_p, inex_m);
+        }
+    }
+
+  N = MAX (MPFR_PREC (ep), MPFR_PREC (em));
+  ex = MPFR_GET_EXP (x);
+
+  /* If |x| < 2^(-N), e^x and e^(-x) are 1 + x + O(x^2) and mpfr_exp
+     handles this case without an actual evaluation. */
+  if (ex < - (mpfr_exp_t) N)
+    return mpfr_exp_recip_separate (ep, em, x, rnd_mode);
+
+  MPFR_SAVE_EXPO_MARK (expo);
+
+  /* for |x| < 1, e^x = 1 + x + ..., and we need -EXP(x) more bits
+     to round correctly both 1 + x and 1 - x */
+  N = N + MPFR_INT_CEIL_LOG2 (N) + 4 + (ex < 0 ? - ex : 0);
+  MPFR_GROUP_INIT_2 (group, N, t, u);
+
+  MPFR_ZIV_INIT (loop, N);
+  for (;;)
+    {
+      MPFR_BLOCK_DECL (flags);
+
+      MPFR_BLOCK (flags, mpfr_exp (t, x, MPFR_RNDN));
+      if (MPFR_OVERFLOW (flags) || MPFR_UNDERFLOW (flags))
+        {
+          separate = 1;
+          break;
+        }
+      mpfr_ui_div (u, 1, t, MPFR_RNDN);
+
+      /* Both t and u are computed before ep and em are modified,
+         since x may be one of them. */
+      if (MPFR_LIKELY (MPFR_CAN_ROUND (t, N, MPFR_PREC (ep), rnd_mode) &&
+                       MPFR_CAN_ROUND (u, N - 2, MPFR_PREC (em), rnd_mode)))
+        {
+          inex_p = mpfr_set (ep, t, rnd_mode);
+          inex_m = mpfr_set (em, u, rnd_mode);
+          break;
+        }
+      MPFR_ZIV_NEXT (loop, N);
+      MPFR_GROUP_REPREC_2 (group, N, t, u);
+    }
+  MPFR_ZIV_FREE (loop);
+
+  MPFR_GROUP_CLEAR (group);
+  MPFR_SAVE_EXPO_FREE (expo);
+
+  if (separate)
+    return mpfr_exp_recip_separate (ep, em, x, rnd_mode);
+
+  inex_p = mpfr_check_range (ep, inex_p, rnd_mode);
+  inex_m = mpfr_check_range (em, inex_m, rnd_mode);
+  return INEX (inex_p, inex_m);
+}
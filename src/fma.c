@@ -101,6 +101,61 @@ mpfr_fma_singular (mpfr_ptr s, mpfr_srcptr x, mpfr_srcptr y, mpfr_srcptr z,
     }
 }
 
+#if !defined(MPFR_GENERIC_ABI)
+
+#include "fma_frame.h"
+
+/* Special code for PREC(s) = PREC(x) = PREC(y) = PREC(z) = p with
+   (n-1)*GMP_NUMB_BITS < p <= n*GMP_NUMB_BITS, n = 1, 2 or 3, and regular
+   inputs with EXP(x) + EXP(y) in the current exponent range; e = 1 if
+   p = n*GMP_NUMB_BITS, otherwise e = 0 (see fma_frame.h).
+   The inputs are read before s is modified, since s may share its
+   significand with z (see the warning above). */
+static MPFR_FRAME_INLINE int
+mpfr_fma_n (mpfr_ptr s, mpfr_srcptr x, mpfr_srcptr y, mpfr_srcptr z,
+            mpfr_rnd_t rnd_mode, mpfr_prec_t p, int n, int e)
+{
+  mp_limb_t u[MPFR_FRAME_MAX], v[MPFR_FRAME_MAX];
+  mpfr_exp_t eu;
+
+  eu = MPFR_GET_EXP (x) + MPFR_GET_EXP (y)
+    - mpfr_frame_mul (u, MPFR_MANT (x), MPFR_MANT (y), n, e);
+  mpfr_frame_set (v, MPFR_MANT (z), n, e);
+  return mpfr_frame_add (s, u, eu, MPFR_MULT_SIGN (MPFR_SIGN (x),
+                                                   MPFR_SIGN (y)),
+                         v, MPFR_GET_EXP (z), MPFR_SIGN (z), rnd_mode,
+                         p, n, e);
+}
+
+static int
+mpfr_fma_1 (mpfr_ptr s, mpfr_srcptr x, mpfr_srcptr y, mpfr_srcptr z,
+            mpfr_rnd_t rnd_mode, mpfr_prec_t p)
+{
+  return p == GMP_NUMB_BITS ?
+    mpfr_fma_n (s, x, y, z, rnd_mode, p, 1, 1) :
+    mpfr_fma_n (s, x, y, z, rnd_mode, p, 1, 0);
+}
+
+static int
+mpfr_fma_2 (mpfr_ptr s, mpfr_srcptr x, mpfr_srcptr y, mpfr_srcptr z,
+            mpfr_rnd_t rnd_mode, mpfr_prec_t p)
+{
+  return p == 2 * GMP_NUMB_BITS ?
+    mpfr_fma_n (s, x, y, z, rnd_mode, p, 2, 1) :
+    mpfr_fma_n (s, x, y, z, rnd_mode, p, 2, 0);
+}
+
+static int
+mpfr_fma_3 (mpfr_ptr s, mpfr_srcptr x, mpfr_srcptr y, mpfr_srcptr z,
+            mpfr_rnd_t rnd_mode, mpfr_prec_t p)
+{
+  return p == 3 * GMP_NUMB_BITS ?
+    mpfr_fma_n (s, x, y, z, rnd_mode, p, 3, 1) :
+    mpfr_fma_n (s, x, y, z, rnd_mode, p, 3, 0);
+}
+
+#endif /* !defined(MPFR_GENERIC_ABI) */
+
 /* s <- x*y + z */
 int
 mpfr_fma (mpfr_ptr s, mpfr_srcptr x, mpfr_srcptr y, mpfr_srcptr z,
@@ -139,55 +194,19 @@ mpfr_fma (mpfr_ptr s, mpfr_srcptr x, mpfr_srcptr y, mpfr_srcptr z,
      |EXP(x)+EXP(y)| < 2^(k-1), thus cannot overflow nor underflow. */
   if (precx == precy && e <= __gmpfr_emax && e > __gmpfr_emin)
     {
-      if (precx < GMP_NUMB_BITS &&
-          MPFR_PREC(z) == precx &&
-          MPFR_PREC(s) == precx)
+#if !defined(MPFR_GENERIC_ABI)
+      if (MPFR_PREC(z) == precx && MPFR_PREC(s) == precx &&
+          precx <= 3 * GMP_NUMB_BITS)
         {
-          mp_limb_t umant[2], zmant[2];
-          mpfr_t zz;
-          int inex;
-
-          umul_ppmm (umant[1], umant[0], MPFR_MANT(x)[0], MPFR_MANT(y)[0]);
-          MPFR_PREC(u) = MPFR_PREC(zz) = 2 * precx;
-          MPFR_MANT(u) = umant;
-          MPFR_MANT(zz) = zmant;
-          MPFR_SIGN(u) = MPFR_MULT_SIGN(MPFR_SIGN(x), MPFR_SIGN(y));
-          MPFR_SIGN(zz) = MPFR_SIGN(z);
-          MPFR_EXP(zz) = MPFR_EXP(z);
-          if (MPFR_PREC(zz) <= GMP_NUMB_BITS) /* zz fits in one limb */
-            {
-              if ((umant[1] & MPFR_LIMB_HIGHBIT) == 0)
-                {
-                  umant[0] = umant[1] << 1;
-                  MPFR_EXP(u) = e - 1;
-                }
-              else
-                {
-                  umant[0] = umant[1];
-                  MPFR_EXP(u) = e;
-                }
-              zmant[0] = MPFR_MANT(z)[0];
-            }
+          if (precx <= GMP_NUMB_BITS)
+            return mpfr_fma_1 (s, x, y, z, rnd_mode, precx);
+          else if (precx <= 2 * GMP_NUMB_BITS)
+            return mpfr_fma_2 (s, x, y, z, rnd_mode, precx);
           else
-            {
-              zmant[1] = MPFR_MANT(z)[0];
-              zmant[0] = MPFR_LIMB_ZERO;
-              if ((umant[1] & MPFR_LIMB_HIGHBIT) == 0)
-                {
-                  umant[1] = (umant[1] << 1) |
-                    (umant[0] >> (GMP_NUMB_BITS - 1));
-                  umant[0] = umant[0] << 1;
-                  MPFR_EXP(u) = e - 1;
-                }
-              else
-                MPFR_EXP(u) = e;
-            }
-          inex = mpfr_add (u, u, zz, rnd_mode);
-          /* mpfr_set_1_2 requires PREC(u) = 2*PREC(s),
-             thus we need PREC(s) = PREC(x) = PREC(y) = PREC(z) */
-          return mpfr_set_1_2 (s, u, rnd_mode, inex);
+            return mpfr_fma_3 (s, x, y, z, rnd_mode, precx);
         }
-      else if ((n = MPFR_LIMB_SIZE(x)) <= 4 * MPFR_MUL_THRESHOLD)
+#endif
+      if ((n = MPFR_LIMB_SIZE(x)) <= 4 * MPFR_MUL_THRESHOLD)
         {
           mpfr_limb_ptr up;
           mp_size_t un = n + n;
@@ -0,0 +1,313 @@
+/* Sum of two exact products or of a product and a number, rounded once,
+   for 1 to 3 limbs (used by fma.c and fmma.c).  -*- mode: C -*-
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+/* The functions below work on frames of 2n+e limbs, for a target
+   precision p with (n-1)*GMP_NUMB_BITS < p <= n*GMP_NUMB_BITS, n = 1, 2
+   or 3, where e = 1 if p = n*GMP_NUMB_BITS, otherwise e = 0: an exact
+   product of two numbers of precision p fills the 2n most significant
+   limbs, and a number of precision p the n most significant limbs.
+   A frame thus ends with at least two zero bits.
+
+   Two frames are added by shifting right the one with the smaller
+   exponent. Non-zero bits can be shifted out only if the exponents
+   differ by at least 2, in which case there is a cancellation of at most
+   one bit: these bits are replaced by a sticky bit, and in a subtraction,
+   by a borrow of one unit in the last place of the frame. The result is
+   then rounded once, as in mpfr_mul_1.
+
+   These functions must be inlined in each of their callers, so that they
+   are specialized for constant n and e. */
+
+#if __MPFR_GNUC(3,1)
+# define MPFR_FRAME_INLINE __inline__ __attribute__ ((always_inline))
+#else
+# define MPFR_FRAME_INLINE
+#endif
+
+#define MPFR_FRAME_MAX 7  /* maximal number of limbs of a frame */
+
+/* Set u to the normalized product of the n-limb significands xp and yp,
+   and return 1 if it has been shifted by one bit, 0 otherwise. */
+static MPFR_FRAME_INLINE int
+mpfr_frame_mul (mp_limb_t *u, mpfr_limb_srcptr xp, mpfr_limb_srcptr yp,
+                int n, int e)
+{
+  mp_limb_t c;
+  int w = 2 * n + e, i, j;
+
+  for (i = 0; i < n + e; i++)
+    u[i] = 0;
+  for (i = 0; i < n; i++)
+    {
+      c = 0;
+      for (j = 0; j < n; j++)
+        {
+          mp_limb_t hi, lo;
+
+          umul_ppmm (hi, lo, xp[i], yp[j]);
+          add_ssaaaa (hi, lo, hi, lo, 0, c);
+          add_ssaaaa (hi, lo, hi, lo, 0, u[e + i + j]);
+          u[e + i + j] = lo;
+          c = hi;
+        }
+      u[e + i + n] = c;
+    }
+  if (u[w - 1] >= MPFR_LIMB_HIGHBIT)
+    return 0;
+  for (i = w - 1; i > 0; i--)
+    u[i] = (u[i] << 1) | (u[i - 1] >> (GMP_NUMB_BITS - 1));
+  u[0] <<= 1;
+  return 1;
+}
+
+/* Set v to the n-limb significand zp. */
+static MPFR_FRAME_INLINE void
+mpfr_frame_set (mp_limb_t *v, mpfr_limb_srcptr zp, int n, int e)
+{
+  int i;
+
+  for (i = 0; i < n + e; i++)
+    v[i] = 0;
+  for (i = 0; i < n; i++)
+    v[n + e + i] = zp[i];
+}
+
+/* Set s to the sum of u*2^eu (with sign sign_u) and v*2^ev (with sign
+   sign_v), rounded to p bits, where u and v are normalized frames, and
+   return the ternary value. The frames are destroyed. The exponents eu
+   and ev must be such that their difference does not overflow. */
+static MPFR_FRAME_INLINE int
+mpfr_frame_add (mpfr_ptr s, mp_limb_t *u, mpfr_exp_t eu, int sign_u,
+                mp_limb_t *v, mpfr_exp_t ev, int sign_v, mpfr_rnd_t rnd_mode,
+                mpfr_prec_t p, int n, int e)
+{
+  mp_limb_t *pa, *pb, *ap, c, t, rb, sb, mask;
+  mpfr_exp_t ax, d;
+  int w = 2 * n + e, i, j, sign, sign_b, sh, cnt, st = 0;
+
+  MPFR_ASSERTD (n >= 1 && n <= 3);
+  MPFR_ASSERTD (e == (p == n * GMP_NUMB_BITS));
+
+  /* pa is the operand with the larger exponent (u if equal) */
+  if (eu >= ev)
+    {
+      pa = u;
+      pb = v;
+      ax = eu;
+      d = eu - ev;
+      sign = sign_u;
+      sign_b = sign_v;
+    }
+  else
+    {
+      pa = v;
+      pb = u;
+      ax = ev;
+      d = ev - eu;
+      sign = sign_v;
+      sign_b = sign_u;
+    }
+
+  /* shift pb right by d bits */
+  if (d >= (mpfr_exp_t) w * GMP_NUMB_BITS)
+    {
+      for (i = 0; i < w; i++)
+        pb[i] = 0;
+      st = 1;
+    }
+  else if (d > 0)
+    {
+      int q = d / GMP_NUMB_BITS, r = d % GMP_NUMB_BITS;
+
+      for (i = 0; i < q; i++)
+        st |= pb[i] != 0;
+      if (r != 0)
+        {
+          st |= (pb[q] << (GMP_NUMB_BITS - r)) != 0;
+          for (i = 0; i < w - q - 1; i++)
+            pb[i] = (pb[i + q] >> r) | (pb[i + q + 1] << (GMP_NUMB_BITS - r));
+          pb[w - q - 1] = pb[w - 1] >> r;
+        }
+      else
+        for (i = 0; i < w - q; i++)
+          pb[i] = pb[i + q];
+      for (i = w - q; i < w; i++)
+        pb[i] = 0;
+    }
+
+  if (sign == sign_b)
+    {
+      c = 0;
+      for (i = 0; i < w; i++)
+        {
+          t = pa[i] + c;
+          c = t < c;
+          pa[i] = t + pb[i];
+          c += pa[i] < t;
+        }
+      if (c != 0)
+        {
+          st |= pa[0] & 1;
+          for (i = 0; i < w - 1; i++)
+            pa[i] = (pa[i] >> 1) | (pa[i + 1] << (GMP_NUMB_BITS - 1));
+          pa[w - 1] = MPFR_LIMB_HIGHBIT | (pa[w - 1] >> 1);
+          ax ++;
+        }
+    }
+  else
+    {
+      c = st;  /* borrow of the bits shifted out of the frame */
+      for (i = 0; i < w; i++)
+        {
+          t = pa[i] - c;
+          c = pa[i] < c;
+          c += t < pb[i];
+          pa[i] = t - pb[i];
+        }
+      if (c != 0)
+        {
+          /* |v| > |u| with the same exponent: the subtraction is exact */
+          MPFR_ASSERTD (d == 0 && st == 0);
+          c = 1;
+          for (i = 0; i < w; i++)
+            {
+              pa[i] = ~pa[i] + c;
+              c = c && pa[i] == 0;
+            }
+          sign = sign_b;
+        }
+      /* normalize */
+      for (i = w - 1; i >= 0 && pa[i] == 0; i--)
+        ;
+      if (i < 0)
+        {
+          /* exact zero: +0, or -0 for MPFR_RNDD */
+          MPFR_SET_ZERO (s);
+          MPFR_SET_SIGN (s, rnd_mode != MPFR_RNDD ?
+                         MPFR_SIGN_POS : MPFR_SIGN_NEG);
+          MPFR_RET (0);
+        }
+      if (i < w - 1)
+        {
+          ax -= (mpfr_exp_t) (w - 1 - i) * GMP_NUMB_BITS;
+          for (j = w - 1; j >= 0; j--)
+            pa[j] = j >= w - 1 - i ? pa[j - (w - 1 - i)] : 0;
+        }
+      count_leading_zeros (cnt, pa[w - 1]);
+      if (cnt != 0)
+        {
+          for (i = w - 1; i > 0; i--)
+            pa[i] = (pa[i] << cnt) | (pa[i - 1] >> (GMP_NUMB_BITS - cnt));
+          pa[0] <<= cnt;
+          ax -= cnt;
+        }
+    }
+
+  /* round the n most significant limbs of pa to p bits */
+  sh = n * GMP_NUMB_BITS - p;
+  mask = MPFR_LIMB_MASK (sh);
+  if (e == 0)
+    {
+      rb = pa[w - n] & (MPFR_LIMB_ONE << (sh - 1));
+      sb = ((pa[w - n] & mask) ^ rb) | st;
+    }
+  else
+    {
+      rb = pa[w - n - 1] & MPFR_LIMB_HIGHBIT;
+      sb = (pa[w - n - 1] << 1) | st;
+    }
+  for (i = 0; i < w - n - e; i++)
+    sb |= pa[i];
+  ap = MPFR_MANT (s);
+  for (i = 0; i < n; i++)
+    ap[i] = pa[w - n + i];
+  ap[0] &= ~mask;
+
+  MPFR_SIGN (s) = sign;
+
+  if (MPFR_UNLIKELY (ax > __gmpfr_emax))
+    return mpfr_overflow (s, rnd_mode, sign);
+
+  /* Underflow is checked after rounding, as in mpfr_mul_1. */
+  if (MPFR_UNLIKELY (ax < __gmpfr_emin))
+    {
+      int is_max = ap[0] == MPFR_LIMB (~mask);
+      int is_min = ap[n - 1] == MPFR_LIMB_HIGHBIT;
+
+      for (i = 1; i < n; i++)
+        is_max = is_max && ap[i] == MPFR_LIMB_MAX;
+      for (i = 0; i < n - 1; i++)
+        is_min = is_min && ap[i] == 0;
+      if (ax == __gmpfr_emin - 1 && is_max &&
+          ((rnd_mode == MPFR_RNDN && rb) ||
+           (MPFR_IS_LIKE_RNDA (rnd_mode, MPFR_IS_NEG_SIGN (sign)) &&
+            (rb | sb))))
+        goto rounding; /* no underflow */
+      if (rnd_mode == MPFR_RNDN &&
+          (ax < __gmpfr_emin - 1 || (is_min && (rb | sb) == 0)))
+        rnd_mode = MPFR_RNDZ;
+      return mpfr_underflow (s, rnd_mode, sign);
+    }
+
+ rounding:
+  MPFR_EXP (s) = ax; /* Don't use MPFR_SET_EXP since ax might be < __gmpfr_emin
+                        in the case "goto rounding" above. */
+  if ((rb == 0 && sb == 0) || rnd_mode == MPFR_RNDF)
+    {
+      MPFR_ASSERTD (ax >= __gmpfr_emin);
+      MPFR_RET (0);
+    }
+  else if (rnd_mode == MPFR_RNDN)
+    {
+      if (rb == 0 || (sb == 0 && (ap[0] & (MPFR_LIMB_ONE << sh)) == 0))
+        goto truncate;
+      else
+        goto add_one_ulp;
+    }
+  else if (MPFR_IS_LIKE_RNDZ (rnd_mode, MPFR_IS_NEG_SIGN (sign)))
+    {
+    truncate:
+      MPFR_ASSERTD (ax >= __gmpfr_emin);
+      MPFR_RET (-sign);
+    }
+  else /* round away from zero */
+    {
+    add_one_ulp:
+      ap[0] += MPFR_LIMB_ONE << sh;
+      c = ap[0] == 0;
+      for (i = 1; i < n; i++)
+        {
+          ap[i] += c;
+          c = c && ap[i] == 0;
+        }
+      if (c != 0)
+        {
+          ap[n - 1] = MPFR_LIMB_HIGHBIT;
+          if (MPFR_UNLIKELY (ax + 1 > __gmpfr_emax))
+            return mpfr_overflow (s, rnd_mode, sign);
+          MPFR_ASSERTD (ax + 1 >= __gmpfr_emin);
+          MPFR_SET_EXP (s, ax + 1);
+        }
+      MPFR_RET (sign);
+    }
+}
+
@@ -19,8 +19,69 @@ You should have received a copy of the GNU Lesser General Public License
 along with the GNU MPFR Library; see the file COPYING.LESSER.
 If not, see <https://www.gnu.org/licenses/>. */
 
+#define MPFR_NEED_LONGLONG_H
 #include "mpfr-impl.h"
 
+#if !defined(MPFR_GENERIC_ABI)
+
+#include "fma_frame.h"
+
+/* Special code for PREC(z) = PREC(a) = PREC(b) = PREC(c) = PREC(d) = p
+   with (n-1)*GMP_NUMB_BITS < p <= n*GMP_NUMB_BITS, n = 1, 2 or 3, and
+   regular inputs with EXP(a) + EXP(b) and EXP(c) + EXP(d) in the current
+   exponent range; e = 1 if p = n*GMP_NUMB_BITS, otherwise e = 0 (see
+   fma_frame.h). Both products are computed exactly in frames, without
+   any UBF or memory allocation, and their sum is rounded once. */
+static MPFR_FRAME_INLINE int
+mpfr_fmma_n (mpfr_ptr z, mpfr_srcptr a, mpfr_srcptr b, mpfr_srcptr c,
+             mpfr_srcptr d, mpfr_rnd_t rnd, int neg, mpfr_prec_t p,
+             int n, int e)
+{
+  mp_limb_t u[MPFR_FRAME_MAX], v[MPFR_FRAME_MAX];
+  mpfr_exp_t eu, ev;
+  int sign_v;
+
+  eu = MPFR_GET_EXP (a) + MPFR_GET_EXP (b)
+    - mpfr_frame_mul (u, MPFR_MANT (a), MPFR_MANT (b), n, e);
+  ev = MPFR_GET_EXP (c) + MPFR_GET_EXP (d)
+    - mpfr_frame_mul (v, MPFR_MANT (c), MPFR_MANT (d), n, e);
+  sign_v = MPFR_MULT_SIGN (MPFR_SIGN (c), MPFR_SIGN (d));
+  if (neg)
+    sign_v = - sign_v;
+  return mpfr_frame_add (z, u, eu, MPFR_MULT_SIGN (MPFR_SIGN (a),
+                                                   MPFR_SIGN (b)),
+                         v, ev, sign_v, rnd, p, n, e);
+}
+
+static int
+mpfr_fmma_1 (mpfr_ptr z, mpfr_srcptr a, mpfr_srcptr b, mpfr_srcptr c,
+             mpfr_srcptr d, mpfr_rnd_t rnd, int neg, mpfr_prec_t p)
+{
+  return p == GMP_NUMB_BITS ?
+    mpfr_fmma_n (z, a, b, c, d, rnd, neg, p, 1, 1) :
+    mpfr_fmma_n (z, a, b, c, d, rnd, neg, p, 1, 0);
+}
+
+static int
+mpfr_fmma_2 (mpfr_ptr z, mpfr_srcptr a, mpfr_srcptr b, mpfr_srcptr c,
+             mpfr_srcptr d, mpfr_rnd_t rnd, int neg, mpfr_prec_t p)
+{
+  return p == 2 * GMP_NUMB_BITS ?
+    mpfr_fmma_n (z, a, b, c, d, rnd, neg, p, 2, 1) :
+    mpfr_fmma_n (z, a, b, c, d, rnd, neg, p, 2, 0);
+}
+
+static int
+mpfr_fmma_3 (mpfr_ptr z, mpfr_srcptr a, mpfr_srcptr b, mpfr_srcptr c,
+             mpfr_srcptr d, mpfr_rnd_t rnd, int neg, mpfr_prec_t p)
+{
+  return p == 3 * GMP_NUMB_BITS ?
+    mpfr_fmma_n (z, a, b, c, d, rnd, neg, p, 3, 1) :
+    mpfr_fmma_n (z, a, b, c, d, rnd, neg, p, 3, 0);
+}
+
+#endif /* !defined(MPFR_GENERIC_ABI) */
+
 /* compute a*b+c*d if neg=0 (fmma), a*b-c*d otherwise (fmms) */
 static int
 mpfr_fmma_aux (mpfr_ptr z, mpfr_srcptr a, mpfr_srcptr b, mpfr_srcptr c,
@@ -42,6 +103,31 @@ mpfr_fmma_aux (mpfr_ptr z, mpfr_srcptr a, mpfr_srcptr b, mpfr_srcptr c,
       mpfr_get_prec (d), mpfr_log_prec, d, rnd, neg),
      ("z[%Pd]=%.*Rg", mpfr_get_prec (z), mpfr_log_prec, z));
 
+#if !defined(MPFR_GENERIC_ABI)
+  /* Since |EXP(a)|, |EXP(b)|, |EXP(c)|, |EXP(d)| < 2^(k-2) on a k-bit
+     computer, the exponents of the products cannot overflow. */
+  if (prec_z == MPFR_PREC(a) && prec_z == MPFR_PREC(b) &&
+      prec_z == MPFR_PREC(c) && prec_z == MPFR_PREC(d) &&
+      prec_z <= 3 * GMP_NUMB_BITS &&
+      ! MPFR_IS_SINGULAR (a) && ! MPFR_IS_SINGULAR (b) &&
+      ! MPFR_IS_SINGULAR (c) && ! MPFR_IS_SINGULAR (d))
+    {
+      mpfr_exp_t eu = MPFR_GET_EXP (a) + MPFR_GET_EXP (b);
+      mpfr_exp_t ev = MPFR_GET_EXP (c) + MPFR_GET_EXP (d);
+
+      if (eu <= __gmpfr_emax && eu > __gmpfr_emin &&
+          ev <= __gmpfr_emax && ev > __gmpfr_emin)
+        {
+          if (prec_z <= GMP_NUMB_BITS)
+            return mpfr_fmma_1 (z, a, b, c, d, rnd, neg, prec_z);
+          else if (prec_z <= 2 * GMP_NUMB_BITS)
+            return mpfr_fmma_2 (z, a, b, c, d, rnd, neg, prec_z);
+          else
+            return mpfr_fmma_3 (z, a, b, c, d, rnd, neg, prec_z);
+        }
+    }
+#endif
+
   MPFR_TMP_MARK (marker);
 
   un = MPFR_LIMB_SIZE (a) + MPFR_LIMB_SIZE (b);
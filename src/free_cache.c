@@ -47,6 +47,7 @@ mpfr_free_local_cache (void)
      the mpz_t pool. */
   mpfr_bernoulli_freecache ();
   mpfr_free_pool ();
+  mpfr_tmp_arena_free ();
 }
 
 void
@@ -89,3 +90,75 @@ mpfr_mp_memory_cleanup (void)
   mpfr_free_cache ();
   return 0;
 }
+
+/* Soft limit on the memory held by the caches of the current thread
+   (0 if there is no limit), number of computations of cached values in
+   progress, and number of times the caches have been freed because of
+   the limit. */
+MPFR_THREAD_ATTR size_t __gmpfr_memory_limit = 0;
+MPFR_THREAD_ATTR int __gmpfr_cache_depth = 0;
+static MPFR_THREAD_ATTR unsigned long memory_evictions = 0;
+
+/* Set the number of bytes held by each cache of the current thread in
+   *u (if u is not null), and return the total. The constant caches are
+   taken into account even if they are shared by all threads. */
+size_t
+mpfr_memory_usage (mpfr_memory_usage_t *u)
+{
+  mpfr_memory_usage_t v;
+
+#ifndef MPFR_USE_LOGGING
+  v.const_pi = mpfr_cache_size (__gmpfr_cache_const_pi);
+  v.const_log2 = mpfr_cache_size (__gmpfr_cache_const_log2);
+#else
+  v.const_pi = mpfr_cache_size (__gmpfr_normal_pi)
+    + mpfr_cache_size (__gmpfr_logging_pi);
+  v.const_log2 = mpfr_cache_size (__gmpfr_normal_log2)
+    + mpfr_cache_size (__gmpfr_logging_log2);
+#endif
+  v.const_euler = mpfr_cache_size (__gmpfr_cache_const_euler);
+  v.const_catalan = mpfr_cache_size (__gmpfr_cache_const_catalan);
+  v.bernoulli = mpfr_bernoulli_cachesize ();
+  mpfr_pool_stats (NULL, NULL, &v.pool);
+  mpfr_tmp_arena_stats (NULL, &v.tmp, NULL);
+  v.evictions = memory_evictions;
+
+  if (u != NULL)
+    *u = v;
+  return v.const_pi + v.const_log2 + v.const_euler + v.const_catalan
+    + v.bernoulli + v.pool + v.tmp;
+}
+
+/* Set the soft limit of the current thread to n bytes (0 for no limit)
+   and return the previous one. When the caches that are local to the
+   thread exceed it on exit of mpfr_cache, they are freed as with
+   mpfr_free_cache2 (MPFR_FREE_LOCAL_CACHE). */
+size_t
+mpfr_memory_limit (size_t n)
+{
+  size_t old = __gmpfr_memory_limit;
+
+  __gmpfr_memory_limit = n;
+  return old;
+}
+
+/* Called by MPFR_MEMORY_CHECK when no cache is in use. */
+void
+mpfr_memory_check (void)
+{
+  mpfr_memory_usage_t u;
+  size_t n;
+
+  MPFR_ASSERTD (__gmpfr_cache_depth == 0);
+  n = mpfr_memory_usage (&u);
+#if defined(MPFR_WANT_SHARED_CACHE)
+  /* The shared constant caches are not freed below, thus must not be
+     taken into account. */
+  n -= u.const_pi + u.const_log2 + u.const_euler + u.const_catalan;
+#endif
+  if (n > __gmpfr_memory_limit)
+    {
+      mpfr_free_cache2 (MPFR_FREE_LOCAL_CACHE);
+      memory_evictions ++;
+    }
+}
@@ -43,6 +43,10 @@ If not, see <https://www.gnu.org/licenses/>. */
 # define MPFR_DIV_THRESHOLD 25 /* limbs */
 #endif
 
+#ifndef MPFR_DIV_Q_THRESHOLD
+# define MPFR_DIV_Q_THRESHOLD 5000 /* limbs */
+#endif
+
 #ifndef MPFR_EXP_2_THRESHOLD
 # define MPFR_EXP_2_THRESHOLD 100 /* bits */
 #endif
@@ -40,6 +40,7 @@ mpfr_hypot (mpfr_ptr z, mpfr_srcptr x, mpfr_srcptr y, mpfr_rnd_t rnd_mode)
   MPFR_SAVE_EXPO_DECL (expo);
   MPFR_ZIV_DECL (loop);
   MPFR_BLOCK_DECL (flags);
+  MPFR_PERF_FUNC (MPFR_PREC (z));
 
   MPFR_LOG_FUNC
     (("x[%Pd]=%.*Rg y[%Pd]=%.*Rg rnd=%d",
@@ -0,0 +1,259 @@
+/* mpfr_jn_range, mpfr_yn_range -- Bessel functions of consecutive orders
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#define MPFR_NEED_LONGLONG_H
+#include "mpfr-impl.h"
+
+/* Both J_k(x) and Y_k(x) satisfy the three-term recurrence
+     f_{k-1} + f_{k+1} = (2k/x) f_k.
+   J_k is the minimal solution for k -> +Inf, thus the backward recurrence
+   is stable for J_k, whereas the forward recurrence is stable for Y_k.
+   Like in Miller's algorithm, we compute J_m, ..., J_{m+n-1} by backward
+   recurrence, but instead of starting from arbitrary values at some
+   order N >> m+n and normalizing with J_0 + 2 sum(J_{2k}, k >= 1) = 1
+   (which would require a bound on the truncation error at order N),
+   we start from J_{m+n-1} and J_{m+n} computed by mpfr_jn at the working
+   precision; these two anchors fix the scale exactly, and mpfr_jn uses
+   the Hankel asymptotic expansion itself when x is large.
+   Y_m, ..., Y_{m+n-1} are computed similarly by forward recurrence
+   from Y_m and Y_{m+1}.
+
+   Error analysis: let u = 2^(-w) where w is the working precision.
+   In f_{k-1} = o(o(o(2k f_k) / x) - f_{k+1}), with s = o(o(2k f_k) / x),
+   we have |s - 2k f_k / x| <= 3u |s| and the subtraction adds an error
+   of at most u |f_{k-1}|. If e_k bounds the absolute error on f_k, then
+     e_{k-1} <= (2k/|x|) e_k + e_{k+1} + u (3 |s| + |f_{k-1}|),
+   which we evaluate with small precision and rounding toward +Inf
+   (and symmetrically for the forward recurrence). The anchors are
+   correctly rounded to nearest, thus have an error of at most 1/2 ulp.
+   This running bound is rigorous; it grows slowly for k > |x| (where the
+   recurrence is strongly contracting in the chosen direction) and by at
+   most a factor of about 1.6 per step for k < |x|, in which case the
+   Ziv loop increases the working precision. The few entries that still
+   cannot be rounded (typically when x is close to a zero of J_k or Y_k)
+   are computed separately with mpfr_jn or mpfr_yn. */
+
+#define MPFR_JYN_RANGE_MAXITER 3
+
+static int
+mpfr_jyn_one (mpfr_ptr z, long k, mpfr_srcptr x, mpfr_rnd_t r, int y)
+{
+  return y ? mpfr_yn (z, k, x, r) : mpfr_jn (z, k, x, r);
+}
+
+static int
+mpfr_jyn_range (const mpfr_ptr *z, int *inex, unsigned long m,
+                unsigned long n, mpfr_srcptr x0, mpfr_rnd_t r, int y)
+{
+  unsigned long i, cnt, *idx;
+  mpfr_t *f, *e, x, ax, s, a, b;
+  mpfr_prec_t p, w;
+  mpfr_exp_t maxdef;
+  int *t, iter, ret = 0;
+  MPFR_SAVE_EXPO_DECL (expo);
+
+  MPFR_LOG_FUNC
+    (("m=%lu n=%lu x[%Pd]=%.*Rg rnd=%d", m, n, mpfr_get_prec (x0),
+      mpfr_log_prec, x0, r),
+     ("ret=%d", ret));
+
+  if (n == 0)
+    return 0;
+
+  /* all orders, including the anchor m+n for jn, must fit in a long */
+  MPFR_ASSERTN (n <= LONG_MAX && m <= LONG_MAX - n);
+
+  t = (int *) mpfr_allocate_func (n * sizeof (int));
+
+  /* x0 may be one of the z[i], thus work on a copy */
+  mpfr_init2 (x, MPFR_PREC (x0));
+  mpfr_set (x, x0, MPFR_RNDN);
+
+  /* Singular cases (and x < 0 for yn, where all results are NaN), and too
+     few orders for the recurrence to be worth it. */
+  if (n < 3 || MPFR_IS_SINGULAR (x) || (y && MPFR_IS_NEG (x)))
+    {
+      for (i = 0; i < n; i++)
+        {
+          t[i] = mpfr_jyn_one (z[i], m + i, x, r, y);
+          if (inex != NULL)
+            inex[i] = t[i];
+          ret |= t[i] != 0;
+        }
+      mpfr_clear (x);
+      mpfr_free_func (t, n * sizeof (int));
+      return ret;
+    }
+
+  MPFR_SAVE_EXPO_MARK (expo);
+  MPFR_TMP_INIT_ABS (ax, x);
+
+  p = MPFR_PREC_MIN;
+  for (i = 0; i < n; i++)
+    if (MPFR_PREC (z[i]) > p)
+      p = MPFR_PREC (z[i]);
+
+  /* idx[] holds the indices i for which z[i] is not known yet */
+  idx = (unsigned long *) mpfr_allocate_func (n * sizeof (unsigned long));
+  for (i = 0; i < n; i++)
+    idx[i] = i;
+  cnt = n;
+
+  /* f[i] approximates J_{m+i} or Y_{m+i}, with error at most e[i];
+     f[n] is the second anchor for jn */
+  f = (mpfr_t *) mpfr_allocate_func ((n + 1) * sizeof (mpfr_t));
+  e = (mpfr_t *) mpfr_allocate_func ((n + 1) * sizeof (mpfr_t));
+  w = p + MPFR_INT_CEIL_LOG2 (n) + 20;
+  for (i = 0; i <= n; i++)
+    {
+      mpfr_init2 (f[i], w);
+      mpfr_init2 (e[i], MPFR_SMALL_PRECISION);
+    }
+  mpfr_init2 (s, w);
+  mpfr_init2 (a, MPFR_SMALL_PRECISION);
+  mpfr_init2 (b, MPFR_SMALL_PRECISION);
+
+  for (iter = 0; iter < MPFR_JYN_RANGE_MAXITER; iter++)
+    {
+      unsigned long j, k, i0, i1;
+
+      /* the anchors */
+      i0 = y ? 0 : n - 1;
+      i1 = i0 + 1;
+      mpfr_jyn_one (f[i0], m + i0, x, MPFR_RNDN, y);
+      mpfr_jyn_one (f[i1], m + i1, x, MPFR_RNDN, y);
+      /* the exponent range is extended: this can only happen in extreme
+         cases (e.g., huge orders for a tiny x) */
+      if (MPFR_UNLIKELY (MPFR_IS_SINGULAR (f[i0]) ||
+                         MPFR_IS_SINGULAR (f[i1])))
+        break;
+      mpfr_set_ui_2exp (e[i0], 1, MPFR_GET_EXP (f[i0]) - w - 1, MPFR_RNDU);
+      mpfr_set_ui_2exp (e[i1], 1, MPFR_GET_EXP (f[i1]) - w - 1, MPFR_RNDU);
+
+      for (j = 1; j < n - (y != 0); j++)
+        {
+          unsigned long cur, prv, nxt; /* recurrence indices */
+
+          if (y)
+            {
+              cur = j;
+              prv = j - 1;
+              nxt = j + 1;
+            }
+          else
+            {
+              cur = n - j;
+              prv = n - j + 1;
+              nxt = n - j - 1;
+            }
+          /* nxt is the new index, from cur and prv, with order m + cur */
+          MPFR_ASSERTD (m + cur <= ULONG_MAX / 2);
+          mpfr_mul_ui (s, f[cur], 2 * (m + cur), MPFR_RNDN);
+          mpfr_div (s, s, x, MPFR_RNDN);
+          mpfr_sub (f[nxt], s, f[prv], MPFR_RNDN);
+
+          /* error bound, see above */
+          mpfr_ui_div (a, 2 * (m + cur), ax, MPFR_RNDU);
+          mpfr_mul (e[nxt], a, e[cur], MPFR_RNDU);
+          mpfr_add (e[nxt], e[nxt], e[prv], MPFR_RNDU);
+          mpfr_abs (a, s, MPFR_RNDU);
+          mpfr_mul_ui (a, a, 3, MPFR_RNDU);
+          mpfr_abs (b, f[nxt], MPFR_RNDU);
+          mpfr_add (a, a, b, MPFR_RNDU);
+          mpfr_mul_2si (a, a, -w, MPFR_RNDU);
+          mpfr_add (e[nxt], e[nxt], a, MPFR_RNDU);
+        }
+
+      /* keep in idx[] only the entries for which the rounding test fails */
+      maxdef = 0;
+      for (j = k = 0; j < cnt; j++)
+        {
+          mpfr_ptr zj = z[idx[j]];
+          mpfr_exp_t err;
+
+          i = idx[j];
+          err = MPFR_IS_ZERO (f[i]) ? 0
+            : MPFR_GET_EXP (f[i]) - MPFR_GET_EXP (e[i]);
+          if (MPFR_LIKELY (MPFR_CAN_ROUND (f[i], err, MPFR_PREC (zj), r)))
+            t[i] = mpfr_set (zj, f[i], r);
+          else
+            {
+              mpfr_exp_t def = (mpfr_exp_t) MPFR_PREC (zj) + 8 - err;
+
+              if (def > maxdef)
+                maxdef = def;
+              idx[k++] = i;
+            }
+        }
+      cnt = k;
+
+      /* the remaining entries are computed one by one if there are few
+         of them, or if the loss of accuracy in the recurrence is large
+         compared to the target precision */
+      if (cnt <= n / 8 || maxdef > (mpfr_exp_t) p + 64)
+        break;
+
+      w += maxdef < (mpfr_exp_t) (w / 2) ? w / 2 : maxdef;
+      for (i = 0; i <= n; i++)
+        mpfr_set_prec (f[i], w);
+      mpfr_set_prec (s, w);
+    }
+
+  for (i = 0; i < cnt; i++)
+    t[idx[i]] = mpfr_jyn_one (z[idx[i]], m + idx[i], x, r, y);
+
+  for (i = 0; i <= n; i++)
+    {
+      mpfr_clear (f[i]);
+      mpfr_clear (e[i]);
+    }
+  mpfr_free_func (f, (n + 1) * sizeof (mpfr_t));
+  mpfr_free_func (e, (n + 1) * sizeof (mpfr_t));
+  mpfr_free_func (idx, n * sizeof (unsigned long));
+  mpfr_clears (x, s, a, b, (mpfr_ptr) 0);
+
+  MPFR_SAVE_EXPO_FREE (expo);
+
+  for (i = 0; i < n; i++)
+    {
+      t[i] = mpfr_check_range (z[i], t[i], r);
+      if (inex != NULL)
+        inex[i] = t[i];
+      ret |= t[i] != 0;
+    }
+
+  mpfr_free_func (t, n * sizeof (int));
+  return ret;
+}
+
+int
+mpfr_jn_range (const mpfr_ptr *z, int *inex, unsigned long m,
+               unsigned long n, mpfr_srcptr x, mpfr_rnd_t r)
+{
+  return mpfr_jyn_range (z, inex, m, n, x, r, 0);
+}
+
+int
+mpfr_yn_range (const mpfr_ptr *z, int *inex, unsigned long m,
+               unsigned long n, mpfr_srcptr x, mpfr_rnd_t r)
+{
+  return mpfr_jyn_range (z, inex, m, n, x, r, 1);
+}
@@ -719,6 +719,7 @@ int
 mpfr_lngamma (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd)
 {
   int inex;
+  MPFR_PERF_FUNC (MPFR_PREC (y));
 
   MPFR_LOG_FUNC
     (("x[%Pd]=%.*Rg rnd=%d", mpfr_get_prec (x), mpfr_log_prec, x, rnd),
@@ -759,6 +760,7 @@ mpfr_lgamma (mpfr_ptr y, int *signp, mpfr_srcptr x, mpfr_rnd_t rnd)
 {
   int inex;
   int sgn = 1; /* most common case */
+  MPFR_PERF_FUNC (MPFR_PREC (y));
 
   /* when signp=NULL, we print 0 in MPFR_LOG_FUNC */
   MPFR_LOG_FUNC
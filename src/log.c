@@ -47,6 +47,7 @@ mpfr_log (mpfr_ptr r, mpfr_srcptr a, mpfr_rnd_t rnd_mode)
   MPFR_SAVE_EXPO_DECL (expo);
   MPFR_ZIV_DECL (loop);
   MPFR_GROUP_DECL(group);
+  MPFR_PERF_FUNC (MPFR_PREC (r));
 
   MPFR_LOG_FUNC
     (("a[%Pd]=%.*Rg rnd=%d", mpfr_get_prec (a), mpfr_log_prec, a, rnd_mode),
@@ -106,6 +107,20 @@ mpfr_log (mpfr_ptr r, mpfr_srcptr a, mpfr_rnd_t rnd_mode)
 
   q = MPFR_PREC (r);
 
+#if !defined(MPFR_GENERIC_ABI) && GMP_NUMB_BITS == 64
+  if (q <= 2 * GMP_NUMB_BITS)
+    {
+      /* fixed-point code, which fails only in rare cases */
+      inexact = mpfr_log_fixed (r, a, rnd_mode);
+      if (MPFR_LIKELY (inexact != 0))
+        return inexact;
+    }
+#endif
+
+  /* Note: a Newton iteration on mpfr_exp would need at least one exp in
+     the target precision, and mpfr_exp is not faster than the AGM below
+     in large precision (when pi and log(2) are in the cache). */
+
   /* use initial precision about q+2*lg(q)+cte */
   p = q + 2 * MPFR_INT_CEIL_LOG2 (q) + 10;
   /* % ~(mpfr_prec_t)GMP_NUMB_BITS  ;
@@ -0,0 +1,155 @@
+/* mpfr_log_all -- natural, binary and decimal logarithms
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#define MPFR_NEED_LONGLONG_H
+#include "mpfr-impl.h"
+
+/* Set each non-null r[i] to the value of f[i] on x, where x may be one
+   of the r[i]. */
+static int
+mpfr_log_all_separate (mpfr_ptr r[3], mpfr_srcptr x, mpfr_rnd_t rnd_mode)
+{
+  int (*const f[3]) (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t) =
+    { mpfr_log, mpfr_log2, mpfr_log10 };
+  int inex[3] = { 0, 0, 0 };
+  mpfr_t xx;
+  int i;
+
+  mpfr_init2 (xx, MPFR_PREC (x));
+  mpfr_set (xx, x, MPFR_RNDN);
+  for (i = 0; i < 3; i++)
+    if (r[i] != NULL)
+      inex[i] = f[i] (r[i], xx, rnd_mode);
+  mpfr_clear (xx);
+  return INEX3 (inex[0], inex[1], inex[2]);
+}
+
+/* The computations are done by
+     l = o(log(x)), c = o(log(2)) or o(log(10)), q = o(l / c),
+   with rounding to nearest and N bits of precision. Each of these
+   operations has a relative error of at most 2^(-N), thus q has a
+   relative error of at most 3.0001 * 2^(-N) < 4 * 2^(-N), i.e., at most
+   4 ulps. Like in mpfr_log10, the constant log(10) is computed with
+   mpfr_log (mpfr_log_ui is slower at small and medium precisions).
+   As in mpfr_log10 too, the case x = 10^k, where log10(x) is exact, is
+   detected when the rounding test fails. */
+
+int
+mpfr_log_all (mpfr_ptr rl, mpfr_ptr r2, mpfr_ptr r10, mpfr_srcptr x,
+              mpfr_rnd_t rnd_mode)
+{
+  mpfr_ptr r[3];
+  mpfr_t l, c, q2, q10;
+  mpfr_prec_t N;
+  unsigned long k10 = 0;
+  int inex[3] = { 0, 0, 0 }, exact10 = 0, i;
+  MPFR_ZIV_DECL (loop);
+  MPFR_SAVE_EXPO_DECL (expo);
+  MPFR_GROUP_DECL (group);
+  MPFR_PERF_FUNC (rl != NULL ? MPFR_PREC (rl) : r2 != NULL ? MPFR_PREC (r2) :
+                  r10 != NULL ? MPFR_PREC (r10) : MPFR_PREC_MIN);
+
+  MPFR_ASSERTN (rl == NULL || (rl != r2 && rl != r10));
+  MPFR_ASSERTN (r2 == NULL || r2 != r10);
+
+  MPFR_LOG_FUNC
+    (("x[%Pd]=%.*Rg rnd=%d", mpfr_get_prec (x), mpfr_log_prec, x, rnd_mode),
+     ("inex=%d,%d,%d", inex[0], inex[1], inex[2]));
+
+  r[0] = rl;
+  r[1] = r2;
+  r[2] = r10;
+
+  /* Special values (including 1, for which all the results are exact),
+     negative inputs, and powers of 2 (for which log2(x) is exact; the
+     other logarithms are then computed separately too, since log(x) is
+     just a multiple of log(2) and is cheap). */
+  if (MPFR_IS_SINGULAR (x) || MPFR_IS_NEG (x) ||
+      mpfr_cmp_ui_2exp (x, 1, MPFR_GET_EXP (x) - 1) == 0)
+    return mpfr_log_all_separate (r, x, rnd_mode);
+
+  N = MPFR_PREC_MIN;
+  for (i = 0; i < 3; i++)
+    if (r[i] != NULL && MPFR_PREC (r[i]) > N)
+      N = MPFR_PREC (r[i]);
+
+  MPFR_SAVE_EXPO_MARK (expo);
+
+  N = N + MPFR_INT_CEIL_LOG2 (N) + 6;
+  MPFR_GROUP_INIT_4 (group, N, l, c, q2, q10);
+
+  MPFR_ZIV_INIT (loop, N);
+  for (;;)
+    {
+      mpfr_log (l, x, MPFR_RNDN);
+      if (r2 != NULL)
+        {
+          mpfr_const_log2 (c, MPFR_RNDN);
+          mpfr_div (q2, l, c, MPFR_RNDN);
+        }
+      if (r10 != NULL && ! exact10)
+        {
+          mpfr_set_ui (c, 10, MPFR_RNDN);
+          mpfr_log (c, c, MPFR_RNDN);
+          mpfr_div (q10, l, c, MPFR_RNDN);
+          if (! MPFR_CAN_ROUND (q10, N - 2, MPFR_PREC (r10), rnd_mode) &&
+              MPFR_IS_POS (q10) && mpfr_integer_p (q10) &&
+              mpfr_fits_ulong_p (q10, MPFR_RNDN))
+            {
+              k10 = mpfr_get_ui (q10, MPFR_RNDN);
+              /* c is no longer needed: use it to compute 10^k10 */
+              exact10 = mpfr_ui_pow_ui (c, 10, k10, MPFR_RNDN) == 0
+                && mpfr_equal_p (x, c);
+            }
+        }
+
+      /* all the outputs are set after the loop, since x may be one
+         of them */
+      if (MPFR_LIKELY ((rl == NULL ||
+                        MPFR_CAN_ROUND (l, N, MPFR_PREC (rl), rnd_mode)) &&
+                       (r2 == NULL ||
+                        MPFR_CAN_ROUND (q2, N - 2, MPFR_PREC (r2),
+                                        rnd_mode)) &&
+                       (r10 == NULL || exact10 ||
+                        MPFR_CAN_ROUND (q10, N - 2, MPFR_PREC (r10),
+                                        rnd_mode))))
+        break;
+      MPFR_ZIV_NEXT (loop, N);
+      MPFR_GROUP_REPREC_4 (group, N, l, c, q2, q10);
+    }
+  MPFR_ZIV_FREE (loop);
+
+  if (rl != NULL)
+    inex[0] = mpfr_set (rl, l, rnd_mode);
+  if (r2 != NULL)
+    inex[1] = mpfr_set (r2, q2, rnd_mode);
+  if (r10 != NULL)
+    inex[2] = exact10 ? mpfr_set_ui (r10, k10, rnd_mode)
+      : mpfr_set (r10, q10, rnd_mode);
+
+  MPFR_GROUP_CLEAR (group);
+  MPFR_SAVE_EXPO_FREE (expo);
+
+  for (i = 0; i < 3; i++)
+    if (r[i] != NULL)
+      inex[i] = mpfr_check_range (r[i], inex[i], rnd_mode);
+  return INEX3 (inex[0], inex[1], inex[2]);
+}
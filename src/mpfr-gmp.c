@@ -342,32 +342,4 @@ mpfr_free_func (void *ptr, size_t size)
   (*free_func) (ptr, size);
 }
 
-void *
-mpfr_tmp_allocate (struct tmp_marker **tmp_marker, size_t size)
-{
-  struct tmp_marker *head;
-
-  head = (struct tmp_marker *)
-    mpfr_allocate_func (sizeof (struct tmp_marker));
-  head->ptr = mpfr_allocate_func (size);
-  head->size = size;
-  head->next = *tmp_marker;
-  *tmp_marker = head;
-  return head->ptr;
-}
-
-void
-mpfr_tmp_free (struct tmp_marker *tmp_marker)
-{
-  struct tmp_marker *t;
-
-  while (tmp_marker != NULL)
-    {
-      t = tmp_marker;
-      mpfr_free_func (t->ptr, t->size);
-      tmp_marker = t->next;
-      mpfr_free_func (t, sizeof (struct tmp_marker));
-    }
-}
-
 #endif /* Have gmp-impl.h */
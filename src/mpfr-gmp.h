@@ -272,11 +272,16 @@ __MPFR_DECLSPEC mp_limb_t __gmpn_rsblsh1_n (mp_limb_t*, mp_limb_t*, mp_limb_t*,
 
 /* Definitions related to temporary memory allocation */
 
+/* A block allocated by mpfr_tmp_allocate: either a block obtained from
+   the allocation function (ptr is non-null), or a block of the arena of
+   the current thread (ptr is null), in which case chunk and size give the
+   top of the arena just before the allocation. See tmp_arena.c. */
 struct tmp_marker
 {
   void *ptr;
   size_t size;
   struct tmp_marker *next;
+  void *chunk;
 };
 
 __MPFR_DECLSPEC void *mpfr_tmp_allocate (struct tmp_marker **,
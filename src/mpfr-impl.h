@@ -249,6 +249,32 @@ struct __gmpfr_cache_s {
 typedef struct __gmpfr_cache_s mpfr_cache_t[1];
 typedef struct __gmpfr_cache_s *mpfr_cache_ptr;
 
+/* A sum computed by binary splitting, of the form
+     T/Q = sum(a(k) * p(0)...p(k) / (q(0)...q(k)), k = 0..n-1),
+   with P = p(0)...p(n-1) (up to a common power of 2 removed from T, P
+   and Q). Keeping P allows one to extend the sum with more terms, e.g.,
+   when a Ziv loop needs a larger precision; see bsum.c. */
+typedef struct {
+  mpz_t T, P, Q;
+  unsigned long n;  /* number of terms; 0 if not initialized */
+} __mpfr_bsum_struct;
+typedef __mpfr_bsum_struct mpfr_bsum_t[1];
+typedef __mpfr_bsum_struct *mpfr_bsum_ptr;
+
+/* Random bits drawn from a gmp_randstate_t in blocks of at most
+   MPFR_RAND_BUF_BITS bits, for the functions generating arrays of
+   random numbers; see urandomb.c. */
+#define MPFR_RAND_BUF_BITS 8192
+typedef struct {
+  __gmp_randstate_struct *state;
+  mpfr_limb_ptr buf;
+  mpfr_prec_t size;   /* number of bits in buf */
+  mpfr_prec_t pos;    /* number of bits of buf already used */
+  mpfr_uprec_t left;  /* expected number of bits still needed */
+} __mpfr_rand_buf_struct;
+typedef __mpfr_rand_buf_struct mpfr_rand_buf_t[1];
+typedef __mpfr_rand_buf_struct *mpfr_rand_buf_ptr;
+
 #if __GMP_LIBGMP_DLL
 # define MPFR_WIN_THREAD_SAFE_DLL 1
 #endif
@@ -1195,10 +1221,11 @@ typedef uintmax_t mpfr_ueexp_t;
    PowerPC and Aarch64 (64-bit ARM), and with Clang on x86_64.
    VSIGN code based on mini-gmp's GMP_CMP macro; adapted for INEXPOS. */
 
-/* Macros for functions returning two inexact values in an 'int'
+/* Macros for functions returning two (or three) inexact values in an 'int'
    (exact = 0, positive = 1, negative = 2) */
 #define INEXPOS(y) (((y) != 0) + ((y) < 0))
 #define INEX(y,z) (INEXPOS(y) | (INEXPOS(z) << 2))
+#define INEX3(x,y,z) (INEX(x,y) | (INEXPOS(z) << 4))
 
 /* When returning the ternary inexact value, ALWAYS use one of the
    following two macros, unless the flag comes from another function
@@ -1451,6 +1478,67 @@ typedef union { mp_size_t s; mp_limb_t l; } mpfr_size_limb_t;
 
 #include "mparam.h"
 
+/* With --enable-tune-profiles, the library contains several sets of
+   thresholds (profiles, see tune_profile.c), one of them being selected
+   at startup from the processor model. The macros above then give the
+   "default" profile only, and the code reads the thresholds from the
+   current profile. The programs of the tune directory, which include the
+   MPFR source files with their own values, define MPFR_NO_TUNE_PROFILES. */
+#if defined(MPFR_WANT_TUNE_PROFILES) && !defined(MPFR_TUNE_COVERAGE) && \
+  !defined(MPFR_NO_TUNE_PROFILES)
+# define MPFR_USE_TUNE_PROFILES 1
+#endif
+
+typedef struct {
+  const short *mulhigh_ktab, *sqrhigh_ktab, *divhigh_ktab;
+  mp_size_t mulhigh_size, sqrhigh_size, divhigh_size;
+  mp_size_t mul_threshold, sqr_threshold; /* limbs */
+  mp_size_t div_threshold, div_q_threshold; /* limbs */
+  mpfr_prec_t exp_2_threshold, exp_threshold, sincos_threshold; /* bits */
+  long ai_threshold1, ai_threshold2, ai_threshold3;
+} mpfr_tune_param_t;
+
+#ifdef MPFR_USE_TUNE_PROFILES
+__MPFR_DECLSPEC extern const mpfr_tune_param_t *__gmpfr_tune_param;
+__MPFR_DECLSPEC extern int (*__gmpfr_tune_cpuid) (char *, int *, int *);
+# undef MPFR_MUL_THRESHOLD
+# undef MPFR_SQR_THRESHOLD
+# undef MPFR_DIV_THRESHOLD
+# undef MPFR_DIV_Q_THRESHOLD
+# undef MPFR_EXP_2_THRESHOLD
+# undef MPFR_EXP_THRESHOLD
+# undef MPFR_SINCOS_THRESHOLD
+# undef MPFR_AI_THRESHOLD1
+# undef MPFR_AI_THRESHOLD2
+# undef MPFR_AI_THRESHOLD3
+# define MPFR_MUL_THRESHOLD    (__gmpfr_tune_param->mul_threshold)
+# define MPFR_SQR_THRESHOLD    (__gmpfr_tune_param->sqr_threshold)
+# define MPFR_DIV_THRESHOLD    (__gmpfr_tune_param->div_threshold)
+# define MPFR_DIV_Q_THRESHOLD  (__gmpfr_tune_param->div_q_threshold)
+# define MPFR_EXP_2_THRESHOLD  (__gmpfr_tune_param->exp_2_threshold)
+# define MPFR_EXP_THRESHOLD    (__gmpfr_tune_param->exp_threshold)
+# define MPFR_SINCOS_THRESHOLD (__gmpfr_tune_param->sincos_threshold)
+# define MPFR_AI_THRESHOLD1    (__gmpfr_tune_param->ai_threshold1)
+# define MPFR_AI_THRESHOLD2    (__gmpfr_tune_param->ai_threshold2)
+# define MPFR_AI_THRESHOLD3    (__gmpfr_tune_param->ai_threshold3)
+/* The conditions on the thresholds are checked for every profile when
+   it is selected (see tune_profile.c). */
+# define MPFR_TUNE_STATIC_ASSERT(c) MPFR_ASSERTD (c)
+#else
+# define MPFR_TUNE_STATIC_ASSERT(c) MPFR_STAT_STATIC_ASSERT (c)
+#endif
+
+/* Non-zero if mpfr_sincos_fast is to be used for x in precision p, even
+   below MPFR_SINCOS_THRESHOLD: for |x| < 1/2, it does no argument reduction
+   (which would make the input full) and the cost of its binary splitting
+   depends on the actual size of x, so that it is faster for very short
+   inputs (e.g., 1/4 or 3/8 stored in a large precision). */
+#ifndef MPFR_SINCOS_SPARSE_RATIO
+# define MPFR_SINCOS_SPARSE_RATIO 1500
+#endif
+#define MPFR_SINCOS_SPARSE_P(x,p)                                       \
+  (MPFR_GET_EXP (x) < 0 && mpfr_min_prec (x) <= (p) / MPFR_SINCOS_SPARSE_RATIO)
+
 
 /******************************************************
  ******************  Useful macros  *******************
@@ -2114,11 +2202,118 @@ typedef struct {
 #define MPFR_INC_PREC(P,X) \
   (MPFR_ASSERTN ((X) <= MPFR_PREC_MAX - (P)), (P) += (X))
 
+/* Ziv loop statistics: each Ziv loop has a (thread-local) record counting
+   the number of times the loop is entered and the total number of its
+   iterations, so that loops = iterations means that the rounding test
+   never failed. The records are linked into a per-thread list the first
+   time the loop is entered; see ziv_stats.c for the public interface.
+   They are updated only while the performance counters are enabled (see
+   below), so that the cost is otherwise the test of a thread-local
+   variable. */
+struct __mpfr_ziv_stat_s {
+  const char *name;
+  unsigned long loops, iterations;
+  struct __mpfr_ziv_stat_s *next;
+  int registered;
+};
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+__MPFR_DECLSPEC void mpfr_ziv_stat_count (struct __mpfr_ziv_stat_s *, int);
+#if defined (__cplusplus)
+}
+#endif
+
+/* Limit on the memory held by the caches of the current thread (see
+   mpfr_memory_limit in free_cache.c). The caches are freed only when none
+   of them is in use: __gmpfr_cache_depth counts the computations of cached
+   values in progress (which may use other caches), and the limit is checked
+   by MPFR_MEMORY_CHECK on exit of mpfr_cache when this count is 0. */
+#if defined(__MPFR_WITHIN_MPFR)
+extern MPFR_THREAD_ATTR size_t __gmpfr_memory_limit;
+extern MPFR_THREAD_ATTR int __gmpfr_cache_depth;
+#endif
+
+#define MPFR_MEMORY_CHECK()                                             \
+  (MPFR_UNLIKELY (__gmpfr_memory_limit != 0) && __gmpfr_cache_depth == 0 \
+   ? mpfr_memory_check () : (void) 0)
+
+/* Runtime performance counters (see perf.c): when enabled in the current
+   thread with mpfr_perf_enable, each function starting with MPFR_PERF_FUNC
+   counts its calls, the precision p given to MPFR_PERF_FUNC (usually the
+   target precision), the Ziv loops and iterations done during the call,
+   and its time. Only the outermost call of such functions is counted, so
+   that the times of different functions do not overlap. MPFR_PERF_FUNC
+   must be the last declaration of the function. When disabled, the cost
+   is a test of a thread-local variable at the entry and at the exit.
+   The time needs the cleanup attribute; without it, only the calls and
+   the precisions are counted. */
+struct __mpfr_perf_s {
+  mpfr_perf_t d;
+  struct __mpfr_perf_s *next;
+  int registered;
+};
+
+#if defined(__MPFR_WITHIN_MPFR)
+extern MPFR_THREAD_ATTR int __gmpfr_perf_enabled;
+extern MPFR_THREAD_ATTR struct __mpfr_perf_s *__gmpfr_perf_current;
+#endif
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+__MPFR_DECLSPEC struct __mpfr_perf_s *mpfr_perf_enter
+  (struct __mpfr_perf_s *, mpfr_prec_t);
+__MPFR_DECLSPEC void mpfr_perf_leave (struct __mpfr_perf_s **);
+#if defined (__cplusplus)
+}
+#endif
+
+#if __MPFR_GNUC(3,3)
+# define MPFR_PERF_TIMING 1
+static __inline__ void
+mpfr_perf_cleanup (struct __mpfr_perf_s **r)
+{
+  if (MPFR_UNLIKELY (*r != NULL))
+    mpfr_perf_leave (r);
+}
+# define MPFR_PERF_CLEANUP_ATTR __attribute__ ((cleanup (mpfr_perf_cleanup)))
+#else
+# define MPFR_PERF_CLEANUP_ATTR MPFR_MAYBE_UNUSED
+#endif
+
+#define MPFR_PERF_FUNC(p)                                               \
+  static MPFR_THREAD_ATTR struct __mpfr_perf_s __gmpfr_perf_rec =       \
+    { { __func__, 0, { 0 }, 0, 0, 0.0 }, NULL, 0 };                     \
+  struct __mpfr_perf_s *__gmpfr_perf_top MPFR_PERF_CLEANUP_ATTR =       \
+    MPFR_UNLIKELY (__gmpfr_perf_enabled) ?                              \
+    mpfr_perf_enter (&__gmpfr_perf_rec, (p)) : NULL
+
+/* The Ziv loops count their entries and iterations (in the record of the
+   loop and in the performance counters) with mpfr_ziv_stat_count, only
+   while the performance counters are enabled. The test suite (which may
+   use Ziv loops) cannot access the thread-local variables of the library
+   with Windows DLLs. */
+#define MPFR_ZIV_STAT_DECL(_x)                                          \
+  static MPFR_THREAD_ATTR struct __mpfr_ziv_stat_s _x ## _stat =        \
+    { __func__, 0, 0, NULL, 0 }
+#if defined(__MPFR_WITHIN_MPFR)
+# define MPFR_ZIV_STAT_COUNT(_x, _first)                                \
+  (MPFR_UNLIKELY (__gmpfr_perf_enabled) ?                               \
+   mpfr_ziv_stat_count (&_x ## _stat, (_first)) : (void) 0)
+#else
+# define MPFR_ZIV_STAT_COUNT(_x, _first) ((void) 0)
+#endif
+#define MPFR_ZIV_STAT_INIT(_x) MPFR_ZIV_STAT_COUNT (_x, 1)
+#define MPFR_ZIV_STAT_NEXT(_x) MPFR_ZIV_STAT_COUNT (_x, 0)
+
 #ifndef MPFR_USE_LOGGING
 
-#define MPFR_ZIV_DECL(_x) mpfr_prec_t _x
-#define MPFR_ZIV_INIT(_x, _p) (_x) = GMP_NUMB_BITS
-#define MPFR_ZIV_NEXT(_x, _p) (MPFR_INC_PREC (_p, _x), (_x) = (_p)/2)
+#define MPFR_ZIV_DECL(_x) mpfr_prec_t _x; MPFR_ZIV_STAT_DECL (_x)
+#define MPFR_ZIV_INIT(_x, _p) ((_x) = GMP_NUMB_BITS, MPFR_ZIV_STAT_INIT (_x))
+#define MPFR_ZIV_NEXT(_x, _p) (MPFR_INC_PREC (_p, _x), (_x) = (_p)/2, \
+                               MPFR_ZIV_STAT_NEXT (_x))
 #define MPFR_ZIV_FREE(x)
 
 #else
@@ -2139,6 +2334,7 @@ typedef struct {
 
 #define MPFR_ZIV_DECL(_x)                                               \
   mpfr_prec_t _x;                                                       \
+  MPFR_ZIV_STAT_DECL (_x);                                              \
   int _x ## _cpt = 1;                                                   \
   static unsigned long  _x ## _loop = 0, _x ## _bad = 0;                \
   static const char *_x ## _fname = __func__;                           \
@@ -2158,6 +2354,7 @@ typedef struct {
   do                                                                    \
     {                                                                   \
       (_x) = GMP_NUMB_BITS;                                             \
+      MPFR_ZIV_STAT_INIT (_x);                                          \
       if (mpfr_log_level >= 0)                                          \
         _x ## _loop ++;                                                 \
       LOG_PRINT (MPFR_LOG_ZIV_F, "%s:ZIV 1st prec=%Pd\n",               \
@@ -2170,6 +2367,7 @@ typedef struct {
     {                                                                   \
       MPFR_INC_PREC (_p, _x);                                           \
       (_x) = (_p) / 2;                                                  \
+      MPFR_ZIV_STAT_NEXT (_x);                                          \
       if (mpfr_log_level >= 0)                                          \
         _x ## _bad += (_x ## _cpt == 1);                                \
       _x ## _cpt ++;                                                    \
@@ -2530,6 +2728,8 @@ __MPFR_DECLSPEC void mpfr_init_cache (mpfr_cache_t,
 #endif
 __MPFR_DECLSPEC void mpfr_clear_cache (mpfr_cache_t);
 __MPFR_DECLSPEC int  mpfr_cache (mpfr_ptr, mpfr_cache_t, mpfr_rnd_t);
+__MPFR_DECLSPEC size_t mpfr_cache_size (mpfr_cache_t);
+__MPFR_DECLSPEC void mpfr_memory_check (void);
 
 __MPFR_DECLSPEC void mpfr_mulhigh_n (mpfr_limb_ptr, mpfr_limb_srcptr,
                                      mpfr_limb_srcptr, mp_size_t);
@@ -2545,14 +2745,36 @@ __MPFR_DECLSPEC int mpfr_round_p (mp_limb_t *, mp_size_t, mpfr_exp_t,
 
 __MPFR_DECLSPEC int mpfr_round_near_x (mpfr_ptr, mpfr_srcptr, mpfr_uexp_t, int,
                                        mpfr_rnd_t);
+
+#if !defined(MPFR_GENERIC_ABI) && GMP_NUMB_BITS == 64
+__MPFR_DECLSPEC int mpfr_exp_fixed (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_log_fixed (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_sin_fixed (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_cos_fixed (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+#endif
 __MPFR_DECLSPEC MPFR_COLD_FUNCTION_ATTR MPFR_NORETURN void
   mpfr_abort_prec_max (void);
 
 __MPFR_DECLSPEC void mpfr_rand_raw (mpfr_limb_ptr, gmp_randstate_t,
                                     mpfr_prec_t);
+__MPFR_DECLSPEC void mpfr_rand_buf_init (mpfr_rand_buf_ptr, gmp_randstate_t,
+                                         mpfr_uprec_t);
+__MPFR_DECLSPEC void mpfr_rand_buf_clear (mpfr_rand_buf_ptr);
+__MPFR_DECLSPEC void mpfr_rand_buf_get (mpfr_limb_ptr, mpfr_rand_buf_ptr,
+                                        mpfr_prec_t);
 
 __MPFR_DECLSPEC mpz_srcptr mpfr_bernoulli_cache (unsigned long);
 __MPFR_DECLSPEC void mpfr_bernoulli_freecache (void);
+__MPFR_DECLSPEC size_t mpfr_bernoulli_cachesize (void);
+
+__MPFR_DECLSPEC void mpfr_tmp_arena_free (void);
+
+__MPFR_DECLSPEC int mpfr_tune_cpuid (char *, int *, int *);
+
+__MPFR_DECLSPEC void mpfr_bsum_init (mpfr_bsum_ptr);
+__MPFR_DECLSPEC void mpfr_bsum_clear (mpfr_bsum_ptr);
+__MPFR_DECLSPEC void mpfr_bsum_extend (mpfr_bsum_ptr, mpz_srcptr, mpz_srcptr,
+                                       mpz_srcptr, unsigned long);
 
 __MPFR_DECLSPEC int mpfr_sincos_fast (mpfr_ptr, mpfr_ptr, mpfr_srcptr,
                                       mpfr_rnd_t);
@@ -2601,7 +2823,7 @@ __MPFR_DECLSPEC void flags_fout (FILE *, mpfr_flags_t);
 #endif
 
 #ifndef MPFR_POOL_NENTRIES
-# define MPFR_POOL_NENTRIES 32  /* default number of entries of the pool */
+# define MPFR_POOL_NENTRIES 16  /* default number of entries per class */
 #endif
 
 #if MPFR_POOL_NENTRIES && !defined(MPFR_POOL_DONT_REDEFINE)
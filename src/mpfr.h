@@ -275,6 +275,16 @@ typedef __mpfr_struct mpfr_t[1];
 typedef __mpfr_struct *mpfr_ptr;
 typedef const __mpfr_struct *mpfr_srcptr;
 
+/* Base prepared for several powers (see mpfr_pow_prepare). The fields
+   are not part of the API. */
+typedef struct {
+  __mpfr_struct _mpfr_base;
+  __mpfr_struct _mpfr_log;
+} __mpfr_pow_base_struct;
+
+typedef __mpfr_pow_base_struct mpfr_pow_base_t[1];
+typedef __mpfr_pow_base_struct *mpfr_pow_base_ptr;
+
 /* For those who need a direct and fast access to the sign field.
    However, it is not in the API, thus use it at your own risk: it
    might not be supported, or change name, in further versions!
@@ -297,6 +307,34 @@ typedef enum {
   MPFR_FREE_GLOBAL_CACHE = 2   /* 1 << 1 */
 } mpfr_free_cache_t;
 
+/* Performance counters of a function (see mpfr_perf_snapshot).
+   prec_hist[0] counts the calls with a target precision <= 64,
+   prec_hist[i] those with 2^(i+5) < precision <= 2^(i+6) for
+   0 < i < MPFR_PERF_NBUCKETS - 1, and the last bucket the larger ones. */
+#define MPFR_PERF_NBUCKETS 16
+typedef struct {
+  const char *name;
+  unsigned long calls;
+  unsigned long prec_hist[MPFR_PERF_NBUCKETS];
+  unsigned long ziv_loops;
+  unsigned long ziv_iterations;
+  double ticks;
+} mpfr_perf_t;
+
+/* Number of bytes held by the caches of the current thread (see
+   mpfr_memory_usage), and number of times they have been freed because
+   of the limit set by mpfr_memory_limit. */
+typedef struct {
+  size_t const_pi;
+  size_t const_log2;
+  size_t const_euler;
+  size_t const_catalan;
+  size_t bernoulli;
+  size_t pool;
+  size_t tmp;
+  unsigned long evictions;
+} mpfr_memory_usage_t;
+
 /* GMP defines:
     + size_t:                Standard size_t
     + __GMP_NOTHROW          For C++: can't throw .
@@ -413,8 +451,12 @@ __MPFR_DECLSPEC int mpfr_buildopt_float128_p     (void);
 __MPFR_DECLSPEC int mpfr_buildopt_decimal_p      (void);
 __MPFR_DECLSPEC int mpfr_buildopt_gmpinternals_p (void);
 __MPFR_DECLSPEC int mpfr_buildopt_sharedcache_p  (void);
+__MPFR_DECLSPEC int mpfr_buildopt_philox_p       (void);
 __MPFR_DECLSPEC MPFR_RETURNS_NONNULL const char *
   mpfr_buildopt_tune_case (void);
+__MPFR_DECLSPEC MPFR_RETURNS_NONNULL const char *
+  mpfr_get_tune_profile (void);
+__MPFR_DECLSPEC int mpfr_set_tune_profile (const char *);
 
 __MPFR_DECLSPEC mpfr_exp_t mpfr_get_emin     (void);
 __MPFR_DECLSPEC int        mpfr_set_emin     (mpfr_exp_t);
@@ -593,9 +635,21 @@ __MPFR_DECLSPEC int mpfr_grandom (mpfr_ptr, mpfr_ptr, gmp_randstate_t,
                                   mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_nrandom_v1 (mpfr_ptr, gmp_randstate_t, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_nrandom_v2 (mpfr_ptr, gmp_randstate_t, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_nrandom_v3 (mpfr_ptr, gmp_randstate_t, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_nrandom (mpfr_ptr, gmp_randstate_t, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_erandom (mpfr_ptr, gmp_randstate_t, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_urandomb (mpfr_ptr, gmp_randstate_t);
+__MPFR_DECLSPEC int mpfr_urandomb_vec (const mpfr_ptr *, unsigned long,
+                                       gmp_randstate_t);
+__MPFR_DECLSPEC int mpfr_urandom_vec (const mpfr_ptr *, int *, unsigned long,
+                                      gmp_randstate_t, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_nrandom_vec (const mpfr_ptr *, int *, unsigned long,
+                                      gmp_randstate_t, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_erandom_vec (const mpfr_ptr *, int *, unsigned long,
+                                      gmp_randstate_t, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_randinit_philox (gmp_randstate_t, unsigned long);
+__MPFR_DECLSPEC int mpfr_rand_philox_stream (gmp_randstate_t, unsigned long);
+__MPFR_DECLSPEC int mpfr_rand_philox_skip (gmp_randstate_t, unsigned long);
 
 __MPFR_DECLSPEC void mpfr_nextabove (mpfr_ptr);
 __MPFR_DECLSPEC void mpfr_nextbelow (mpfr_ptr);
@@ -620,6 +674,10 @@ __MPFR_DECLSPEC int mpfr_ui_pow_ui (mpfr_ptr, unsigned long, unsigned long,
 __MPFR_DECLSPEC int mpfr_ui_pow (mpfr_ptr, unsigned long, mpfr_srcptr,
                                  mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_pow_z (mpfr_ptr, mpfr_srcptr, mpz_srcptr, mpfr_rnd_t);
+__MPFR_DECLSPEC void mpfr_pow_prepare (mpfr_pow_base_ptr, mpfr_srcptr);
+__MPFR_DECLSPEC int mpfr_pow_apply (mpfr_ptr, mpfr_pow_base_ptr, mpfr_srcptr,
+                                    mpfr_rnd_t);
+__MPFR_DECLSPEC void mpfr_pow_clear (mpfr_pow_base_ptr);
 
 __MPFR_DECLSPEC int mpfr_sqrt (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_sqrt_ui (mpfr_ptr, unsigned long, mpfr_rnd_t);
@@ -670,12 +728,16 @@ __MPFR_DECLSPEC int mpfr_agm (mpfr_ptr, mpfr_srcptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_log (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_log2 (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_log10 (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_log_all (mpfr_ptr, mpfr_ptr, mpfr_ptr, mpfr_srcptr,
+                                  mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_log1p (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_log2p1 (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_log10p1 (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_log_ui (mpfr_ptr, unsigned long, mpfr_rnd_t);
 
 __MPFR_DECLSPEC int mpfr_exp (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_exp_recip (mpfr_ptr, mpfr_ptr, mpfr_srcptr,
+                                    mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_exp2 (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_exp10 (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_expm1 (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
@@ -778,6 +840,8 @@ __MPFR_DECLSPEC int mpfr_asin (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_atan (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_sin (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_sin_cos (mpfr_ptr, mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_sin_cos_tan (mpfr_ptr, mpfr_ptr, mpfr_ptr,
+                                      mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_cos (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_tan (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_atan2 (mpfr_ptr, mpfr_srcptr, mpfr_srcptr, mpfr_rnd_t);
@@ -823,6 +887,12 @@ __MPFR_DECLSPEC int mpfr_digamma (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_trigamma (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_zeta (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_zeta_ui (mpfr_ptr, unsigned long, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_zeta_vec (const mpfr_ptr *, int *,
+                                   const mpfr_ptr *, unsigned long,
+                                   mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_zeta_ui_range (const mpfr_ptr *, int *,
+                                        unsigned long, unsigned long,
+                                        mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_fac_ui (mpfr_ptr, unsigned long, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_j0 (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_j1 (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
@@ -830,6 +900,10 @@ __MPFR_DECLSPEC int mpfr_jn (mpfr_ptr, long, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_y0 (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_y1 (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_yn (mpfr_ptr, long, mpfr_srcptr, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_jn_range (const mpfr_ptr *, int *, unsigned long,
+                                   unsigned long, mpfr_srcptr, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_yn_range (const mpfr_ptr *, int *, unsigned long,
+                                   unsigned long, mpfr_srcptr, mpfr_rnd_t);
 
 __MPFR_DECLSPEC int mpfr_ai (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
 
@@ -856,11 +930,34 @@ __MPFR_DECLSPEC int mpfr_sum (mpfr_ptr, const mpfr_ptr *, unsigned long,
                               mpfr_rnd_t);
 __MPFR_DECLSPEC int mpfr_dot (mpfr_ptr, const mpfr_ptr *, const mpfr_ptr *,
                               unsigned long, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_poly_eval (mpfr_ptr, const mpfr_ptr *,
+                                    unsigned long, mpfr_srcptr, mpfr_rnd_t);
+__MPFR_DECLSPEC int mpfr_poly_eval_vec (const mpfr_ptr *, int *,
+                                        const mpfr_ptr *, unsigned long,
+                                        const mpfr_ptr *, unsigned long,
+                                        mpfr_rnd_t);
 
 __MPFR_DECLSPEC void mpfr_free_cache (void);
 __MPFR_DECLSPEC void mpfr_free_cache2 (mpfr_free_cache_t);
 __MPFR_DECLSPEC void mpfr_free_pool (void);
+__MPFR_DECLSPEC void mpfr_pool_config (size_t, size_t);
+__MPFR_DECLSPEC void mpfr_pool_stats (unsigned long *, unsigned long *,
+                                      size_t *);
+__MPFR_DECLSPEC void mpfr_pool_stats_reset (void);
+__MPFR_DECLSPEC void mpfr_tmp_arena_config (size_t);
+__MPFR_DECLSPEC void mpfr_tmp_arena_stats (size_t *, size_t *,
+                                           unsigned long *);
+__MPFR_DECLSPEC void mpfr_tmp_arena_stats_reset (void);
 __MPFR_DECLSPEC int mpfr_mp_memory_cleanup (void);
+__MPFR_DECLSPEC size_t mpfr_memory_usage (mpfr_memory_usage_t *);
+__MPFR_DECLSPEC size_t mpfr_memory_limit (size_t);
+
+__MPFR_DECLSPEC size_t mpfr_ziv_stats (const char **, unsigned long *,
+                                       unsigned long *, size_t);
+__MPFR_DECLSPEC void mpfr_ziv_stats_reset (void);
+__MPFR_DECLSPEC int mpfr_perf_enable (int);
+__MPFR_DECLSPEC size_t mpfr_perf_snapshot (mpfr_perf_t *, size_t);
+__MPFR_DECLSPEC void mpfr_perf_reset (void);
 
 __MPFR_DECLSPEC int mpfr_subnormalize (mpfr_ptr, int, mpfr_rnd_t);
 
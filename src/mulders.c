@@ -33,6 +33,9 @@ If not, see <https://www.gnu.org/licenses/>. */
 /* Don't use MPFR_MULHIGH_SIZE since it is handled by tuneup */
 #ifdef MPFR_MULHIGH_TAB_SIZE
 static short mulhigh_ktab[MPFR_MULHIGH_TAB_SIZE];
+#elif defined(MPFR_USE_TUNE_PROFILES)
+#define mulhigh_ktab (__gmpfr_tune_param->mulhigh_ktab)
+#define MPFR_MULHIGH_TAB_SIZE (__gmpfr_tune_param->mulhigh_size)
 #else
 static short mulhigh_ktab[] = {MPFR_MULHIGH_TAB};
 #define MPFR_MULHIGH_TAB_SIZE (numberof_const (mulhigh_ktab))
@@ -72,7 +75,7 @@ mpfr_mulhigh_n (mpfr_limb_ptr rp, mpfr_limb_srcptr np, mpfr_limb_srcptr mp,
 {
   mp_size_t k;
 
-  MPFR_STAT_STATIC_ASSERT (MPFR_MULHIGH_TAB_SIZE >= 8); /* so that 3*(n/4) > n/2 */
+  MPFR_TUNE_STATIC_ASSERT (MPFR_MULHIGH_TAB_SIZE >= 8); /* so that 3*(n/4) > n/2 */
   k = MPFR_LIKELY (n < MPFR_MULHIGH_TAB_SIZE) ? mulhigh_ktab[n] : 3*(n/4);
   /* Algorithm ShortMul from [1] requires k >= (n+3)/2, which translates
      into k >= (n+4)/2 in the C language. */
@@ -99,6 +102,9 @@ mpfr_mulhigh_n (mpfr_limb_ptr rp, mpfr_limb_srcptr np, mpfr_limb_srcptr mp,
 
 #ifdef MPFR_SQRHIGH_TAB_SIZE
 static short sqrhigh_ktab[MPFR_SQRHIGH_TAB_SIZE];
+#elif defined(MPFR_USE_TUNE_PROFILES)
+#define sqrhigh_ktab (__gmpfr_tune_param->sqrhigh_ktab)
+#define MPFR_SQRHIGH_TAB_SIZE (__gmpfr_tune_param->sqrhigh_size)
 #else
 static short sqrhigh_ktab[] = {MPFR_SQRHIGH_TAB};
 #define MPFR_SQRHIGH_TAB_SIZE (numberof_const (sqrhigh_ktab))
@@ -111,7 +117,7 @@ mpfr_sqrhigh_n (mpfr_limb_ptr rp, mpfr_limb_srcptr np, mp_size_t n)
 {
   mp_size_t k;
 
-  MPFR_STAT_STATIC_ASSERT (MPFR_SQRHIGH_TAB_SIZE > 2); /* ensures k < n */
+  MPFR_TUNE_STATIC_ASSERT (MPFR_SQRHIGH_TAB_SIZE > 2); /* ensures k < n */
   k = MPFR_LIKELY (n < MPFR_SQRHIGH_TAB_SIZE) ? sqrhigh_ktab[n]
     : (n+4)/2; /* ensures that k >= (n+3)/2 */
   MPFR_ASSERTD (k == -1 || k == 0 || (k >= (n+4)/2 && k < n));
@@ -138,6 +144,9 @@ mpfr_sqrhigh_n (mpfr_limb_ptr rp, mpfr_limb_srcptr np, mp_size_t n)
 
 #ifdef MPFR_DIVHIGH_TAB_SIZE
 static short divhigh_ktab[MPFR_DIVHIGH_TAB_SIZE];
+#elif defined(MPFR_USE_TUNE_PROFILES)
+#define divhigh_ktab (__gmpfr_tune_param->divhigh_ktab)
+#define MPFR_DIVHIGH_TAB_SIZE (__gmpfr_tune_param->divhigh_size)
 #else
 static short divhigh_ktab[] = {MPFR_DIVHIGH_TAB};
 #define MPFR_DIVHIGH_TAB_SIZE (numberof_const (divhigh_ktab))
@@ -226,6 +235,37 @@ mpfr_divhigh_n_basecase (mpfr_limb_ptr qp, mpfr_limb_ptr np,
   return qh;
 }
 
+#if __MPFR_GMP(6,0,0) && !defined(MPFR_USE_MINI_GMP)
+
+/* Put in {qp, n} the truncated quotient of N={np, 2*n} by D={dp, n},
+   with the most significant limb of the quotient as return value (0 or 1).
+   Assumes the most significant bit of D is set.
+
+   For large n, mpz_tdiv_q uses mpn_div_q, which is based on an
+   approximation of the inverse of D by Newton's iteration (Barrett's
+   division) and is faster than the ShortDiv algorithm below. Since the
+   quotient is exact, the error bound of mpfr_divhigh_n holds. */
+static mp_limb_t
+mpfr_divhigh_n_div_q (mpfr_limb_ptr qp, mpfr_limb_srcptr np,
+                      mpfr_limb_srcptr dp, mp_size_t n)
+{
+  mpz_t q, a, b;
+  mp_limb_t qh;
+
+  mpz_init2 (q, (n + 1) * GMP_NUMB_BITS);
+  mpz_tdiv_q (q, mpz_roinit_n (a, np, 2 * n), mpz_roinit_n (b, dp, n));
+  /* since N >= B^(2n-1) and D < B^n, we have N/D > B^(n-1) */
+  MPFR_ASSERTD (SIZ (q) == n || SIZ (q) == n + 1);
+  MPN_COPY (qp, PTR (q), n);
+  qh = SIZ (q) > n ? PTR (q)[n] : MPFR_LIMB_ZERO;
+  mpz_clear (q);
+  return qh;
+}
+
+#define MPFR_HAVE_DIVHIGH_DIV_Q 1
+
+#endif
+
 /* Put in {qp, n} an approximation of N={np, 2*n} divided by D={dp, n},
    with the most significant limb of the quotient as return value (0 or 1).
    Assumes the most significant bit of D is set. Clobbers N.
@@ -247,8 +287,17 @@ mpfr_divhigh_n (mpfr_limb_ptr qp, mpfr_limb_ptr np, mpfr_limb_ptr dp,
     (("n=%Pd", (mpfr_prec_t) n),
      ("k=%Pd qh=%Mu", (mpfr_prec_t) k, k == 0 ? MPFR_LIMB_ZERO : qh));
 
-  MPFR_STAT_STATIC_ASSERT (MPFR_DIVHIGH_TAB_SIZE >= 15); /* so that 2*(n/3) >= (n+4)/2 */
+  MPFR_TUNE_STATIC_ASSERT (MPFR_DIVHIGH_TAB_SIZE >= 15); /* so that 2*(n/3) >= (n+4)/2 */
   MPFR_ASSERTD(n >= 2);
+
+#ifdef MPFR_HAVE_DIVHIGH_DIV_Q
+  if (n >= MPFR_DIV_Q_THRESHOLD)
+    {
+      k = 0; /* for the logging */
+      return mpfr_divhigh_n_div_q (qp, np, dp, n);
+    }
+#endif
+
   k = MPFR_LIKELY (n < MPFR_DIVHIGH_TAB_SIZE) ? divhigh_ktab[n] : 2*(n/3);
 
   if (k == 0)
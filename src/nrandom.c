@@ -257,18 +257,15 @@ trunc_norm_bern (mpfr_random_deviate_t x, gmp_randstate_t r,
   return (n & 1U) == 0;
 }
 
-/* return a normal random deviate with mean 0 and variance 1 as a MPFR.
-   Version 1  */
-int
-mpfr_nrandom_v1 (mpfr_ptr z, gmp_randstate_t r, mpfr_rnd_t rnd)
+/* Version 1, with the deviate x and the temporaries p and q allocated
+   by the caller. */
+static int
+nrandom_v1 (mpfr_ptr z, gmp_randstate_t r, mpfr_rnd_t rnd,
+            mpfr_random_deviate_t x,
+            mpfr_random_deviate_t p, mpfr_random_deviate_t q)
 {
-  mpfr_random_deviate_t x, p, q;
-  int inex;
   unsigned long k, j;
 
-  mpfr_random_deviate_init (x);
-  mpfr_random_deviate_init (p);
-  mpfr_random_deviate_init (q);
   for (;;)
     {
       k = half_exp_geom (r, p, q);                   /* step 1 */
@@ -279,10 +276,24 @@ mpfr_nrandom_v1 (mpfr_ptr z, gmp_randstate_t r, mpfr_rnd_t rnd)
       if (j > k)
         break;
     }
+  /* steps 5, 6, 7 */
+  return mpfr_random_deviate_value (gmp_urandomb_ui (r, 1), k, x, z, r, rnd);
+}
+
+/* return a normal random deviate with mean 0 and variance 1 as a MPFR.
+   Version 1  */
+int
+mpfr_nrandom_v1 (mpfr_ptr z, gmp_randstate_t r, mpfr_rnd_t rnd)
+{
+  mpfr_random_deviate_t x, p, q;
+  int inex;
+
+  mpfr_random_deviate_init (x);
+  mpfr_random_deviate_init (p);
+  mpfr_random_deviate_init (q);
+  inex = nrandom_v1 (z, r, rnd, x, p, q);
   mpfr_random_deviate_clear (q);
   mpfr_random_deviate_clear (p);
-  /* steps 5, 6, 7 */
-  inex = mpfr_random_deviate_value (gmp_urandomb_ui (r, 1), k, x, z, r, rnd);
   mpfr_random_deviate_clear (x);
   return inex;
 }
@@ -333,6 +344,305 @@ mpfr_nrandom_v2 (mpfr_ptr z, gmp_randstate_t r, mpfr_rnd_t rnd)
   return inex;
 }
 
+/* Version 3: table-driven rejection on the leading bits, in the spirit of
+   the ziggurat method of Marsaglia and Tsang, but exact.
+
+   Let f(x) = exp(-x^2/2) for x >= 0.  The interval [0,4) is split into
+   256 strips [s*h, (s+1)*h) of width h = 2^-6, and x >= 4 is the tail.
+   With lambda = 1292/2^10 (slightly larger than the area under f), one
+   selects strip s with probability q[s] = Q[s]/2^31, the tail with
+   probability q[256] = Q[256]/2^31, and restarts with the remaining
+   probability (about 0.05%).  Then:
+
+   * For strip s, x = (s + u) * h with u uniform in (0,1), and x is
+     accepted with probability f(x) / C[s], where C[s] = lambda*q[s]/h.
+   * For the tail, x = 4 + E/4 with E an exponential deviate (sampled with
+     Algorithm E as in erandom.c), and x is accepted with probability
+     f(x) exp(4*(x-4)) / C[256], where C[256] = 4*lambda*q[256].
+
+   In both cases, the density of the accepted x is f(x) / lambda, so that
+   x has the half-normal distribution.  The integers Q[s] were computed as
+   ceil(2^31 h f(s*h) / lambda), and Q[256] as ceil(2^31 f(4) / (4*lambda)),
+   so that C[s] >= f(s*h) and C[256] >= f(4), i.e., the acceptance
+   probabilities are at most 1; the table zig_cq below contains the partial
+   sums Q[0] + ... + Q[s].  Since q[s] and lambda are dyadic, so is C[s] =
+   1292*Q[s]*2^(e-41), where e = 6 for the strips and e = 2 for the tail
+   (x = (n + u) 2^-e with n = 16 + floor(E) for the tail).
+
+   The acceptance test is V < f(x) / C[s], with V uniform in (0,1).  For
+   the strips, f(x) >= f((s+1)*h), and zig_l[s] = floor(2^32 f((s+1)*h) /
+   C[s]); thus if the first 32 bits w of V satisfy w < zig_l[s], x is
+   accepted without looking at u at all.  This happens with probability
+   about 1 - x*h, i.e., for about 99% of the samples, and the only random
+   bits used are then the 32 bits selecting the strip and the sign, the 32
+   bits of w, and the bits of u needed for the rounding of the result.
+   Otherwise (and always for the tail), the test is decided by zig_accept,
+   which bounds V and f(x) / C[s] with interval arithmetic, refining u and V
+   lazily until the intervals are disjoint. */
+
+#define ZIG_M 6          /* the strips have width h = 2^-ZIG_M */
+#define ZIG_N 256        /* number of strips */
+#define ZIG_X 4          /* the tail is x >= ZIG_X = ZIG_N * h */
+#define ZIG_LAMBDA 1292  /* lambda = ZIG_LAMBDA / 2^10 */
+
+static const unsigned long zig_cq[ZIG_N + 1] = {
+  0x0195cbb1, 0x032b8ab4, 0x04c123af, 0x06567d4f, 0x07eb7e4d, 0x09800d73,
+  0x0b1411a0, 0x0ca771cc, 0x0e3a150f, 0x0fcbe2a4, 0x115cc1ee, 0x12ec9a7c,
+  0x147b540d, 0x1608d697, 0x17950a48, 0x191fd78d, 0x1aa92714, 0x1c30e1d2,
+  0x1db6f106, 0x1f3b3e3c, 0x20bdb354, 0x223e3a83, 0x23bcbe57, 0x253929bb,
+  0x26b367fb, 0x282b64c6, 0x29a10c33, 0x2b144ac2, 0x2c850d60, 0x2df3416b,
+  0x2f5ed4b3, 0x30c7b57d, 0x322dd286, 0x33911b05, 0x34f17ead, 0x364eedaf,
+  0x37a958bd, 0x3900b109, 0x3a54e84a, 0x3ba5f0bc, 0x3cf3bd21, 0x3e3e40c3,
+  0x3f856f73, 0x40c93d8d, 0x42099ff8, 0x43468c24, 0x447ff80d, 0x45b5da3b,
+  0x46e829c2, 0x4816de41, 0x4941efe5, 0x4a695764, 0x4b8d0e02, 0x4cad0d8d,
+  0x4dc9505c, 0x4ee1d151, 0x4ff68bd7, 0x51077be0, 0x52149de5, 0x531deee4,
+  0x54236c5f, 0x5525145c, 0x5622e561, 0x571cde74, 0x5812ff19, 0x59054750,
+  0x59f3b793, 0x5ade50d4, 0x5bc5147a, 0x5ca80462, 0x5d8722d9, 0x5e62729b,
+  0x5f39f6d2, 0x600db311, 0x60ddab54, 0x61a9e3fc, 0x627261cc, 0x633729e8,
+  0x63f841d1, 0x64b5af62, 0x656f78ce, 0x6625a49d, 0x66d839a8, 0x67873f19,
+  0x6832bc65, 0x68dab94a, 0x697f3dce, 0x6a205239, 0x6abdff14, 0x6b584d25,
+  0x6bef456e, 0x6c82f128, 0x6d1359c1, 0x6da088d9, 0x6e2a883e, 0x6eb161eb,
+  0x6f352004, 0x6fb5ccd4, 0x703372c9, 0x70ae1c73, 0x7125d47e, 0x719aa5b4,
+  0x720c9af6, 0x727bbf3c, 0x72e81d91, 0x7351c112, 0x73b8b4ea, 0x741d0450,
+  0x747eba84, 0x74dde2d0, 0x753a8881, 0x7594b6e7, 0x75ec7954, 0x7641db18,
+  0x7694e77f, 0x76e5a9d0, 0x77342d4b, 0x77807d26, 0x77caa48d, 0x7812ae9e,
+  0x7858a66a, 0x789c96f1, 0x78de8b21, 0x791e8dd5, 0x795ca9d4, 0x7998e9cf,
+  0x79d3585f, 0x7a0c0004, 0x7a42eb25, 0x7a78240f, 0x7aabb4f1, 0x7adda7df,
+  0x7b0e06cd, 0x7b3cdb92, 0x7b6a2fe4, 0x7b960d5a, 0x7bc07d68, 0x7be98961,
+  0x7c113a76, 0x7c3799b5, 0x7c5cb008, 0x7c808634, 0x7ca324dc, 0x7cc4947c,
+  0x7ce4dd6c, 0x7d0407df, 0x7d221be1, 0x7d3f215a, 0x7d5b200b, 0x7d761f8f,
+  0x7d90275c, 0x7da93ec1, 0x7dc16ce8, 0x7dd8b8d4, 0x7def2962, 0x7e04c54b,
+  0x7e199320, 0x7e2d994f, 0x7e40de1f, 0x7e5367b2, 0x7e653c07, 0x7e7660f8,
+  0x7e86dc3a, 0x7e96b35f, 0x7ea5ebd6, 0x7eb48aea, 0x7ec295c4, 0x7ed0116b,
+  0x7edd02c5, 0x7ee96e95, 0x7ef5597e, 0x7f00c804, 0x7f0bbe89, 0x7f164150,
+  0x7f20547e, 0x7f29fc1a, 0x7f333c0c, 0x7f3c181f, 0x7f449402, 0x7f4cb348,
+  0x7f547967, 0x7f5be9ba, 0x7f630783, 0x7f69d5e8, 0x7f7057f7, 0x7f7690a4,
+  0x7f7c82cc, 0x7f823134, 0x7f879e88, 0x7f8ccd5f, 0x7f91c039, 0x7f967981,
+  0x7f9afb8d, 0x7f9f489d, 0x7fa362df, 0x7fa74c6c, 0x7fab074b, 0x7fae9570,
+  0x7fb1f8bd, 0x7fb53302, 0x7fb84600, 0x7fbb3365, 0x7fbdfcd1, 0x7fc0a3d3,
+  0x7fc329ec, 0x7fc5908e, 0x7fc7d91d, 0x7fca04ee, 0x7fcc154b, 0x7fce0b6f,
+  0x7fcfe889, 0x7fd1adbd, 0x7fd35c22, 0x7fd4f4c5, 0x7fd678a7, 0x7fd7e8be,
+  0x7fd945f8, 0x7fda9137, 0x7fdbcb55, 0x7fdcf522, 0x7fde0f65, 0x7fdf1add,
+  0x7fe01840, 0x7fe1083e, 0x7fe1eb7d, 0x7fe2c29d, 0x7fe38e37, 0x7fe44edd,
+  0x7fe5051b, 0x7fe5b176, 0x7fe6546c, 0x7fe6ee78, 0x7fe7800d, 0x7fe80999,
+  0x7fe88b86, 0x7fe90638, 0x7fe97a0f, 0x7fe9e766, 0x7fea4e95, 0x7feaafee,
+  0x7feb0bbf, 0x7feb6254, 0x7febb3f4, 0x7fec00e3, 0x7fec4961, 0x7fec8dac,
+  0x7feccdfe, 0x7fed0a8e, 0x7fed4391, 0x7fed7939, 0x7fedabb5, 0x7feddb32,
+  0x7fee07db, 0x7fee31d9, 0x7fee5952, 0x7fee7e6a, 0x7ff0ac00
+};
+
+static const unsigned long zig_l[ZIG_N] = {
+  0xfff7fff6, 0xffe800db, 0xffd802c7, 0xffc805ce, 0xffb809dc, 0xffa80eb0,
+  0xff98147c, 0xff881be0, 0xff782400, 0xff682d05, 0xff5836d2, 0xff48419f,
+  0xff384df2, 0xff285aa9, 0xff1868c3, 0xff087784, 0xfef88798, 0xfee89875,
+  0xfed8aa3e, 0xfec8bdb3, 0xfeb8d189, 0xfea8e640, 0xfe98fc21, 0xfe891329,
+  0xfe792af7, 0xfe69440c, 0xfe595db7, 0xfe4978b1, 0xfe399502, 0xfe29b1e7,
+  0xfe19cfca, 0xfe09eecd, 0xfdfa0eb4, 0xfdea2f78, 0xfdda5135, 0xfdca7413,
+  0xfdba976d, 0xfdaabca2, 0xfd9ae29d, 0xfd8b095a, 0xfd7b3118, 0xfd6b597c,
+  0xfd5b83bd, 0xfd4baeb6, 0xfd3bd9ce, 0xfd2c0684, 0xfd1c345a, 0xfd0c6319,
+  0xfcfc92af, 0xfcecc3f2, 0xfcdcf524, 0xfccd2892, 0xfcbd5c01, 0xfcad9034,
+  0xfc9dc656, 0xfc8dfd2a, 0xfc7e3471, 0xfc6e6cdd, 0xfc5ea621, 0xfc4ee0b2,
+  0xfc3f1cbb, 0xfc2f5904, 0xfc1f96b6, 0xfc0fd567, 0xfc0014eb, 0xfbf05540,
+  0xfbe0967a, 0xfbd0d8ab, 0xfbc11ce4, 0xfbb160bf, 0xfba1a5eb, 0xfb91ecad,
+  0xfb8233b0, 0xfb727c8b, 0xfb62c5e6, 0xfb531014, 0xfb435be2, 0xfb33a80d,
+  0xfb23f4e1, 0xfb144304, 0xfb049214, 0xfaf4e1e6, 0xfae533e8, 0xfad58585,
+  0xfac5d87a, 0xfab62d4e, 0xfaa681a4, 0xfa96d7af, 0xfa872ec0, 0xfa7787d0,
+  0xfa67e0b8, 0xfa583aa2, 0xfa489539, 0xfa38f04c, 0xfa294da5, 0xfa19abc3,
+  0xfa0a0b2a, 0xf9fa6ad4, 0xf9eacc04, 0xf9db2c83, 0xf9cb90b4, 0xf9bbf35d,
+  0xf9ac5841, 0xf99cbda5, 0xf98d24e3, 0xf97d8bdf, 0xf96df3ef, 0xf95e5d77,
+  0xf94eca77, 0xf93f3469, 0xf92fa0c3, 0xf9200f71, 0xf9107d06, 0xf900eb37,
+  0xf8f15bbe, 0xf8e1cd76, 0xf8d23f4b, 0xf8c2b3b5, 0xf8b3275c, 0xf8a39e45,
+  0xf8941360, 0xf88489ad, 0xf8750266, 0xf8657cf6, 0xf855f6f2, 0xf846702c,
+  0xf836eb5b, 0xf8276a6f, 0xf817ea2e, 0xf8086655, 0xf7f8e82a, 0xf7e9663d,
+  0xf7d9ea9e, 0xf7ca6c16, 0xf7baf17b, 0xf7ab72df, 0xf79bfa5d, 0xf78c835d,
+  0xf77d0b09, 0xf76d90fa, 0xf75e1807, 0xf74ea72d, 0xf73f2e0d, 0xf72fbc3e,
+  0xf7204a42, 0xf710d552, 0xf70168e0, 0xf6f1f703, 0xf6e28907, 0xf6d31fa0,
+  0xf6c3b198, 0xf6b447db, 0xf6a4d886, 0xf6956dfa, 0xf6860a3a, 0xf6769a30,
+  0xf6673902, 0xf657caf0, 0xf64865a7, 0xf6390b04, 0xf629a535, 0xf61a3bce,
+  0xf60adc6f, 0xf5fb7d29, 0xf5ec1837, 0xf5dcbe18, 0xf5cd660d, 0xf5be0d64,
+  0xf5aea636, 0xf59f50b1, 0xf58ffe47, 0xf5809280, 0xf5713a16, 0xf561ef38,
+  0xf5529ee6, 0xf5433fca, 0xf533ef5d, 0xf524a7b9, 0xf515545b, 0xf505ed58,
+  0xf4f69a23, 0xf4e759a7, 0xf4d7f883, 0xf4c8b98f, 0xf4b96a8c, 0xf4aa340b,
+  0xf49ae194, 0xf48b7779, 0xf47c40fa, 0xf46cf4e9, 0xf45db954, 0xf44e7054,
+  0xf43f133a, 0xf42ff144, 0xf4209a9f, 0xf41164de, 0xf4021485, 0xf3f2c9c4,
+  0xf3e387e1, 0xf3d47866, 0xf3c50620, 0xf3b5f2d0, 0xf3a69d0d, 0xf3978042,
+  0xf3883cf1, 0xf378f2d9, 0xf3698dc3, 0xf35a9699, 0xf34b0e1d, 0xf33be2a8,
+  0xf32ce4f6, 0xf31d8897, 0xf30e7d20, 0xf2ff0b08, 0xf2efcfb5, 0xf2e1215a,
+  0xf2d191fd, 0xf2c292d5, 0xf2b3159c, 0xf2a3b5b2, 0xf2949e4e, 0xf2856538,
+  0xf276c825, 0xf266f589, 0xf2584510, 0xf2496af2, 0xf23a501c, 0xf22b2f45,
+  0xf21b5607, 0xf20bab89, 0xf1fdac4d, 0xf1ed42af, 0xf1de0f37, 0xf1cfb3fc,
+  0xf1c04142, 0xf1b1a862, 0xf1a294e5, 0xf194011b, 0xf182e783, 0xf1736ba4,
+  0xf165efdc, 0xf155cb1f, 0xf14682e9, 0xf136beca, 0xf128a241, 0xf1184dda,
+  0xf108eac9, 0xf0fb05a7, 0xf0eb9b96, 0xf0dbee76, 0xf0ce2c6e, 0xf0c095b9,
+  0xf0b187ea, 0xf09f928e, 0xf08fa87a, 0xf0823845
+};
+
+/* Set y to exp(-x^2/2) for the strips (tail = 0), and to
+   exp(-((x-ZIG_X)^2 + ZIG_X^2)/2) = f(x) exp(ZIG_X*(x-ZIG_X)) for the
+   tail, rounded in the direction rnd (MPFR_RNDD or MPFR_RNDU).  Both are
+   decreasing functions of x on their domain. */
+static void
+zig_phi (mpfr_ptr y, mpfr_srcptr x, int tail, mpfr_rnd_t rnd)
+{
+  mpfr_rnd_t rnd2 = MPFR_INVERT_RND (rnd);
+
+  if (tail)
+    {
+      /* x >= ZIG_X, thus x - ZIG_X is exact */
+      mpfr_sub_ui (y, x, ZIG_X, MPFR_RNDN);
+      mpfr_sqr (y, y, rnd2);
+      mpfr_add_ui (y, y, ZIG_X * ZIG_X, rnd2);
+    }
+  else
+    mpfr_sqr (y, x, rnd2);
+  mpfr_div_2ui (y, y, 1, MPFR_RNDN);
+  mpfr_neg (y, y, MPFR_RNDN);
+  mpfr_exp (y, y, rnd);
+}
+
+/* Return 1 with probability phi(x) / C, where phi is given by zig_phi,
+   x = (n + u) 2^-e, C = ZIG_LAMBDA*q*2^(e-41), and the first 32 bits of
+   the uniform deviate V are w, i.e., V = (w + v) 2^-32.  The deviates u and
+   v are refined as needed (u is kept for the result). */
+static int
+zig_accept (unsigned long w, unsigned long n, int e, unsigned long q,
+            int tail, mpfr_random_deviate_t u, gmp_randstate_t r)
+{
+  mpfr_random_deviate_t v;
+  mpfr_t xl, xh, vl, vh;
+  mpfr_prec_t prec;
+  int acc;
+  MPFR_SAVE_EXPO_DECL (expo);
+
+  MPFR_SAVE_EXPO_MARK (expo);
+  mpfr_random_deviate_init (v);
+  mpfr_inits2 (MPFR_PREC_MIN, xl, xh, vl, vh, (mpfr_ptr) 0);
+  for (prec = 64; ; prec += 64)
+    {
+      mpfr_set_prec (xl, prec);
+      mpfr_set_prec (xh, prec);
+      mpfr_set_prec (vl, prec);
+      mpfr_set_prec (vh, prec);
+
+      /* Since mpfr_random_deviate_value generates at least one bit after
+         the last bit of the result, rounding toward zero gives xl <= n + u
+         < xh = xl + ulp(xl), and similarly vl <= w + v < vh. */
+      mpfr_random_deviate_value (0, n, u, xl, r, MPFR_RNDD);
+      mpfr_set (xh, xl, MPFR_RNDN);
+      mpfr_nextabove (xh);
+      mpfr_mul_2si (xl, xl, -e, MPFR_RNDN);
+      mpfr_mul_2si (xh, xh, -e, MPFR_RNDN);
+      mpfr_random_deviate_value (0, w, v, vl, r, MPFR_RNDD);
+      mpfr_set (vh, vl, MPFR_RNDN);
+      mpfr_nextabove (vh);
+
+      /* accept if V*C < vh*C <= phi(xh) <= phi(x) */
+      mpfr_mul_ui (vh, vh, ZIG_LAMBDA, MPFR_RNDU);
+      mpfr_mul_ui (vh, vh, q, MPFR_RNDU);
+      mpfr_mul_2si (vh, vh, e - 73, MPFR_RNDU);
+      zig_phi (xh, xh, tail, MPFR_RNDD);
+      if (mpfr_cmp (vh, xh) <= 0)
+        {
+          acc = 1;
+          break;
+        }
+
+      /* reject if V*C >= vl*C >= phi(xl) >= phi(x) */
+      mpfr_mul_ui (vl, vl, ZIG_LAMBDA, MPFR_RNDD);
+      mpfr_mul_ui (vl, vl, q, MPFR_RNDD);
+      mpfr_mul_2si (vl, vl, e - 73, MPFR_RNDD);
+      zig_phi (xl, xl, tail, MPFR_RNDU);
+      if (mpfr_cmp (vl, xl) >= 0)
+        {
+          acc = 0;
+          break;
+        }
+    }
+  mpfr_clears (xl, xh, vl, vh, (mpfr_ptr) 0);
+  mpfr_random_deviate_clear (v);
+  MPFR_SAVE_EXPO_FREE (expo);
+  return acc;
+}
+
+/* return a normal random deviate with mean 0 and variance 1 as a MPFR.
+   Version 3, see above. */
+int
+mpfr_nrandom_v3 (mpfr_ptr z, gmp_randstate_t r, mpfr_rnd_t rnd)
+{
+  mpfr_random_deviate_t u, p, q;
+  unsigned long t, n, s, lo, hi;
+  int neg, e, tail = 0, inex;
+  MPFR_SAVE_EXPO_DECL (expo);
+
+  mpfr_random_deviate_init (u);
+  for (;;)
+    {
+      /* select the strip s (or the tail if s = ZIG_N) and the sign */
+      t = gmp_urandomb_ui (r, 32);
+      neg = t & 1;
+      t >>= 1;
+      if (t >= zig_cq[ZIG_N])
+        continue;
+      /* binary search for the smallest s such that t < zig_cq[s] */
+      lo = 0;
+      hi = ZIG_N;
+      while (lo < hi)
+        {
+          s = (lo + hi) / 2;
+          if (t < zig_cq[s])
+            hi = s;
+          else
+            lo = s + 1;
+        }
+      s = lo;
+
+      mpfr_random_deviate_reset (u);
+      if (s < ZIG_N)
+        {
+          n = s;
+          e = ZIG_M;
+          t = gmp_urandomb_ui (r, 32);
+          if (t < zig_l[s])
+            break;
+        }
+      else
+        {
+          /* x = ZIG_X + E/ZIG_X = (ZIG_X^2 + n + u) / ZIG_X, where n + u is
+             an exponential deviate */
+          if (! tail)
+            {
+              mpfr_random_deviate_init (p);
+              mpfr_random_deviate_init (q);
+              tail = 1;
+            }
+          for (n = ZIG_X * ZIG_X; ! trunc_exp_bern (u, r, p, q); n++)
+            {
+              /* Catch n wrapping around to 0. */
+              MPFR_ASSERTN (n + 1 != 0UL);
+              mpfr_random_deviate_reset (u);
+            }
+          e = 2;  /* ZIG_X = 2^e */
+          t = gmp_urandomb_ui (r, 32);
+        }
+      if (zig_accept (t, n, e, zig_cq[s] - (s == 0 ? 0 : zig_cq[s - 1]),
+                      s == ZIG_N, u, r))
+        break;
+    }
+  if (tail)
+    {
+      mpfr_random_deviate_clear (q);
+      mpfr_random_deviate_clear (p);
+    }
+
+  /* the result is (n + u) 2^-e, with the sign given by neg */
+  MPFR_SAVE_EXPO_MARK (expo);
+  inex = mpfr_random_deviate_value (neg, n, u, z, r, rnd);
+  mpfr_random_deviate_clear (u);
+  mpfr_mul_2si (z, z, -e, rnd);  /* exact */
+  MPFR_SAVE_EXPO_FREE (expo);
+  return mpfr_check_range (z, inex, rnd);
+}
+
 /* return a normal random deviate with mean 0 and variance 1 as a MPFR.
    Select the default version (currently Version 1). */
 int
@@ -340,3 +650,32 @@ mpfr_nrandom (mpfr_ptr z, gmp_randstate_t r, mpfr_rnd_t rnd)
 {
   return mpfr_nrandom_v1 (z, r, rnd);
 }
+
+/* Set z[0], ..., z[n-1] to normal random deviates; the results are the
+   same as with n successive calls to mpfr_nrandom, but the deviates used
+   by the algorithm are allocated only once. If inex is not a null pointer,
+   the ternary values are stored in inex[0], ..., inex[n-1]. Return 0 iff
+   all the results are exact. */
+int
+mpfr_nrandom_vec (const mpfr_ptr *z, int *inex, unsigned long n,
+                  gmp_randstate_t r, mpfr_rnd_t rnd)
+{
+  mpfr_random_deviate_t x, p, q;
+  unsigned long i;
+  int ret = 0;
+
+  mpfr_random_deviate_init (x);
+  mpfr_random_deviate_init (p);
+  mpfr_random_deviate_init (q);
+  for (i = 0; i < n; i++)
+    {
+      int t = nrandom_v1 (z[i], r, rnd, x, p, q);
+      if (inex != NULL)
+        inex[i] = t;
+      ret |= t;
+    }
+  mpfr_random_deviate_clear (q);
+  mpfr_random_deviate_clear (p);
+  mpfr_random_deviate_clear (x);
+  return ret;
+}
@@ -0,0 +1,134 @@
+/* mpfr_perf_enable, mpfr_perf_snapshot, mpfr_perf_reset -- runtime counters
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#define MPFR_NEED_LONGLONG_H
+#include "mpfr-impl.h"
+
+#include <time.h>  /* for clock () */
+
+/* Whether the counters are enabled in the current thread. */
+MPFR_THREAD_ATTR int __gmpfr_perf_enabled = 0;
+
+/* Record of the outermost instrumented function being executed, if any,
+   when the counters are enabled (see MPFR_PERF_FUNC in mpfr-impl.h). */
+MPFR_THREAD_ATTR struct __mpfr_perf_s *__gmpfr_perf_current = NULL;
+
+/* List of the records of the current thread that have been used, and
+   the time at the entry of the current function. */
+static MPFR_THREAD_ATTR struct __mpfr_perf_s *perf_list = NULL;
+static MPFR_THREAD_ATTR unsigned long perf_start;
+
+/* Return a time in some arbitrary units, modulo ULONG_MAX + 1: the cycle
+   counter when it can be read directly (x86, ARM64), otherwise the
+   processor time given by clock(). */
+static unsigned long
+mpfr_perf_ticks (void)
+{
+#if __MPFR_GNUC(3,0) && (defined(__x86_64__) || defined(__i386__))
+  unsigned int lo, hi;
+  __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((unsigned long) hi << 16 << 16) | lo;
+#elif __MPFR_GNUC(3,0) && defined(__aarch64__)
+  unsigned long t;
+  __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (t));
+  return t;
+#else
+  return (unsigned long) clock ();
+#endif
+}
+
+struct __mpfr_perf_s *
+mpfr_perf_enter (struct __mpfr_perf_s *r, mpfr_prec_t p)
+{
+  int i;
+
+  if (__gmpfr_perf_current != NULL)
+    return NULL;  /* nested call */
+
+  if (MPFR_UNLIKELY (! r->registered))
+    {
+      r->next = perf_list;
+      r->registered = 1;
+      perf_list = r;
+    }
+
+  r->d.calls ++;
+  i = p <= 64 ? 0 : MPFR_INT_CEIL_LOG2 (p) - 6;
+  r->d.prec_hist[MIN (i, MPFR_PERF_NBUCKETS - 1)] ++;
+
+#ifdef MPFR_PERF_TIMING
+  __gmpfr_perf_current = r;
+  perf_start = mpfr_perf_ticks ();
+  return r;
+#else
+  /* without a cleanup, mpfr_perf_leave would not be called */
+  return NULL;
+#endif
+}
+
+void
+mpfr_perf_leave (struct __mpfr_perf_s **r)
+{
+  MPFR_ASSERTD (*r == __gmpfr_perf_current);
+  (*r)->d.ticks += (double) (mpfr_perf_ticks () - perf_start);
+  __gmpfr_perf_current = NULL;
+}
+
+int
+mpfr_perf_enable (int e)
+{
+  int old = __gmpfr_perf_enabled;
+
+  __gmpfr_perf_enabled = e != 0;
+  return old;
+}
+
+/* Return the number of functions called since the last reset, and store
+   the counters of the first n ones in tab[0..n-1]. */
+size_t
+mpfr_perf_snapshot (mpfr_perf_t *tab, size_t n)
+{
+  struct __mpfr_perf_s *r;
+  size_t k = 0;
+
+  for (r = perf_list; r != NULL; r = r->next)
+    if (r->d.calls != 0)
+      {
+        if (k < n)
+          tab[k] = r->d;
+        k++;
+      }
+  return k;
+}
+
+void
+mpfr_perf_reset (void)
+{
+  struct __mpfr_perf_s *r;
+  const char *name;
+
+  for (r = perf_list; r != NULL; r = r->next)
+    {
+      name = r->d.name;
+      memset (&r->d, 0, sizeof (mpfr_perf_t));
+      r->d.name = name;
+    }
+}
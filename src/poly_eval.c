@@ -0,0 +1,552 @@
+/* mpfr_poly_eval, mpfr_poly_eval_vec -- evaluation of a polynomial with
+   a single final rounding
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#define MPFR_NEED_LONGLONG_H
+#include "mpfr-impl.h"
+
+/* In the usual case, the value obtained with Horner's rule in a working
+   precision slightly larger than the target precision can be rounded (see
+   mpfr_poly_eval_horner below). Otherwise (cancellation, exact result,
+   huge or tiny x), the terms c[i]*x^i are computed in a working precision
+   w, and added with mpfr_sum, which rounds their sum only once, in a Ziv
+   loop. The powers of x are obtained with a product tree, as in Estrin's
+   scheme: x^i = x^floor(i/2) * x^ceil(i/2), so that all the powers are
+   known after n-2 multiplications, and each of them comes from at most
+   i-1 roundings.
+
+   The exponents of the terms can be outside the extended exponent range,
+   so that they are scaled: each term is computed as C[i]*X^i, where C[i]
+   and X are c[i] and x with their exponent set to 0 (thus without any
+   overflow or underflow), then multiplied by 2^(f[i]-f[k]), where
+   f[i] = EXP(c[i]) + i*EXP(x) and f[k] is the maximum of the f[i]. The
+   result is the sum of the scaled terms multiplied by 2^f[k], which may
+   overflow or underflow only at the end. A scaled term whose exponent
+   would be less than MPFR_EMIN_MIN is dropped: it is less than
+   2^(MPFR_EMIN_MIN-1) in absolute value.
+
+   Error analysis: let u = 2^(-w). If X is rounded to w bits, then each
+   term t[i] = C[i]*X^i*(1+theta) with |theta| <= (1+u)^(2n) - 1 <= 4nu
+   (i roundings for the leaves of the tree, i-1 for the internal nodes and
+   one for the product by C[i]). Thus, for 8nu <= 1/2, the error on the
+   sum of the terms is bounded by 4nu * sum(|C[i]*X^i|) <= 8nu * sum(|t[i]|)
+   <= 8n^2u * 2^E <= 2^(E+3+2 ceil(log2(n))-w), where E is the maximum
+   exponent of the scaled terms, and the dropped terms add less than
+   n * 2^MPFR_EMIN_MIN. Thus the scaled value is in [S-err,S+err], where
+   S is the exact sum of the scaled terms and err is a power of 2 bounding
+   the error. If S-err and S+err round to the same number with the same
+   nonzero ternary value (both are computed exactly by mpfr_sum, with err
+   as an additional term), then this is the rounding of the scaled value,
+   with this ternary value, even when the dropped terms are much smaller
+   than the working precision.
+
+   If all the operations are exact and no terms are dropped, the sum of the
+   terms is exact, so that mpfr_sum directly gives the correctly rounded
+   result and the ternary value: this is how the exact cases (for instance,
+   polynomials with integer coefficients at small integers) are detected. */
+
+/* Temporary area for n coefficients, allocated only for the Ziv loop and
+   the special values (t is NULL before): t[1..n-1] are the terms, and
+   tab[i] points to c[0] (or a copy of it) for i = 0, to t[i] for
+   0 < i < n, and to the error term for i = n. */
+typedef struct {
+  mpfr_t *t;
+  mpfr_ptr *tab;
+  unsigned long n;
+} mpfr_poly_work_t;
+
+static void
+mpfr_poly_work_init (mpfr_poly_work_t *work, unsigned long n)
+{
+  work->n = n;
+  work->t = NULL;
+}
+
+static void
+mpfr_poly_work_alloc (mpfr_poly_work_t *work)
+{
+  unsigned long i, n = work->n;
+
+  if (work->t != NULL)
+    return;
+  work->t = (mpfr_t *) mpfr_allocate_func (n * sizeof (mpfr_t));
+  work->tab = (mpfr_ptr *) mpfr_allocate_func ((n + 1) * sizeof (mpfr_ptr));
+  for (i = 1; i < n; i++)
+    {
+      mpfr_init2 (work->t[i], MPFR_PREC_MIN);
+      work->tab[i] = work->t[i];
+    }
+}
+
+static void
+mpfr_poly_work_clear (mpfr_poly_work_t *work)
+{
+  unsigned long i;
+
+  if (work->t == NULL)
+    return;
+  for (i = 1; i < work->n; i++)
+    mpfr_clear (work->t[i]);
+  mpfr_free_func (work->t, work->n * sizeof (mpfr_t));
+  mpfr_free_func (work->tab, (work->n + 1) * sizeof (mpfr_ptr));
+}
+
+/* Special case: x is NaN, an infinity or a zero, or some coefficient is
+   NaN or an infinity. Then each term is computed exactly as c[i]*p with
+   p = x^i if x is singular (NaN, an infinity or a zero), and p = +1 or -1
+   (the sign of x^i) otherwise: in this last case, some coefficient is not
+   a finite number, so that the values of the finite terms do not matter.
+   The result is the exact sum of the terms, as usual for mpfr_sum. */
+static int
+mpfr_poly_eval_singular (mpfr_ptr y, const mpfr_ptr *c, mpfr_srcptr x,
+                         mpfr_rnd_t rnd, mpfr_poly_work_t *work)
+{
+  mpfr_t p;
+  unsigned long i, n = work->n;
+  int neg;
+
+  mpfr_init2 (p, MPFR_PREC_MIN);
+  mpfr_poly_work_alloc (work);
+  work->tab[0] = c[0];
+  for (i = 1; i < n; i++)
+    {
+      neg = MPFR_IS_NEG (x) && (i & 1);
+      if (MPFR_IS_NAN (x))
+        MPFR_SET_NAN (p);
+      else if (MPFR_IS_INF (x))
+        mpfr_set_inf (p, neg ? -1 : 1);
+      else if (MPFR_IS_ZERO (x))
+        mpfr_set_zero (p, neg ? -1 : 1);
+      else
+        mpfr_set_si (p, neg ? -1 : 1, MPFR_RNDN);
+      mpfr_set_prec (work->t[i], MPFR_PREC (c[i]));
+      mpfr_mul (work->t[i], c[i], p, MPFR_RNDN);  /* exact */
+    }
+  mpfr_clear (p);
+  return mpfr_sum (y, work->tab, n, rnd);
+}
+
+/* First attempt: Horner's rule with mpfr_fma in precision w, a multiple
+   of the limb size, where x and the coefficients are first rounded to w
+   bits (unless they already have this precision), so that mpfr_fma can use
+   its fast code for equal precisions.
+   The computed value is sum(c[i]*x^i*(1+theta[i])) with
+   |theta[i]| <= (1+u)^(2n+1) - 1 (i+1 roundings for the coefficient and
+   x^i, and at most n for the fma's), thus the error is bounded by
+   2(2n+1)u * sum(|c[i]|*|x|^i) <= 2(2n+1)nu * 2^M, where M is the maximum
+   of EXP(c[i]) + i*EXP(x), i.e. at most 2^(M+3+2 ceil(log2(n))-w).
+   The bound on |EXP(x)| and n ensures that i*EXP(x) cannot overflow.
+   Return POLY_HORNER_FAIL if the result cannot be rounded (in particular
+   when it is exact), otherwise the ternary value. This must be called in
+   the extended exponent range.
+   If the exact value fits on PREC(y) bits, the rounding test fails for any
+   approximation, thus Horner's rule is not even tried: the exact value is
+   a multiple of 2^(f[i]-P(c[i])-i*P(x)), where f[i] = EXP(c[i]) + i*EXP(x)
+   and P(v) is the minimal precision of v (see mpfr_min_prec), and is less
+   than 2^(M+ceil(log2(n))) in absolute value. This is the usual case of
+   small integer data. */
+#define POLY_HORNER_EXP 1023
+#define POLY_HORNER_N 0x3ffff
+#define POLY_HORNER_FAIL 2
+
+static int
+mpfr_poly_eval_horner (mpfr_ptr y, const mpfr_ptr *c, unsigned long n,
+                       mpfr_srcptr x, mpfr_rnd_t rnd, int logn)
+{
+  mpfr_t r, xw, ci;
+  mpfr_srcptr xp;
+  mpfr_prec_t w, px, pi, rem;
+  mpfr_exp_t ex, m, mi, e;
+  unsigned long i;
+  int inex = POLY_HORNER_FAIL, fits;
+  MPFR_GROUP_DECL (group);
+  MPFR_BLOCK_DECL (flags);
+
+  ex = MPFR_GET_EXP (x);
+  m = MPFR_EXP_MIN;
+  for (i = 0; i < n; i++)
+    if (MPFR_NOTZERO (c[i]))
+      {
+        mi = MPFR_GET_EXP (c[i]) + (mpfr_exp_t) i * ex;
+        if (mi > m)
+          m = mi;
+      }
+  if (m == MPFR_EXP_MIN)  /* all the coefficients are zero */
+    return POLY_HORNER_FAIL;
+
+  /* check whether the exact value fits on PREC(y) bits, i.e. whether
+     (M - f[i]) + P(c[i]) + i*P(x) <= PREC(y) - ceil(log2(n)) for
+     all the nonzero coefficients, without any integer overflow */
+  px = mpfr_min_prec (x);
+  fits = MPFR_PREC (y) > logn;
+  for (i = 0; fits && i < n; i++)
+    if (MPFR_NOTZERO (c[i]))
+      {
+        rem = MPFR_PREC (y) - logn;
+        pi = mpfr_min_prec (c[i]);
+        mi = MPFR_GET_EXP (c[i]) + (mpfr_exp_t) i * ex;
+        fits = pi <= rem && i <= (unsigned long) ((rem - pi) / px) &&
+          m - mi <= rem - pi - (mpfr_prec_t) i * px;
+      }
+  if (fits)
+    return POLY_HORNER_FAIL;
+
+  w = MPFR_PREC (y) + 2 * logn + 12;
+  w = MPFR_PREC2LIMBS (w) * GMP_NUMB_BITS;
+  MPFR_GROUP_INIT_3 (group, w, r, xw, ci);
+  MPFR_BLOCK (flags,
+    {
+      if (MPFR_PREC (x) == w)
+        xp = x;
+      else
+        {
+          mpfr_set (xw, x, MPFR_RNDN);
+          xp = xw;
+        }
+      mpfr_set (r, c[n - 1], MPFR_RNDN);
+      for (i = n - 1; i-- > 0; )
+        if (MPFR_PREC (c[i]) == w)
+          mpfr_fma (r, r, xp, c[i], MPFR_RNDN);
+        else
+          {
+            mpfr_set (ci, c[i], MPFR_RNDN);
+            mpfr_fma (r, r, xp, ci, MPFR_RNDN);
+          }
+    });
+  if (MPFR_LIKELY (! MPFR_OVERFLOW (flags) && ! MPFR_UNDERFLOW (flags) &&
+                   MPFR_NOTZERO (r)))
+    {
+      e = m - MPFR_GET_EXP (r) + 3 + 2 * logn;
+      if (e < w && MPFR_CAN_ROUND (r, w - e, MPFR_PREC (y), rnd))
+        inex = mpfr_set (y, r, rnd);
+    }
+  MPFR_GROUP_CLEAR (group);
+  return inex;
+}
+
+/* Return ei - ek + (i - k) * ex if its absolute value is at most
+   MPFR_EMAX_MAX, otherwise MPFR_EXP_MIN or MPFR_EXP_MAX according to its
+   sign. The absolute value of ei - ek must be at most 2 MPFR_EMAX_MAX. */
+static mpfr_exp_t
+mpfr_poly_exp_diff (mpfr_exp_t ei, mpfr_exp_t ek, unsigned long i,
+                    unsigned long k, mpfr_exp_t ex)
+{
+  mpfr_uexp_t a, d, p;
+  unsigned long q;
+  int sd, sp;
+
+  d = SAFE_ABS (mpfr_uexp_t, ei - ek);
+  sd = ei >= ek;
+  q = i >= k ? i - k : k - i;
+  a = SAFE_ABS (mpfr_uexp_t, ex);
+  sp = (i >= k) == (ex >= 0);
+  /* if |(i - k) * ex| > 3 MPFR_EMAX_MAX, then the result is larger than
+     MPFR_EMAX_MAX in absolute value, with the sign of (i - k) * ex */
+  if (a != 0 && q > (mpfr_uexp_t) MPFR_EMAX_MAX * 3 / a)
+    return sp ? MPFR_EXP_MAX : MPFR_EXP_MIN;
+  p = (mpfr_uexp_t) q * a;
+  if (sp == sd)
+    {
+      if (p > (mpfr_uexp_t) MPFR_EMAX_MAX ||
+          d > (mpfr_uexp_t) MPFR_EMAX_MAX - p)
+        return sd ? MPFR_EXP_MAX : MPFR_EXP_MIN;
+      d += p;
+    }
+  else if (p >= d)
+    {
+      d = p - d;
+      sd = sp;
+    }
+  else
+    d -= p;
+  if (d > (mpfr_uexp_t) MPFR_EMAX_MAX)
+    return sd ? MPFR_EXP_MAX : MPFR_EXP_MIN;
+  return sd ? (mpfr_exp_t) d : - (mpfr_exp_t) d;
+}
+
+static int mpfr_poly_eval_ziv (mpfr_ptr, const mpfr_ptr *, mpfr_srcptr,
+                               mpfr_rnd_t, mpfr_poly_work_t *, mpfr_exp_t *);
+
+/* Case where the n scaled terms tab[0..n-1] are exact, but some of them
+   have been dropped (set to zero while the coefficient is not zero). The
+   sign of the sum of the dropped terms is determined recursively (this
+   terminates since the largest term is never dropped), and this sum is
+   replaced by 2^(MPFR_EMIN_MIN-1) with this sign, stored in tab[n] = tmp.
+   This does not change the rounding, unless the sum of the other terms is
+   within n*2^MPFR_EMIN_MIN of a rounding boundary without being on it,
+   which needs a cancellation of about -MPFR_EMIN_MIN bits. */
+static int
+mpfr_poly_eval_dropped (mpfr_ptr y, const mpfr_ptr *c, unsigned long n,
+                        mpfr_srcptr x, mpfr_rnd_t rnd, mpfr_ptr *tab,
+                        mpfr_ptr tmp)
+{
+  mpfr_poly_work_t work;
+  mpfr_ptr *cd;
+  mpfr_t zero, sd;
+  mpfr_exp_t e;
+  unsigned long i;
+
+  mpfr_init2 (zero, MPFR_PREC_MIN);
+  mpfr_init2 (sd, MPFR_PREC_MIN);
+  MPFR_SET_ZERO (zero);
+  MPFR_SET_POS (zero);
+  cd = (mpfr_ptr *) mpfr_allocate_func (n * sizeof (mpfr_ptr));
+  for (i = 0; i < n; i++)
+    cd[i] = MPFR_IS_ZERO (tab[i]) && MPFR_NOTZERO (c[i]) ? c[i] : zero;
+  mpfr_poly_work_init (&work, n);
+  mpfr_poly_eval_ziv (sd, cd, x, MPFR_RNDZ, &work, &e);
+  mpfr_poly_work_clear (&work);
+  mpfr_free_func (cd, n * sizeof (mpfr_ptr));
+  if (MPFR_NOTZERO (sd))
+    {
+      mpfr_set_si_2exp (tmp, MPFR_IS_POS (sd) ? 1 : -1, MPFR_EMIN_MIN - 1,
+                        MPFR_RNDN);
+      tab[n++] = tmp;
+    }
+  mpfr_clears (zero, sd, (mpfr_ptr) 0);
+  return mpfr_sum (y, tab, n, rnd);
+}
+
+/* Ziv loop on the scaled terms (see the beginning of this file). Set y to
+   the correct rounding of the value with its exponent replaced by some
+   exponent in the extended exponent range, and *ey to the actual exponent
+   (MPFR_EXP_MIN or MPFR_EXP_MAX if it is less than -MPFR_EMAX_MAX or
+   larger than MPFR_EMAX_MAX), unless the result is zero. Return the
+   ternary value. This must be called in the extended exponent range. */
+static int
+mpfr_poly_eval_ziv (mpfr_ptr y, const mpfr_ptr *c, mpfr_srcptr x,
+                    mpfr_rnd_t rnd, mpfr_poly_work_t *work, mpfr_exp_t *ey)
+{
+  mpfr_t xm, cm, c0, z1, z2, err;
+  mpfr_ptr *tab;
+  mpfr_t *t;
+  unsigned long i, k, n = work->n;
+  mpfr_prec_t w;
+  mpfr_exp_t ex, d, e, emax;
+  mpfr_rnd_t rnd2;
+  int inex, inex2, logn, exact, dropped;
+  MPFR_GROUP_DECL (group);
+  MPFR_ZIV_DECL (loop);
+
+  logn = MPFR_INT_CEIL_LOG2 (n);
+  ex = MPFR_GET_EXP (x);
+  MPFR_ALIAS (xm, x, MPFR_SIGN (x), 0);
+
+  /* k such that f[k] is maximal, or n if all the coefficients are zero */
+  k = n;
+  for (i = 0; i < n; i++)
+    if (MPFR_NOTZERO (c[i]) &&
+        (k == n || mpfr_poly_exp_diff (MPFR_GET_EXP (c[i]),
+                                       MPFR_GET_EXP (c[k]), i, k, ex) > 0))
+      k = i;
+
+  mpfr_poly_work_alloc (work);
+  tab = work->tab;
+  t = work->t;
+  w = MPFR_PREC (y) + 2 * logn + 10;
+  /* a correct rounding is a faithful rounding */
+  rnd2 = rnd == MPFR_RNDF ? MPFR_RNDZ : rnd;
+  MPFR_GROUP_INIT_3 (group, MPFR_PREC (y), z1, z2, err);
+  MPFR_ZIV_INIT (loop, w);
+  for (;;)
+    {
+      for (i = 1; i < n; i++)
+        mpfr_set_prec (t[i], w);
+      exact = mpfr_set (t[1], xm, MPFR_RNDN) == 0;
+      for (i = 2; i < n; i++)
+        exact &= ((i & 1) ?
+                  mpfr_mul (t[i], t[i >> 1], t[(i >> 1) + 1], MPFR_RNDN) :
+                  mpfr_sqr (t[i], t[i >> 1], MPFR_RNDN)) == 0;
+      /* the powers are no longer needed: multiply by the coefficients in
+         place */
+      for (i = 1; i < n; i++)
+        if (MPFR_IS_ZERO (c[i]))
+          mpfr_mul (t[i], t[i], c[i], MPFR_RNDN);
+        else
+          {
+            MPFR_ALIAS (cm, c[i], MPFR_SIGN (c[i]), 0);
+            exact &= mpfr_mul (t[i], t[i], cm, MPFR_RNDN) == 0;
+          }
+      if (MPFR_IS_ZERO (c[0]))
+        tab[0] = c[0];
+      else
+        {
+          MPFR_ALIAS (c0, c[0], MPFR_SIGN (c[0]), 0);
+          tab[0] = c0;
+        }
+
+      /* scale the terms */
+      dropped = 0;
+      emax = MPFR_EXP_MIN;
+      for (i = 0; i < n; i++)
+        if (MPFR_NOTZERO (tab[i]))
+          {
+            d = mpfr_poly_exp_diff (MPFR_GET_EXP (c[i]), MPFR_GET_EXP (c[k]),
+                                    i, k, ex);
+            e = MPFR_GET_EXP (tab[i]);
+            if (d < MPFR_EMIN_MIN - e)
+              {
+                MPFR_SET_ZERO (tab[i]);
+                dropped = 1;
+              }
+            else
+              {
+                MPFR_SET_EXP (tab[i], e + d);
+                if (e + d > emax)
+                  emax = e + d;
+              }
+          }
+
+      if (exact && ! dropped)
+        {
+          inex = mpfr_sum (z1, tab, n, rnd);
+          break;
+        }
+      if (exact)
+        {
+          inex = mpfr_poly_eval_dropped (z1, c, n, x, rnd, tab, err);
+          break;
+        }
+
+      e = emax + 3 + 2 * logn - w;
+      if (dropped)
+        e = MAX (e, MPFR_EMIN_MIN + logn) + 1;
+      mpfr_set_ui_2exp (err, 1, e, MPFR_RNDN);
+      tab[n] = err;
+      inex = mpfr_sum (z1, tab, n + 1, rnd2);
+      MPFR_CHANGE_SIGN (err);
+      inex2 = mpfr_sum (z2, tab, n + 1, rnd2);
+      if (((inex > 0 && inex2 > 0) || (inex < 0 && inex2 < 0)) &&
+          mpfr_equal_p (z1, z2))
+        break;
+
+      MPFR_ZIV_NEXT (loop, w);
+    }
+  MPFR_ZIV_FREE (loop);
+
+  /* y may be x or some c[i] */
+  if (MPFR_NOTZERO (z1))
+    *ey = mpfr_poly_exp_diff (MPFR_GET_EXP (z1) + MPFR_GET_EXP (c[k]), 0,
+                              k, 0, ex);
+  mpfr_set (y, z1, MPFR_RNDN);  /* exact */
+  MPFR_GROUP_CLEAR (group);
+  return inex;
+}
+
+static int
+mpfr_poly_eval_aux (mpfr_ptr y, const mpfr_ptr *c, mpfr_srcptr x,
+                    mpfr_rnd_t rnd, mpfr_poly_work_t *work)
+{
+  unsigned long i, n = work->n;
+  mpfr_exp_t e;
+  int inex, logn;
+  MPFR_SAVE_EXPO_DECL (expo);
+
+  MPFR_ASSERTD (n >= 2);
+
+  if (MPFR_IS_SINGULAR (x))
+    return mpfr_poly_eval_singular (y, c, x, rnd, work);
+  for (i = 0; i < n; i++)
+    if (MPFR_IS_SINGULAR (c[i]) && ! MPFR_IS_ZERO (c[i]))
+      return mpfr_poly_eval_singular (y, c, x, rnd, work);
+
+  MPFR_SAVE_EXPO_MARK (expo);
+
+  logn = MPFR_INT_CEIL_LOG2 (n);
+  e = MPFR_GET_EXP (x);
+  if (e >= -POLY_HORNER_EXP && e <= POLY_HORNER_EXP &&
+      n <= POLY_HORNER_N)
+    {
+      inex = mpfr_poly_eval_horner (y, c, n, x, rnd, logn);
+      if (inex != POLY_HORNER_FAIL)
+        {
+          MPFR_SAVE_EXPO_FREE (expo);
+          return mpfr_check_range (y, inex, rnd);
+        }
+    }
+
+  inex = mpfr_poly_eval_ziv (y, c, x, rnd, work, &e);
+  MPFR_SAVE_EXPO_FREE (expo);
+  if (MPFR_IS_ZERO (y))
+    return inex;
+  if (e > __gmpfr_emax)
+    return mpfr_overflow (y, rnd, MPFR_SIGN (y));
+  if (e < __gmpfr_emin)
+    {
+      /* as in mpfr_mul_2si, y being rounded to its precision */
+      if (rnd == MPFR_RNDN &&
+          (e < __gmpfr_emin - 1 ||
+           ((MPFR_IS_NEG (y) ? inex <= 0 : inex >= 0) &&
+            mpfr_powerof2_raw (y))))
+        rnd = MPFR_RNDZ;
+      return mpfr_underflow (y, rnd, MPFR_SIGN (y));
+    }
+  MPFR_SET_EXP (y, e);
+  MPFR_RET (inex);
+}
+
+/* y <- c[0] + c[1]*x + ... + c[n-1]*x^(n-1) */
+int
+mpfr_poly_eval (mpfr_ptr y, const mpfr_ptr *c, unsigned long n,
+                mpfr_srcptr x, mpfr_rnd_t rnd)
+{
+  mpfr_poly_work_t work;
+  int inex;
+
+  MPFR_LOG_FUNC
+    (("n=%lu x[%Pd]=%.*Rg rnd=%d", n, mpfr_get_prec (x), mpfr_log_prec, x,
+      rnd),
+     ("y[%Pd]=%.*Rg inexact=%d", mpfr_get_prec (y), mpfr_log_prec, y, inex));
+
+  if (MPFR_UNLIKELY (n <= 1))
+    return inex = mpfr_sum (y, c, n, rnd);
+
+  mpfr_poly_work_init (&work, n);
+  inex = mpfr_poly_eval_aux (y, c, x, rnd, &work);
+  mpfr_poly_work_clear (&work);
+  return inex;
+}
+
+/* y[j] <- c[0] + c[1]*x[j] + ... + c[n-1]*x[j]^(n-1) for 0 <= j < m,
+   with a temporary area shared by all the evaluations */
+int
+mpfr_poly_eval_vec (const mpfr_ptr *y, int *inex, const mpfr_ptr *c,
+                    unsigned long n, const mpfr_ptr *x, unsigned long m,
+                    mpfr_rnd_t rnd)
+{
+  mpfr_poly_work_t work;
+  unsigned long j;
+  int ret = 0;
+
+  MPFR_LOG_FUNC (("n=%lu m=%lu rnd=%d", n, m, rnd), ("ret=%d", ret));
+
+  mpfr_poly_work_init (&work, n);
+  for (j = 0; j < m; j++)
+    {
+      int t = n >= 2 ? mpfr_poly_eval_aux (y[j], c, x[j], rnd, &work)
+        : mpfr_sum (y[j], c, n, rnd);
+      if (inex != NULL)
+        inex[j] = t;
+      ret |= t != 0;
+    }
+  mpfr_poly_work_clear (&work);
+  return ret;
+}
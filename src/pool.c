@@ -20,34 +20,86 @@ along with the GNU MPFR Library; see the file COPYING.LESSER.
 If not, see <https://www.gnu.org/licenses/>. */
 
 #define MPFR_POOL_DONT_REDEFINE
+#define MPFR_NEED_LONGLONG_H
 #include "mpfr-impl.h"
 
+/* The pool is made of MPFR_POOL_NCLASSES size classes: class c contains
+   up to MPFR_POOL_NENTRIES mpz_t whose allocated size ALLOC satisfies
+   2^c <= ALLOC < 2^(c+1) limbs. Thus mpfr_mpz_init2 can reuse a mpz_t
+   that is large enough for the requested precision, instead of a random
+   one that GMP would have to reallocate. The cached mpz_t are limited by
+   a maximal size (in limbs) and by a maximal total size (in bytes), both
+   configurable per thread with mpfr_pool_config. */
+
+#ifndef MPFR_POOL_NCLASSES
+# define MPFR_POOL_NCLASSES 16
+#endif
+
 #ifndef MPFR_POOL_MAX_SIZE
-# define MPFR_POOL_MAX_SIZE 32 /* maximal size (in limbs) for each entry */
+# define MPFR_POOL_MAX_SIZE 1024 /* default maximal size (in limbs) */
 #endif
 
+#ifndef MPFR_POOL_MAX_BYTES
+# define MPFR_POOL_MAX_BYTES 262144 /* default maximal total size (bytes) */
+#endif
+
+/* largest ALLOC that fits in a class */
+#define MPFR_POOL_CLASS_LIMIT (((size_t) 1 << MPFR_POOL_NCLASSES) - 1)
+
 /* If the number of entries of the mpz_t pool is not zero */
 #if MPFR_POOL_NENTRIES
 
-/* Index in the stack table of mpz_t and stack table of mpz_t */
-static MPFR_THREAD_ATTR int n_alloc = 0;
-static MPFR_THREAD_ATTR __mpz_struct mpz_tab[MPFR_POOL_NENTRIES];
+/* Number of entries of each class, stack table of mpz_t of each class,
+   and bit mask of the non-empty classes */
+static MPFR_THREAD_ATTR int n_alloc[MPFR_POOL_NCLASSES];
+static MPFR_THREAD_ATTR __mpz_struct
+  mpz_tab[MPFR_POOL_NCLASSES][MPFR_POOL_NENTRIES];
+static MPFR_THREAD_ATTR unsigned long pool_mask = 0;
+
+/* Current limits, number of bytes held by the pool and statistics */
+static MPFR_THREAD_ATTR size_t pool_max_limbs = MPFR_POOL_MAX_SIZE;
+static MPFR_THREAD_ATTR size_t pool_max_bytes = MPFR_POOL_MAX_BYTES;
+static MPFR_THREAD_ATTR size_t pool_bytes = 0;
+static MPFR_THREAD_ATTR unsigned long pool_hits = 0;
+static MPFR_THREAD_ATTR unsigned long pool_misses = 0;
+
+/* Return floor(log2(n)) for n >= 1. */
+static int
+floor_log2 (mp_limb_t n)
+{
+  int cnt;
+
+  MPFR_ASSERTD (n != 0);
+  count_leading_zeros (cnt, n);
+  return GMP_NUMB_BITS - 1 - cnt;
+}
+
+/* Pop an entry of the (non-empty) class c into z. */
+static void
+pool_pop (mpz_ptr z, int c)
+{
+  MPFR_ASSERTD (n_alloc[c] > 0 && n_alloc[c] <= MPFR_POOL_NENTRIES);
+  memcpy (z, &mpz_tab[c][--n_alloc[c]], sizeof (mpz_t));
+  SIZ(z) = 0;
+  if (n_alloc[c] == 0)
+    pool_mask &= ~(1UL << c);
+  pool_bytes -= (size_t) ALLOC(z) * MPFR_BYTES_PER_MP_LIMB;
+  pool_hits++;
+}
 
 MPFR_HOT_FUNCTION_ATTR void
 mpfr_mpz_init (mpz_ptr z)
 {
-  if (MPFR_LIKELY (n_alloc > 0))
+  if (MPFR_LIKELY (pool_mask != 0))
     {
-      /* Get a mpz_t from the MPFR stack of previously used mpz_t.
-         It reduces memory pressure, and it allows to reuse
-         a mpz_t that should be sufficiently big. */
-      MPFR_ASSERTD (n_alloc <= numberof (mpz_tab));
-      memcpy (z, &mpz_tab[--n_alloc], sizeof (mpz_t));
-      SIZ(z) = 0;
+      /* Get a mpz_t from the largest non-empty class: since the final
+         size is not known, this avoids realloc's as much as possible. */
+      pool_pop (z, floor_log2 ((mp_limb_t) pool_mask));
     }
   else
     {
       /* Call the real GMP function */
+      pool_misses++;
       mpz_init (z);
     }
 }
@@ -55,48 +107,91 @@ mpfr_mpz_init (mpz_ptr z)
 MPFR_HOT_FUNCTION_ATTR void
 mpfr_mpz_init2 (mpz_ptr z, mp_bitcnt_t n)
 {
-  /* The condition on n is used below as the argument n will be ignored if
-     the mpz_t is obtained from the MPFR stack of previously used mpz_t.
-     Said otherwise, it z is expected to have a large size at the end, then
-     it is better to allocate this size directly than to get a mpz_t of
-     small size, with possibly several realloc's on it. But if n satisfies
-     the condition and is larger than the stacked mpz_t, this may still
-     yield useless realloc's. This is not ideal. We might consider to use
-     mpz_init2 with the maximum size in mpfr_mpz_init to solve this issue. */
-  if (MPFR_LIKELY (n_alloc > 0 && n <= MPFR_POOL_MAX_SIZE * GMP_NUMB_BITS))
-    {
-      /* Get a mpz_t from the MPFR stack of previously used mpz_t.
-         It reduces memory pressure, and it allows to reuse
-         a mpz_t that should be sufficiently big. */
-      MPFR_ASSERTD (n_alloc <= numberof (mpz_tab));
-      memcpy (z, &mpz_tab[--n_alloc], sizeof (mpz_t));
-      SIZ(z) = 0;
-    }
-  else
+  mp_bitcnt_t l;
+  unsigned long m;
+  int c;
+
+  /* Get a mpz_t from the smallest non-empty class whose entries all have
+     at least l = ceil(n / GMP_NUMB_BITS) limbs, i.e., class ceil(log2(l)),
+     so that the argument n can be ignored without any realloc later. */
+  l = (n + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+  if (MPFR_LIKELY (l <= MPFR_POOL_CLASS_LIMIT))
     {
-      /* Call the real GMP function */
-      mpz_init2 (z, n);
+      c = l <= 1 ? 0 : floor_log2 ((mp_limb_t) (l - 1)) + 1;
+      m = c < MPFR_POOL_NCLASSES ? pool_mask >> c : 0;
+      if (MPFR_LIKELY (m != 0))
+        {
+          int cnt;
+
+          count_trailing_zeros (cnt, (mp_limb_t) m);
+          pool_pop (z, c + cnt);
+          MPFR_ASSERTD ((mp_bitcnt_t) ALLOC(z) >= l);
+          return;
+        }
     }
-}
 
+  /* Call the real GMP function */
+  pool_misses++;
+  mpz_init2 (z, n);
+}
 
 MPFR_HOT_FUNCTION_ATTR void
 mpfr_mpz_clear (mpz_ptr z)
 {
-  /* We only put objects with at most MPFR_POOL_MAX_SIZE in the mpz_t pool,
+  size_t a = ALLOC(z), b = a * MPFR_BYTES_PER_MP_LIMB;
+  int c;
+
+  /* We only put objects with at most pool_max_limbs limbs in the mpz_t
+     pool, and as long as the pool takes at most pool_max_bytes bytes,
      to avoid it takes too much memory (and anyway the speedup is mainly
-     for small precision). */
-  if (MPFR_LIKELY (n_alloc < numberof (mpz_tab) &&
-                   ALLOC (z) <= MPFR_POOL_MAX_SIZE))
+     for small precision). Note: ALLOC(z) = 0 is possible with GMP 6.2+
+     (lazy allocation); such a mpz_t has nothing worth caching. */
+  if (MPFR_LIKELY (a != 0 && a <= pool_max_limbs &&
+                   pool_bytes + b <= pool_max_bytes))
     {
-      /* Push back the mpz_t inside the stack of the used mpz_t */
-      MPFR_ASSERTD (n_alloc >= 0);
-      memcpy (&mpz_tab[n_alloc++], z, sizeof (mpz_t));
+      c = floor_log2 ((mp_limb_t) a);
+      MPFR_ASSERTD (c < MPFR_POOL_NCLASSES);
+      if (MPFR_LIKELY (n_alloc[c] < MPFR_POOL_NENTRIES))
+        {
+          /* Push back the mpz_t inside the stack of its class */
+          memcpy (&mpz_tab[c][n_alloc[c]++], z, sizeof (mpz_t));
+          pool_mask |= 1UL << c;
+          pool_bytes += b;
+          return;
+        }
     }
-  else
+
+  /* Call the real GMP function */
+  mpz_clear (z);
+}
+
+/* Release the entries of the pool that do not satisfy the current limits,
+   the largest ones first. */
+static void
+pool_trim (void)
+{
+  int c, i, j;
+
+  for (c = MPFR_POOL_NCLASSES - 1; c >= 0; c--)
     {
-      /* Call the real GMP function */
-      mpz_clear (z);
+      for (i = j = 0; i < n_alloc[c]; i++)
+        {
+          mpz_ptr z = &mpz_tab[c][i];
+
+          if ((size_t) ALLOC(z) > pool_max_limbs ||
+              pool_bytes > pool_max_bytes)
+            {
+              pool_bytes -= (size_t) ALLOC(z) * MPFR_BYTES_PER_MP_LIMB;
+              mpz_clear (z);
+            }
+          else if (i != j)
+            memcpy (&mpz_tab[c][j++], z, sizeof (mpz_t));
+          else
+            j++;
+        }
+      n_alloc[c] = j;
+      if (j == 0)
+        pool_mask &= ~(1UL << c);
     }
 }
 
@@ -106,11 +201,67 @@ void
 mpfr_free_pool (void)
 {
 #if MPFR_POOL_NENTRIES
-  int i;
+  int c, i;
+
+  /* the bit mask of non-empty classes must fit in an unsigned long */
+  MPFR_STAT_STATIC_ASSERT (MPFR_POOL_NCLASSES <= 32);
+  MPFR_STAT_STATIC_ASSERT (MPFR_POOL_MAX_SIZE <= MPFR_POOL_CLASS_LIMIT);
+
+  for (c = 0; c < MPFR_POOL_NCLASSES; c++)
+    {
+      MPFR_ASSERTD (n_alloc[c] >= 0 && n_alloc[c] <= MPFR_POOL_NENTRIES);
+      for (i = 0; i < n_alloc[c]; i++)
+        mpz_clear (&mpz_tab[c][i]);
+      n_alloc[c] = 0;
+    }
+  pool_mask = 0;
+  pool_bytes = 0;
+#endif
+}
+
+/* Set the limits of the pool of the current thread: the mpz_t having
+   more than max_limbs limbs are not cached, and the total size of the
+   cached mpz_t does not exceed max_bytes bytes. The entries that do not
+   satisfy the new limits are freed. Zero for either limit disables the
+   pool. */
+void
+mpfr_pool_config (size_t max_limbs, size_t max_bytes)
+{
+#if MPFR_POOL_NENTRIES
+  pool_max_limbs = MIN (max_limbs, MPFR_POOL_CLASS_LIMIT);
+  pool_max_bytes = max_bytes;
+  pool_trim ();
+#endif
+}
 
-  MPFR_ASSERTD (n_alloc >= 0 && n_alloc <= numberof (mpz_tab));
-  for (i = 0; i < n_alloc; i++)
-    mpz_clear (&mpz_tab[i]);
-  n_alloc = 0;
+/* Get the number of mpz_t obtained from the pool (hits) and from GMP
+   (misses) by the current thread since the last reset, and the number
+   of bytes currently held by its pool. Null pointers are ignored. */
+void
+mpfr_pool_stats (unsigned long *hits, unsigned long *misses, size_t *bytes)
+{
+#if MPFR_POOL_NENTRIES
+  if (hits != NULL)
+    *hits = pool_hits;
+  if (misses != NULL)
+    *misses = pool_misses;
+  if (bytes != NULL)
+    *bytes = pool_bytes;
+#else
+  if (hits != NULL)
+    *hits = 0;
+  if (misses != NULL)
+    *misses = 0;
+  if (bytes != NULL)
+    *bytes = 0;
+#endif
+}
+
+void
+mpfr_pool_stats_reset (void)
+{
+#if MPFR_POOL_NENTRIES
+  pool_hits = 0;
+  pool_misses = 0;
 #endif
 }
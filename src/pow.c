@@ -26,6 +26,16 @@ If not, see <https://www.gnu.org/licenses/>. */
 # define MPFR_POW_EXP_THRESHOLD (MAX (sizeof(mpfr_exp_t) * CHAR_BIT, 256))
 #endif
 
+/* Dyadic exponents y = n/2^k (n odd) with 1 <= k <= MPFR_POW_DYADIC_ROOTS
+   and EXP(n) <= MPFR_POW_DYADIC_EXP are computed with k square roots of
+   x^|n| (the last one being a reciprocal square root for y < 0). */
+#ifndef MPFR_POW_DYADIC_EXP
+# define MPFR_POW_DYADIC_EXP 17
+#endif
+#ifndef MPFR_POW_DYADIC_ROOTS
+# define MPFR_POW_DYADIC_ROOTS 8
+#endif
+
 /* return non zero iff x^y is exact.
    Assumes x and y are ordinary numbers,
    y is not an integer, x is not a power of 2 and x is positive
@@ -113,6 +123,81 @@ mpfr_pow_is_exact (mpfr_ptr z, mpfr_srcptr x, mpfr_srcptr y,
   return res;
 }
 
+/* Set z to x^y, where x > 0 and y = n/2^k with n odd and k >= 1, using
+   x^y = sqrt(...sqrt(x^n)) (k square roots) for y > 0, and the same with
+   a reciprocal square root as the last operation for y < 0, which is much
+   faster than exp(y*log(x)) for small |n| and k. Assumes that the exponent
+   range has already been extended. Return MPFR_POW_DYADIC_FAIL if an
+   overflow or underflow occurs in the extended exponent range (so that
+   the general case is used), otherwise the ternary value in the extended
+   exponent range. */
+#define MPFR_POW_DYADIC_FAIL 2
+static int
+mpfr_pow_dyadic (mpfr_ptr z, mpfr_srcptr x, mpfr_srcptr y, mpfr_exp_t k,
+                 mpfr_rnd_t rnd_mode)
+{
+  mpfr_t t, yk;
+  mpfr_prec_t Nz = MPFR_PREC (z), Nt;
+  unsigned long n;
+  mpfr_exp_t i;
+  int inexact, inex2, neg = MPFR_IS_NEG (y), first = 1;
+  MPFR_ZIV_DECL (loop);
+  MPFR_BLOCK_DECL (flags);
+
+  MPFR_ASSERTD (MPFR_IS_POS (x) && k >= 1);
+
+  MPFR_ALIAS (yk, y, MPFR_SIGN_POS, MPFR_GET_EXP (y) + k);  /* |n| */
+  MPFR_ASSERTD (mpfr_odd_p (yk) && mpfr_fits_ulong_p (yk, MPFR_RNDN));
+  n = mpfr_get_ui (yk, MPFR_RNDN);
+
+  Nt = Nz + 5 + MPFR_INT_CEIL_LOG2 (Nz);
+  mpfr_init2 (t, Nt);
+
+  MPFR_ZIV_INIT (loop, Nt);
+  for (;;)
+    {
+      /* t = x^n*(1+theta0), then each square root (or the final
+         reciprocal square root) takes the power 1/2 (or -1/2) of the
+         previous error and adds an error theta_i, with |theta_i| <=
+         2^(-Nt). Thus t = x^y*(1+theta) with |1+theta| between
+         (1-2^(-Nt))^2 and (1+2^(-Nt))^2 (the exponents 1, 1/2, 1/4, ...
+         of the errors sum to less than 2), i.e., |theta| < 2.01*2^(-Nt):
+         the error is less than 4 ulps, as for k = 1. */
+      MPFR_BLOCK (flags,
+                  inexact = mpfr_pow_ui (t, x, n, MPFR_RNDN);
+                  for (i = 1; i < k; i++)
+                    inexact |= mpfr_sqrt (t, t, MPFR_RNDN);
+                  inex2 = neg ? mpfr_rec_sqrt (t, t, MPFR_RNDN)
+                    : mpfr_sqrt (t, t, MPFR_RNDN));
+      if (MPFR_UNLIKELY (MPFR_OVERFLOW (flags) || MPFR_UNDERFLOW (flags)))
+        {
+          inexact = MPFR_POW_DYADIC_FAIL;
+          break;
+        }
+      if (inexact == 0 && inex2 == 0)
+        {
+          /* exact result */
+          inexact = mpfr_set (z, t, rnd_mode);
+          break;
+        }
+      if (MPFR_LIKELY (MPFR_CAN_ROUND (t, Nt - 2, Nz, rnd_mode)))
+        {
+          inexact = mpfr_set (z, t, rnd_mode);
+          break;
+        }
+      /* The result may be exact while x^n is not (in precision Nt):
+         check it once, as in mpfr_pow_general. */
+      if (first && mpfr_pow_is_exact (z, x, y, rnd_mode, &inexact))
+        break;
+      first = 0;
+      MPFR_ZIV_NEXT (loop, Nt);
+      mpfr_set_prec (t, Nt);
+    }
+  MPFR_ZIV_FREE (loop);
+  mpfr_clear (t);
+  return inexact;
+}
+
 /* Assumes that the exponent range has already been extended and if y is
    an integer, then the result is not exact in unbounded exponent range.
    If y_is_integer is non-zero, y is an integer (always when x < 0).
@@ -396,6 +481,7 @@ mpfr_pow (mpfr_ptr z, mpfr_srcptr x, mpfr_srcptr y, mpfr_rnd_t rnd_mode)
   int cmp_x_1;
   int y_is_integer;
   MPFR_SAVE_EXPO_DECL (expo);
+  MPFR_PERF_FUNC (MPFR_PREC (z));
 
   MPFR_LOG_FUNC
     (("x[%Pd]=%.*Rg y[%Pd]=%.*Rg rnd=%d",
@@ -623,6 +709,14 @@ mpfr_pow (mpfr_ptr z, mpfr_srcptr x, mpfr_srcptr y, mpfr_rnd_t rnd_mode)
     {
       mpz_t zi;
 
+      /* for y fitting in a long, mpfr_pow_si avoids the conversion to
+         mpz_t */
+      if (mpfr_fits_slong_p (y, MPFR_RNDN))
+        {
+          MPFR_LOG_MSG (("special code for y fitting in a long\n", 0));
+          return mpfr_pow_si (z, x, mpfr_get_si (y, MPFR_RNDN), rnd_mode);
+        }
+
       MPFR_LOG_MSG (("special code for y not too large integer\n", 0));
       mpz_init (zi);
       mpfr_get_z (zi, y, MPFR_RNDN);
@@ -698,6 +792,24 @@ mpfr_pow (mpfr_ptr z, mpfr_srcptr x, mpfr_srcptr y, mpfr_rnd_t rnd_mode)
                                       rnd_mode, expo, {});
   }
 
+  /* Case where y = n/2^k with n odd, 1 <= k <= MPFR_POW_DYADIC_ROOTS and
+     |n| < 2^MPFR_POW_DYADIC_EXP (thus x > 0), where k is the number of
+     bits of y after the binary point. */
+  if (! y_is_integer && ey < MPFR_POW_DYADIC_EXP)
+    {
+      mpfr_exp_t k = mpfr_min_prec (y) - ey;
+
+      if (k <= MPFR_POW_DYADIC_ROOTS && ey + k <= MPFR_POW_DYADIC_EXP)
+        {
+          inexact = mpfr_pow_dyadic (z, x, y, k, rnd_mode);
+          if (inexact != MPFR_POW_DYADIC_FAIL)
+            {
+              MPFR_SAVE_EXPO_FREE (expo);
+              return mpfr_check_range (z, inexact, rnd_mode);
+            }
+        }
+    }
+
   /* General case */
   inexact = mpfr_pow_general (z, x, y, rnd_mode, y_is_integer, &expo);
 
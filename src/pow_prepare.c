@@ -0,0 +1,112 @@
+/* mpfr_pow_prepare, mpfr_pow_apply, mpfr_pow_clear -- powers of a base
+   prepared for several exponents
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#define MPFR_NEED_LONGLONG_H
+#include "mpfr-impl.h"
+
+/* The prepared base contains a copy of x and log(x), computed at the
+   first call to mpfr_pow_apply that needs it (NaN before), and recomputed
+   only when a larger precision is needed. */
+#define POW_BASE(b) (&(b)->_mpfr_base)
+#define POW_LOG(b)  (&(b)->_mpfr_log)
+
+void
+mpfr_pow_prepare (mpfr_pow_base_ptr b, mpfr_srcptr x)
+{
+  mpfr_init2 (POW_BASE (b), MPFR_PREC (x));
+  mpfr_set (POW_BASE (b), x, MPFR_RNDN);  /* exact */
+  mpfr_init2 (POW_LOG (b), MPFR_PREC_MIN);  /* NaN: not computed yet */
+}
+
+void
+mpfr_pow_clear (mpfr_pow_base_ptr b)
+{
+  mpfr_clear (POW_BASE (b));
+  mpfr_clear (POW_LOG (b));
+}
+
+/* Set z to x^y, where x is the prepared base. In the usual case, where
+   x > 0 is not a power of 2, y is not an integer and no overflow nor
+   underflow is possible (same fast check as in mpfr_pow), this is one
+   step of the general case of mpfr_pow (x^y = exp(y*log(x))) with the
+   cached value of log(x). All the other cases, and the case where the
+   first approximation cannot be rounded (which includes the exact cases
+   and the results very close to 1), are handled by mpfr_pow. */
+int
+mpfr_pow_apply (mpfr_ptr z, mpfr_pow_base_ptr b, mpfr_srcptr y,
+                mpfr_rnd_t rnd_mode)
+{
+  mpfr_srcptr x = POW_BASE (b);
+  mpfr_ptr l = POW_LOG (b);
+  mpfr_t t;
+  mpfr_prec_t Nz = MPFR_PREC (z), Nt;
+  mpfr_exp_t ex, ey, err;
+  int inexact, ok;
+  MPFR_SAVE_EXPO_DECL (expo);
+
+  MPFR_LOG_FUNC
+    (("x[%Pd]=%.*Rg y[%Pd]=%.*Rg rnd=%d",
+      mpfr_get_prec (x), mpfr_log_prec, x,
+      mpfr_get_prec (y), mpfr_log_prec, y, rnd_mode),
+     ("z[%Pd]=%.*Rg inexact=%d",
+      mpfr_get_prec (z), mpfr_log_prec, z, inexact));
+
+  if (MPFR_UNLIKELY (MPFR_IS_SINGULAR (x) || MPFR_IS_SINGULAR (y) ||
+                     MPFR_IS_NEG (x) || mpfr_powerof2_raw (x)))
+    return mpfr_pow (z, x, y, rnd_mode);
+  ex = MPFR_GET_EXP (x);
+  ey = MPFR_GET_EXP (y);
+  if (MPFR_UNLIKELY (__gmpfr_emax < 1073741823 ||
+                     __gmpfr_emin > -1073741823 ||
+                     ey > 15 || ex <= -32767 || ex > 32767 ||
+                     mpfr_integer_p (y)))
+    return mpfr_pow (z, x, y, rnd_mode);
+
+  MPFR_SAVE_EXPO_MARK (expo);
+
+  /* Same working precision as in mpfr_pow_general. */
+  Nt = Nz + 9 + MPFR_INT_CEIL_LOG2 (Nz);
+  if (MPFR_IS_NAN (l) || MPFR_PREC (l) < Nt)
+    {
+      mpfr_set_prec (l, Nt);
+      mpfr_log (l, x, MPFR_RNDN);
+    }
+
+  /* log(x) has an error of at most 1/2 ulp in precision Nt or more, thus
+     the error analysis of mpfr_pow_general applies: the error on t is at
+     most 2^(EXP(t)+3) ulps for EXP(t) >= -1, and 2 ulps otherwise. There
+     can be no overflow nor underflow since |y*log2(x)| < 2^30. */
+  mpfr_init2 (t, Nt);
+  mpfr_mul (t, y, l, MPFR_RNDN);
+  err = MPFR_NOTZERO (t) && MPFR_GET_EXP (t) >= -1 ?
+    MPFR_GET_EXP (t) + 3 : 1;
+  mpfr_exp (t, t, MPFR_RNDN);
+  ok = MPFR_CAN_ROUND (t, Nt - err, Nz, rnd_mode);
+  if (MPFR_LIKELY (ok))
+    inexact = mpfr_set (z, t, rnd_mode);
+  mpfr_clear (t);
+  MPFR_SAVE_EXPO_FREE (expo);
+
+  if (MPFR_UNLIKELY (! ok))
+    return mpfr_pow (z, x, y, rnd_mode);
+  return mpfr_check_range (z, inexact, rnd_mode);
+}
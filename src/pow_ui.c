@@ -29,14 +29,19 @@ If not, see <https://www.gnu.org/licenses/>. */
 #define FSPEC "l"
 #endif
 
+/* maximal window size of the sliding-window method */
+#ifndef POW_U_WINDOW_MAX
+#define POW_U_WINDOW_MAX 3
+#endif
+
 /* sets y to x^n, and return 0 if exact, non-zero otherwise */
 int
 POW_U (mpfr_ptr y, mpfr_srcptr x, UTYPE n, mpfr_rnd_t rnd)
 {
   UTYPE m;
-  mpfr_t res;
+  mpfr_t res, tab[1 << (POW_U_WINDOW_MAX - 1)];
   mpfr_prec_t prec, err, nlen;
-  int inexact;
+  int inexact, i, k;
   mpfr_rnd_t rnd1;
   MPFR_SAVE_EXPO_DECL (expo);
   MPFR_ZIV_DECL (loop);
@@ -97,42 +102,81 @@ POW_U (mpfr_ptr y, mpfr_srcptr x, UTYPE n, mpfr_rnd_t rnd)
     ;
   /* 2^(nlen-1) <= n < 2^nlen */
 
-  /* set up initial precision */
-  prec = MPFR_PREC (y) + 3 + GMP_NUMB_BITS
-    + MPFR_INT_CEIL_LOG2 (MPFR_PREC (y));
-  if (prec <= nlen)
-    prec = nlen + 1;
+  /* Window size for the left-to-right sliding-window method: the odd
+     powers x^3, ..., x^(2^k-1) are precomputed, then each window of at
+     most k bits (ending with a 1) costs one multiplication. This saves
+     about nlen/2 - nlen/(k+1) - 2^(k-1) multiplications compared to the
+     binary method (k = 1). */
+  k = nlen < 16 ? 1 : nlen < 32 ? 2 : 3;
+  MPFR_ASSERTD (k <= POW_U_WINDOW_MAX);
+
+  /* set up initial precision: as in mpfr_pow_z, the error bound below
+     leaves MPFR_PREC (y) + 2 + log2(MPFR_PREC (y)) correct bits */
+  prec = MPFR_PREC (y) + 3 + nlen + MPFR_INT_CEIL_LOG2 (MPFR_PREC (y));
   mpfr_init2 (res, prec);
+  for (i = 1; i < (1 << (k - 1)); i++)
+    mpfr_init2 (tab[i], prec);
 
   rnd1 = MPFR_IS_POS (x) ? MPFR_RNDU : MPFR_RNDD; /* away */
 
   MPFR_ZIV_INIT (loop, prec);
   for (;;)
     {
-      int i;
+      mpfr_srcptr src;
+      int j, w;
 
       MPFR_ASSERTD (prec > nlen);
       err = prec - 1 - nlen;
-      /* First step: compute square from x */
       MPFR_BLOCK (flags,
-                  inexact = mpfr_sqr (res, x, MPFR_RNDU);
+                  inexact = 0;
+                  if (k > 1)
+                    {
+                      /* tab[i] = x^(2i+1), using res = x^2 */
+                      inexact |= mpfr_sqr (res, x, MPFR_RNDU);
+                      inexact |= mpfr_mul (tab[1], x, res, rnd1);
+                      for (i = 2; i < (1 << (k - 1)); i++)
+                        inexact |= mpfr_mul (tab[i], tab[i-1], res, rnd1);
+                    }
+                  /* the first window starts at the most significant bit */
+                  src = NULL;
                   MPFR_ASSERTD (nlen >= 2 && nlen <= INT_MAX);
-                  i = nlen;
-                  if (n & ((UTYPE) 1 << (i-2)))
-                    inexact |= mpfr_mul (res, res, x, rnd1);
-                  for (i -= 3; i >= 0 && !MPFR_BLOCK_EXCEP; i--)
+                  for (i = nlen - 1; i >= 0 && !MPFR_BLOCK_EXCEP; )
                     {
-                      inexact |= mpfr_sqr (res, res, MPFR_RNDU);
-                      if (n & ((UTYPE) 1 << i))
-                        inexact |= mpfr_mul (res, res, x, rnd1);
+                      if ((n & ((UTYPE) 1 << i)) == 0)
+                        {
+                          inexact |= mpfr_sqr (res, src, MPFR_RNDU);
+                          src = res;
+                          i--;
+                          continue;
+                        }
+                      /* window of bits i to j, with bit j set */
+                      for (j = i - k + 1 < 0 ? 0 : i - k + 1;
+                           (n & ((UTYPE) 1 << j)) == 0; j++)
+                        ;
+                      w = (int) ((n >> j) & (((UTYPE) 2 << (i - j)) - 1));
+                      if (src == NULL)
+                        src = w == 1 ? x : tab[w >> 1];
+                      else
+                        {
+                          for (; i >= j; i--)
+                            {
+                              inexact |= mpfr_sqr (res, src, MPFR_RNDU);
+                              src = res;
+                            }
+                          inexact |= mpfr_mul (res, res, w == 1 ? x
+                                               : tab[w >> 1], rnd1);
+                        }
+                      i = j - 1;
                     });
-      /* let r(n) be the number of roundings: we have r(2)=1, r(3)=2,
-         and r(2n)=2r(n)+1, r(2n+1)=2r(n)+2, thus r(n)=n-1.
-         Using Higham's method, to each rounding corresponds a factor
-         (1-theta) with 0 <= theta <= 2^(1-p), thus at the end the
-         absolute error is bounded by (n-1)*2^(1-p)*res <= 2*(n-1)*ulp(res)
-         since 2^(-p)*x <= ulp(x). Since n < 2^i, this gives a maximal
-         error of 2^(1+i)*ulp(res).
+      MPFR_ASSERTD (src == res || MPFR_BLOCK_EXCEP);
+      /* Each computed power x^e is x^e times a product of e-1 factors
+         (1+theta) with 0 <= theta <= 2^(1-p), one per rounding (Higham's
+         method): this holds for x, and if it holds for x^a and x^b, it
+         holds for the rounded product x^(a+b) (squaring being the case
+         a = b). Thus at the end the absolute error is bounded by
+         (n-1)*2^(1-p)*res <= 2*(n-1)*ulp(res) since 2^(-p)*x <= ulp(x).
+         Since n < 2^nlen, this gives a maximal error of
+         2^(1+nlen)*ulp(res).
       */
       if (MPFR_LIKELY (inexact == 0
                        || MPFR_OVERFLOW (flags) || MPFR_UNDERFLOW (flags)
@@ -141,8 +185,12 @@ POW_U (mpfr_ptr y, mpfr_srcptr x, UTYPE n, mpfr_rnd_t rnd)
       /* Actualisation of the precision */
       MPFR_ZIV_NEXT (loop, prec);
       mpfr_set_prec (res, prec);
+      for (i = 1; i < (1 << (k - 1)); i++)
+        mpfr_set_prec (tab[i], prec);
     }
   MPFR_ZIV_FREE (loop);
+  for (i = 1; i < (1 << (k - 1)); i++)
+    mpfr_clear (tab[i]);
 
   if (MPFR_UNLIKELY (MPFR_OVERFLOW (flags) || MPFR_UNDERFLOW (flags)))
     {
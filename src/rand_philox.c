@@ -0,0 +1,311 @@
+/* mpfr_randinit_philox, mpfr_rand_philox_stream, mpfr_rand_philox_skip --
+   counter-based random generator
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#define MPFR_NEED_LONGLONG_H
+#include "mpfr-impl.h"
+
+#ifdef MPFR_HAVE_GMP_RANDFNPTR
+
+/* The Philox4x32-10 generator is described in:
+     John K. Salmon, Mark A. Moraes, Ron O. Dror and David E. Shaw,
+     "Parallel random numbers: as easy as 1, 2, 3",
+     Proceedings of SC'11, 2011.
+     https://doi.org/10.1145/2063384.2063405
+   The i-th block of 128 random bits is a bijective function (10 rounds of
+   multiplications and xors) of a 128-bit counter i, with a 64-bit key.
+   Here the key is the seed, the low 64 bits of the counter are the block
+   index, and the high 64 bits of the counter are a stream number, so that
+   one gets 2^64 independent streams of 2^64 blocks for each seed. Jumping
+   to any position in a stream takes constant time.
+
+   The random bits are delivered to GMP as a sequence of 32-bit words,
+   the 4 words of block i followed by those of block i+1, and so on. Like
+   for the Mersenne Twister in GMP, a request of n bits consumes
+   ceil(n/32) words, so that the generated numbers do not depend on the
+   machine word size.
+
+   The state is a gmp_randstate_t whose function table is provided by
+   MPFR, so that all the GMP and MPFR random functions can be used with it,
+   and it is cleared by gmp_randclear and copied by gmp_randinit_set. This
+   table is the internal gmp_randfnptr_t structure of GMP: it is taken from
+   gmp-impl.h with --with-gmp-build, otherwise its layout (unchanged since
+   GMP 4.2) is copied below. In both cases, the generator is available only
+   if configure has checked that such a table works with the GMP library
+   (MPFR_CHECK_GMP_RANDFNPTR, only with --with-gmp-build or
+   --enable-gmp-internals); otherwise, mpfr_randinit_philox falls back to
+   the default GMP generator and returns a non-zero value. */
+
+#define M32 0xffffffffUL
+
+typedef struct {
+  unsigned long key[2];  /* 32-bit words */
+  unsigned long ctr[4];  /* ctr[0..1]: next block index, ctr[2..3]: stream */
+  unsigned long out[4];  /* current block */
+  int pos;               /* number of words of out already used */
+} philox_state_t;
+
+#ifdef MPFR_HAVE_GMP_IMPL
+typedef gmp_randfnptr_t philox_fnptr_t;
+#else
+typedef struct {
+  void (*randseed_fn) (__gmp_randstate_struct *, mpz_srcptr);
+  void (*randget_fn) (__gmp_randstate_struct *, mp_ptr, unsigned long);
+  void (*randclear_fn) (__gmp_randstate_struct *);
+  void (*randiset_fn) (__gmp_randstate_struct *,
+                       const __gmp_randstate_struct *);
+} philox_fnptr_t;
+#endif
+
+#define PHILOX_STATE(r) ((philox_state_t *) PTR ((r)->_mp_seed))
+#define PHILOX_LIMBS \
+  ((sizeof (philox_state_t) - 1) / MPFR_BYTES_PER_MP_LIMB + 1)
+
+/* Set h and l to the high and low 32-bit words of a * b. */
+#if GMP_NUMB_BITS >= 64
+# define MUL32(h,l,a,b)                                         \
+  do {                                                          \
+    mp_limb_t _p = (mp_limb_t) (a) * (mp_limb_t) (b);           \
+    (h) = (unsigned long) (_p >> 32);                           \
+    (l) = (unsigned long) (_p & M32);                           \
+  } while (0)
+#else
+# define MUL32(h,l,a,b)                                         \
+  do {                                                          \
+    mp_limb_t _h, _l;                                           \
+    umul_ppmm (_h, _l, (mp_limb_t) (a), (mp_limb_t) (b));       \
+    (h) = (unsigned long) _h;                                   \
+    (l) = (unsigned long) _l;                                   \
+  } while (0)
+#endif
+
+/* Compute the block of index ctr[0..1] into out, and increment the block
+   index. */
+static void
+philox_block (philox_state_t *s)
+{
+  unsigned long c0, c1, c2, c3, k0, k1, h0, l0, h1, l1;
+  int i;
+
+  c0 = s->ctr[0];
+  c1 = s->ctr[1];
+  c2 = s->ctr[2];
+  c3 = s->ctr[3];
+  k0 = s->key[0];
+  k1 = s->key[1];
+  for (i = 0; i < 10; i++)
+    {
+      MUL32 (h0, l0, 0xD2511F53UL, c0);
+      MUL32 (h1, l1, 0xCD9E8D57UL, c2);
+      c0 = h1 ^ c1 ^ k0;
+      c1 = l1;
+      c2 = h0 ^ c3 ^ k1;
+      c3 = l0;
+      k0 = (k0 + 0x9E3779B9UL) & M32;
+      k1 = (k1 + 0xBB67AE85UL) & M32;
+    }
+  s->out[0] = c0;
+  s->out[1] = c1;
+  s->out[2] = c2;
+  s->out[3] = c3;
+
+  s->ctr[0] = (s->ctr[0] + 1) & M32;
+  if (s->ctr[0] == 0)
+    s->ctr[1] = (s->ctr[1] + 1) & M32;
+  s->pos = 0;
+}
+
+static unsigned long
+philox_word (philox_state_t *s)
+{
+  if (s->pos == 4)
+    philox_block (s);
+  return s->out[s->pos++];
+}
+
+static void
+philox_seed (__gmp_randstate_struct *r, mpz_srcptr seed)
+{
+  philox_state_t *s = PHILOX_STATE (r);
+  mp_limb_t l0 = mpz_getlimbn (seed, 0);
+
+  s->key[0] = (unsigned long) l0 & M32;
+#if GMP_NUMB_BITS >= 64
+  s->key[1] = (unsigned long) (l0 >> 32) & M32;
+#else
+  s->key[1] = (unsigned long) mpz_getlimbn (seed, 1) & M32;
+#endif
+  s->ctr[0] = s->ctr[1] = s->ctr[2] = s->ctr[3] = 0;
+  s->pos = 4;
+}
+
+static void
+philox_get (__gmp_randstate_struct *r, mp_ptr dest, unsigned long nbits)
+{
+  philox_state_t *s = PHILOX_STATE (r);
+  unsigned long nw, i;
+  mp_size_t n;
+  int rb;
+
+  nw = nbits / 32 + (nbits % 32 != 0);
+  n = MPFR_PREC2LIMBS (nbits);
+  MPN_ZERO (dest, n);
+  for (i = 0; i < nw; i++)
+    dest[i / (GMP_NUMB_BITS / 32)] |=
+      (mp_limb_t) philox_word (s) << (32 * (i % (GMP_NUMB_BITS / 32)));
+  rb = nbits % GMP_NUMB_BITS;
+  if (rb != 0)
+    dest[n - 1] &= MPFR_LIMB_MASK (rb);
+}
+
+static void
+philox_clear (__gmp_randstate_struct *r)
+{
+  mpfr_free_func (PTR (r->_mp_seed), PHILOX_LIMBS * MPFR_BYTES_PER_MP_LIMB);
+}
+
+static void philox_iset (__gmp_randstate_struct *,
+                         const __gmp_randstate_struct *);
+
+static const philox_fnptr_t philox_fnptr = {
+  philox_seed, philox_get, philox_clear, philox_iset
+};
+
+static void
+philox_alloc (__gmp_randstate_struct *r)
+{
+  r->_mp_seed->_mp_alloc = PHILOX_LIMBS;
+  r->_mp_seed->_mp_size = 0;
+  r->_mp_seed->_mp_d = (mp_limb_t *) mpfr_allocate_func
+    (PHILOX_LIMBS * MPFR_BYTES_PER_MP_LIMB);
+  r->_mp_alg = GMP_RAND_ALG_DEFAULT;
+  r->_mp_algdata._mp_lc = (void *) &philox_fnptr;
+}
+
+static void
+philox_iset (__gmp_randstate_struct *dst, const __gmp_randstate_struct *src)
+{
+  philox_alloc (dst);
+  memcpy (PHILOX_STATE (dst), PTR (src->_mp_seed), sizeof (philox_state_t));
+}
+
+/* Initialize r with the Philox generator, with the low 64 bits of seed
+   as the key, at the beginning of stream 0, and return 0. A new seed may
+   be set later with gmp_randseed or gmp_randseed_ui. */
+int
+mpfr_randinit_philox (gmp_randstate_t r, unsigned long seed)
+{
+  philox_state_t *s;
+
+  philox_alloc (r);
+  s = PHILOX_STATE (r);
+  s->key[0] = seed & M32;
+  s->key[1] = (seed >> 16 >> 16) & M32;
+  s->ctr[0] = s->ctr[1] = s->ctr[2] = s->ctr[3] = 0;
+  s->pos = 4;
+  return 0;
+}
+
+/* Set r to the beginning of the stream id and return 0. If r is not a
+   Philox state, return a non-zero value and leave r unchanged. */
+int
+mpfr_rand_philox_stream (gmp_randstate_t r, unsigned long id)
+{
+  philox_state_t *s;
+
+  if (r->_mp_algdata._mp_lc != (void *) &philox_fnptr)
+    return 1;
+  s = PHILOX_STATE (r);
+  s->ctr[0] = s->ctr[1] = 0;
+  s->ctr[2] = id & M32;
+  s->ctr[3] = (id >> 16 >> 16) & M32;
+  s->pos = 4;
+  return 0;
+}
+
+/* Skip the next n 32-bit words of the current stream of r and return 0.
+   If r is not a Philox state, return a non-zero value and leave r
+   unchanged. */
+int
+mpfr_rand_philox_skip (gmp_randstate_t r, unsigned long n)
+{
+  philox_state_t *s;
+  unsigned long q, c;
+
+  if (r->_mp_algdata._mp_lc != (void *) &philox_fnptr)
+    return 1;
+  s = PHILOX_STATE (r);
+
+  /* first use the remaining words of the current block */
+  if (n <= (unsigned long) (4 - s->pos))
+    {
+      s->pos += n;
+      return 0;
+    }
+  n -= 4 - s->pos;
+
+  /* add q = floor(n/4) to the block index */
+  q = n / 4;
+  c = (s->ctr[0] + (q & M32)) & M32;
+  s->ctr[1] = (s->ctr[1] + (q >> 16 >> 16) + (c < s->ctr[0])) & M32;
+  s->ctr[0] = c;
+
+  /* then take n mod 4 words from the next block */
+  s->pos = 4;
+  if (n % 4 != 0)
+    {
+      philox_block (s);
+      s->pos = n % 4;
+    }
+  return 0;
+}
+
+#else /* MPFR_HAVE_GMP_RANDFNPTR */
+
+/* The generator is not available: initialize r with the default GMP
+   generator and the given seed, and return a non-zero value. */
+int
+mpfr_randinit_philox (gmp_randstate_t r, unsigned long seed)
+{
+  gmp_randinit_default (r);
+  gmp_randseed_ui (r, seed);
+  return 1;
+}
+
+/* These functions need a state set by a successful call to
+   mpfr_randinit_philox, which is not possible here. */
+int
+mpfr_rand_philox_stream (gmp_randstate_t r, unsigned long id)
+{
+  (void) r;
+  (void) id;
+  return 1;
+}
+
+int
+mpfr_rand_philox_skip (gmp_randstate_t r, unsigned long n)
+{
+  (void) r;
+  (void) n;
+  return 1;
+}
+
+#endif /* MPFR_HAVE_GMP_RANDFNPTR */
@@ -458,6 +458,58 @@ mpfr_mpn_rec_sqrt (mpfr_limb_ptr x, mpfr_prec_t p,
     }
 }
 
+/* Special code for the case where r and u have at most 2 limbs, s being
+   defined as in mpfr_rec_sqrt below. With U = {up, un} / B^un, X =
+   (2^(1+s)*U)^(-1/2) satisfies 1/2 < X < 1, except X = 1 for the exact
+   case, which is treated separately. We compute T = floor(X*2^K), with
+   K = (rn+1)*GMP_NUMB_BITS, as the integer square root of the integer
+   quotient of 2^(2K)*B^un/2^(1+s) by {up, un}, thus without any error.
+   Since 1/sqrt(u) is exact only when u is a power of 4, and cannot be the
+   middle of two p-bit numbers (which has p+1 bits), the bits of X after
+   those of T are not all zero: we set the least significant bit of T so
+   that mpfr_round_raw correctly sees an inexact value. */
+static int
+mpfr_rec_sqrt_small (mpfr_ptr r, mpfr_srcptr u, mpfr_rnd_t rnd_mode, int s)
+{
+  mp_limb_t np[8], qp[7], tp[3], rem[2];
+  mpfr_limb_srcptr up = MPFR_MANT(u);
+  mp_size_t un = MPFR_LIMB_SIZE(u), rn = MPFR_LIMB_SIZE(r), tn = rn + 1;
+  int cy, inex;
+
+  MPFR_ASSERTD(un <= 2 && rn <= 2);
+
+  if (s == 0 && up[un - 1] == MPFR_LIMB_HIGHBIT &&
+      (un == 1 || up[0] == MPFR_LIMB_ZERO))
+    {
+      /* u = 2^(EXP(u)-1) with EXP(u) odd: the result is exact */
+      MPN_ZERO (MPFR_MANT(r), rn - 1);
+      MPFR_MANT(r)[rn - 1] = MPFR_LIMB_HIGHBIT;
+      MPFR_EXP(r) = - (MPFR_EXP(u) - 3) / 2;
+      return mpfr_check_range (r, 0, rnd_mode);
+    }
+
+  /* {np, 2*tn+un} = 2^(2K+un*GMP_NUMB_BITS-1-s) */
+  MPN_ZERO (np, 2 * tn + un - 1);
+  np[2 * tn + un - 1] = MPFR_LIMB_HIGHBIT >> s;
+  /* the quotient is at most 2^(2K-s), with equality only in the exact
+     case for s = 0, thus qp[2*tn] = 0, and at least 2^(2K-1-s) */
+  mpn_tdiv_qr (qp, rem, 0, np, 2 * tn + un, up, un);
+  MPFR_ASSERTD(qp[2 * tn] == 0 && qp[2 * tn - 1] != 0);
+  mpn_sqrtrem (tp, NULL, qp, 2 * tn);
+  MPFR_ASSERTD(tp[tn - 1] & MPFR_LIMB_HIGHBIT);
+  tp[0] |= MPFR_LIMB_ONE;
+
+  cy = mpfr_round_raw (MPFR_MANT(r), tp, tn * GMP_NUMB_BITS, 0,
+                       MPFR_PREC(r), rnd_mode, &inex);
+  MPFR_EXP(r) = - (MPFR_EXP(u) - 1 - s) / 2;
+  if (MPFR_UNLIKELY(cy != 0))
+    {
+      MPFR_EXP(r) ++;
+      MPFR_MANT(r)[rn - 1] = MPFR_LIMB_HIGHBIT;
+    }
+  return mpfr_check_range (r, inex, rnd_mode);
+}
+
 int
 mpfr_rec_sqrt (mpfr_ptr r, mpfr_srcptr u, mpfr_rnd_t rnd_mode)
 {
@@ -467,6 +519,7 @@ mpfr_rec_sqrt (mpfr_ptr r, mpfr_srcptr u, mpfr_rnd_t rnd_mode)
   mpfr_limb_ptr x;
   MPFR_TMP_DECL(marker);
   MPFR_ZIV_DECL (loop);
+  MPFR_PERF_FUNC (MPFR_PREC (r));
 
   MPFR_LOG_FUNC
     (("x[%Pd]=%.*Rg rnd=%d", mpfr_get_prec (u), mpfr_log_prec, u, rnd_mode),
@@ -528,6 +581,9 @@ mpfr_rec_sqrt (mpfr_ptr r, mpfr_srcptr u, mpfr_rnd_t rnd_mode)
 
   rn = LIMB_SIZE(rp);
 
+  if (rn <= 2 && up <= 2 * GMP_NUMB_BITS)
+    return mpfr_rec_sqrt_small (r, u, rnd_mode, s);
+
   /* for the first iteration, if rp + 11 fits into rn limbs, we round up
      up to a full limb to maximize the chance of rounding, while avoiding
      to allocate extra space */
@@ -42,6 +42,7 @@ mpfr_sin (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
   int inexact, sign, reduce;
   MPFR_ZIV_DECL (loop);
   MPFR_SAVE_EXPO_DECL (expo);
+  MPFR_PERF_FUNC (MPFR_PREC (y));
 
   MPFR_LOG_FUNC
     (("x[%Pd]=%.*Rg rnd=%d", mpfr_get_prec (x), mpfr_log_prec, x, rnd_mode),
@@ -69,12 +70,22 @@ mpfr_sin (mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
   /* sin(x) = x - x^3/6 + ... so the error is < 2^(3*EXP(x)-2) */
   MPFR_FAST_COMPUTE_IF_SMALL_INPUT (y, x, err1, 2, 0, rnd_mode, {});
 
+#if !defined(MPFR_GENERIC_ABI) && GMP_NUMB_BITS == 64
+  if (MPFR_PREC (y) <= 2 * GMP_NUMB_BITS)
+    {
+      /* fixed-point code, which fails only in rare cases */
+      inexact = mpfr_sin_fixed (y, x, rnd_mode);
+      if (MPFR_LIKELY (inexact != 0))
+        return inexact;
+    }
+#endif
+
   MPFR_SAVE_EXPO_MARK (expo);
 
   /* Compute initial precision */
   precy = MPFR_PREC (y);
 
-  if (precy >= MPFR_SINCOS_THRESHOLD)
+  if (precy >= MPFR_SINCOS_THRESHOLD || MPFR_SINCOS_SPARSE_P (x, precy))
     {
       inexact = mpfr_sin_fast (y, x, rnd_mode);
       goto end;
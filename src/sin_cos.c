@@ -35,6 +35,7 @@ mpfr_sin_cos (mpfr_ptr y, mpfr_ptr z, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
   int inexy, inexz;
   MPFR_ZIV_DECL (loop);
   MPFR_SAVE_EXPO_DECL (expo);
+  MPFR_PERF_FUNC (MAX (MPFR_PREC (y), MPFR_PREC (z)));
 
   MPFR_ASSERTN (y != z);
 
@@ -124,7 +125,7 @@ mpfr_sin_cos (mpfr_ptr y, mpfr_ptr z, mpfr_srcptr x, mpfr_rnd_t rnd_mode)
       m += 2 * (-expx);
     }
 
-  if (prec >= MPFR_SINCOS_THRESHOLD)
+  if (prec >= MPFR_SINCOS_THRESHOLD || MPFR_SINCOS_SPARSE_P (x, prec))
     {
       MPFR_SAVE_EXPO_FREE (expo);
       return mpfr_sincos_fast (y, z, x, rnd_mode);
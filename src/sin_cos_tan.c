@@ -0,0 +1,133 @@
+/* mpfr_sin_cos_tan -- sine, cosine and tangent of a floating-point number
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#define MPFR_NEED_LONGLONG_H
+#include "mpfr-impl.h"
+
+/* Set each non-null r[i] to the value of f[i] on x, where x may be one
+   of the r[i]. */
+static int
+mpfr_sin_cos_tan_separate (mpfr_ptr r[3], mpfr_srcptr x, mpfr_rnd_t rnd_mode)
+{
+  int (*const f[3]) (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t) =
+    { mpfr_sin, mpfr_cos, mpfr_tan };
+  int inex[3] = { 0, 0, 0 };
+  mpfr_t xx;
+  int i;
+
+  mpfr_init2 (xx, MPFR_PREC (x));
+  mpfr_set (xx, x, MPFR_RNDN);
+  for (i = 0; i < 3; i++)
+    if (r[i] != NULL)
+      inex[i] = f[i] (r[i], xx, rnd_mode);
+  mpfr_clear (xx);
+  return INEX3 (inex[0], inex[1], inex[2]);
+}
+
+/* The computations are done by
+     (s, c) = (o(sin(x)), o(cos(x))) with mpfr_sin_cos, t = o(s / c),
+   with rounding to nearest and N bits of precision. Thus s and c have an
+   error of at most 1/2 ulp, i.e., a relative error of at most 2^(-N) (this
+   holds even when x is close to a zero of sin or cos, since the argument
+   reduction in mpfr_sin_cos takes care of the cancellation), and t has a
+   relative error of at most 3.0001 * 2^(-N), i.e., at most 4 ulps.
+   For |x| < 1, sin(x) and tan(x) are x + O(x^3) and cos(x) is 1 + O(x^2),
+   thus we need about -2 EXP(x) more bits to be able to round; when this is
+   more than the target precision, mpfr_sin, mpfr_cos and mpfr_tan all use
+   fast paths and we call them separately. */
+
+int
+mpfr_sin_cos_tan (mpfr_ptr rs, mpfr_ptr rc, mpfr_ptr rt, mpfr_srcptr x,
+                  mpfr_rnd_t rnd_mode)
+{
+  mpfr_ptr r[3];
+  mpfr_t s, c, t;
+  mpfr_prec_t N;
+  mpfr_exp_t ex;
+  int inex[3] = { 0, 0, 0 }, i;
+  MPFR_ZIV_DECL (loop);
+  MPFR_SAVE_EXPO_DECL (expo);
+  MPFR_GROUP_DECL (group);
+  MPFR_PERF_FUNC (rs != NULL ? MPFR_PREC (rs) : rc != NULL ? MPFR_PREC (rc) :
+                  rt != NULL ? MPFR_PREC (rt) : MPFR_PREC_MIN);
+
+  MPFR_ASSERTN (rs == NULL || (rs != rc && rs != rt));
+  MPFR_ASSERTN (rc == NULL || rc != rt);
+
+  MPFR_LOG_FUNC
+    (("x[%Pd]=%.*Rg rnd=%d", mpfr_get_prec (x), mpfr_log_prec, x, rnd_mode),
+     ("inex=%d,%d,%d", inex[0], inex[1], inex[2]));
+
+  r[0] = rs;
+  r[1] = rc;
+  r[2] = rt;
+
+  N = MPFR_PREC_MIN;
+  for (i = 0; i < 3; i++)
+    if (r[i] != NULL && MPFR_PREC (r[i]) > N)
+      N = MPFR_PREC (r[i]);
+
+  if (MPFR_IS_SINGULAR (x) ||
+      (ex = MPFR_GET_EXP (x)) < - (mpfr_exp_t) (N / 2))
+    return mpfr_sin_cos_tan_separate (r, x, rnd_mode);
+
+  MPFR_SAVE_EXPO_MARK (expo);
+
+  N = N + MPFR_INT_CEIL_LOG2 (N) + 6 + (ex < 0 ? -2 * ex : 0);
+  MPFR_GROUP_INIT_3 (group, N, s, c, t);
+
+  MPFR_ZIV_INIT (loop, N);
+  for (;;)
+    {
+      mpfr_sin_cos (s, c, x, MPFR_RNDN);
+      if (rt != NULL)
+        mpfr_div (t, s, c, MPFR_RNDN);
+
+      /* all the outputs are set after the loop, since x may be one
+         of them */
+      if (MPFR_LIKELY ((rs == NULL ||
+                        MPFR_CAN_ROUND (s, N, MPFR_PREC (rs), rnd_mode)) &&
+                       (rc == NULL ||
+                        MPFR_CAN_ROUND (c, N, MPFR_PREC (rc), rnd_mode)) &&
+                       (rt == NULL ||
+                        MPFR_CAN_ROUND (t, N - 2, MPFR_PREC (rt),
+                                        rnd_mode))))
+        break;
+      MPFR_ZIV_NEXT (loop, N);
+      MPFR_GROUP_REPREC_3 (group, N, s, c, t);
+    }
+  MPFR_ZIV_FREE (loop);
+
+  if (rs != NULL)
+    inex[0] = mpfr_set (rs, s, rnd_mode);
+  if (rc != NULL)
+    inex[1] = mpfr_set (rc, c, rnd_mode);
+  if (rt != NULL)
+    inex[2] = mpfr_set (rt, t, rnd_mode);
+
+  MPFR_GROUP_CLEAR (group);
+  MPFR_SAVE_EXPO_FREE (expo);
+
+  for (i = 0; i < 3; i++)
+    if (r[i] != NULL)
+      inex[i] = mpfr_check_range (r[i], inex[i], rnd_mode);
+  return INEX3 (inex[0], inex[1], inex[2]);
+}
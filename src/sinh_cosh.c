@@ -32,6 +32,7 @@ mpfr_sinh_cosh (mpfr_ptr sh, mpfr_ptr ch, mpfr_srcptr xt, mpfr_rnd_t rnd_mode)
 {
   mpfr_t x;
   int inexact_sh, inexact_ch;
+  MPFR_PERF_FUNC (MAX (MPFR_PREC (sh), MPFR_PREC (ch)));
 
   MPFR_ASSERTN (sh != ch);
 
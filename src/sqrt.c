@@ -491,6 +491,125 @@ mpfr_sqrt2 (mpfr_ptr r, mpfr_srcptr u, mpfr_rnd_t rnd_mode)
     }
 }
 
+/* Special code for 2*GMP_NUMB_BITS < prec(r) = prec(u) <= 3*GMP_NUMB_BITS.
+   The square root and the remainder are computed by mpn_sqrtrem on fixed-size
+   arrays, which avoids the overhead of the generic code. */
+static int
+mpfr_sqrt3 (mpfr_ptr r, mpfr_srcptr u, mpfr_rnd_t rnd_mode)
+{
+  mpfr_prec_t p = MPFR_GET_PREC(r);
+  mpfr_limb_ptr up = MPFR_MANT(u), rp = MPFR_MANT(r);
+  mp_limb_t np[6], sp[3], tp[6], rb, sb, mask;
+  mp_size_t tn;
+  mpfr_prec_t exp_u = MPFR_EXP(u), exp_r, sh = 3 * GMP_NUMB_BITS - p;
+
+  if (((unsigned int) exp_u & 1) != 0)
+    {
+      np[5] = up[2] >> 1;
+      np[4] = (up[2] << (GMP_NUMB_BITS - 1)) | (up[1] >> 1);
+      np[3] = (up[1] << (GMP_NUMB_BITS - 1)) | (up[0] >> 1);
+      np[2] = up[0] << (GMP_NUMB_BITS - 1);
+      exp_u ++;
+    }
+  else
+    {
+      np[5] = up[2];
+      np[4] = up[1];
+      np[3] = up[0];
+      np[2] = 0;
+    }
+  np[1] = np[0] = 0;
+  exp_r = exp_u / 2;
+
+  mask = MPFR_LIMB_MASK(sh);
+
+  /* now N = {np, 6} = S^2 + T with S = {sp, 3} and 0 <= T = {tp, tn} <= 2*S,
+     where S has its most significant bit set since N >= B^6/4 */
+  tn = mpn_sqrtrem (sp, tp, np, 6);
+  MPFR_ASSERTD(sp[2] & MPFR_LIMB_HIGHBIT);
+
+  if (sh == 0)
+    {
+      /* The round bit is 1 iff sqrt(N) >= S + 1/2, i.e., T > S (we cannot
+         have sqrt(N) = S + 1/2). In that case, T <> 0 thus sb <> 0. */
+      rb = tn > 3 || (tn == 3 && mpn_cmp (tp, sp, 3) > 0);
+      sb = tn != 0;
+    }
+  else
+    {
+      rb = sp[0] & (MPFR_LIMB_ONE << (sh - 1));
+      sb = ((sp[0] & mask) ^ rb) | (tn != 0);
+    }
+  rp[2] = sp[2];
+  rp[1] = sp[1];
+  rp[0] = sp[0] & ~mask;
+
+  /* rounding */
+  if (MPFR_UNLIKELY (exp_r > __gmpfr_emax))
+    return mpfr_overflow (r, rnd_mode, 1);
+
+  /* See comments in mpfr_div_1 */
+  if (MPFR_UNLIKELY (exp_r < __gmpfr_emin))
+    {
+      if (rnd_mode == MPFR_RNDN)
+        {
+          if (exp_r < __gmpfr_emin - 1 ||
+              (rp[2] == MPFR_LIMB_HIGHBIT && rp[1] == MPFR_LIMB_ZERO &&
+               rp[0] == MPFR_LIMB_ZERO && sb == 0))
+            rnd_mode = MPFR_RNDZ;
+        }
+      else if (MPFR_IS_LIKE_RNDA(rnd_mode, 0))
+        {
+          if (exp_r == __gmpfr_emin - 1 &&
+              (rp[2] == MPFR_LIMB_MAX && rp[1] == MPFR_LIMB_MAX &&
+               rp[0] == ~mask) && (rb | sb))
+            goto rounding; /* no underflow */
+        }
+      return mpfr_underflow (r, rnd_mode, 1);
+    }
+
+ rounding:
+  MPFR_EXP (r) = exp_r;
+  if (sb == 0 /* implies rb = 0 */ || rnd_mode == MPFR_RNDF)
+    {
+      MPFR_ASSERTD(exp_r >= __gmpfr_emin);
+      MPFR_ASSERTD(exp_r <= __gmpfr_emax);
+      MPFR_RET (0);
+    }
+  else if (rnd_mode == MPFR_RNDN)
+    {
+      /* since sb <> 0 now, only rb is needed */
+      if (rb == 0)
+        goto truncate;
+      else
+        goto add_one_ulp;
+    }
+  else if (MPFR_IS_LIKE_RNDZ(rnd_mode, 0))
+    {
+    truncate:
+      MPFR_ASSERTD(exp_r >= __gmpfr_emin);
+      MPFR_ASSERTD(exp_r <= __gmpfr_emax);
+      MPFR_RET(-1);
+    }
+  else /* round away from zero */
+    {
+    add_one_ulp:
+      rp[0] += MPFR_LIMB_ONE << sh;
+      rp[1] += rp[0] == 0;
+      rp[2] += rp[1] == 0 && rp[0] == 0;
+      if (rp[2] == 0)
+        {
+          rp[2] = MPFR_LIMB_HIGHBIT;
+          if (MPFR_UNLIKELY(exp_r + 1 > __gmpfr_emax))
+            return mpfr_overflow (r, rnd_mode, 1);
+          MPFR_ASSERTD(exp_r + 1 <= __gmpfr_emax);
+          MPFR_ASSERTD(exp_r + 1 >= __gmpfr_emin);
+          MPFR_SET_EXP (r, exp_r + 1);
+        }
+      MPFR_RET(1);
+    }
+}
+
 #endif /* !defined(MPFR_GENERIC_ABI) && GMP_NUMB_BITS == 64 */
 
 int
@@ -514,6 +633,7 @@ mpfr_sqrt (mpfr_ptr r, mpfr_srcptr u, mpfr_rnd_t rnd_mode)
   mpfr_exp_t expr;
   mpfr_prec_t rq = MPFR_GET_PREC (r);
   MPFR_TMP_DECL(marker);
+  MPFR_PERF_FUNC (MPFR_PREC (r));
 
   MPFR_LOG_FUNC
     (("x[%Pd]=%.*Rg rnd=%d", mpfr_get_prec (u), mpfr_log_prec, u, rnd_mode),
@@ -568,6 +688,9 @@ mpfr_sqrt (mpfr_ptr r, mpfr_srcptr u, mpfr_rnd_t rnd_mode)
 
         if (rq == GMP_NUMB_BITS)
           return mpfr_sqrt1n (r, u, rnd_mode);
+
+        if (2*GMP_NUMB_BITS < rq && rq <= 3*GMP_NUMB_BITS)
+          return mpfr_sqrt3 (r, u, rnd_mode);
       }
   }
 #endif
@@ -0,0 +1,270 @@
+/* Temporary memory allocation (MPFR_TMP_ALLOC) with a per-thread arena
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-impl.h"
+
+/* When MPFR does not use the TMP_* macros of gmp-impl.h, the temporary
+   blocks that are not allocated on the stack by TMP_ALLOC (because they
+   are larger than MPFR_ALLOCA_MAX or alloca is not available) are taken
+   from a per-thread arena: a list of chunks in which the blocks are
+   allocated by incrementing a pointer (the top of the arena). Since the
+   TMP_MARK / TMP_FREE pairs are properly nested, TMP_FREE just needs to
+   reset the top of the arena to its value at the first arena allocation
+   after the corresponding TMP_MARK, which is recorded in a struct
+   tmp_marker allocated in the arena just before the block. The chunks
+   are kept for the next allocations, so that the allocation function is
+   no longer called in the usual case. When the total size of the chunks
+   would exceed a limit (configurable per thread with
+   mpfr_tmp_arena_config), the block is allocated with the allocation
+   function as before. The unused chunks are freed by mpfr_free_cache. */
+
+#ifndef MPFR_TMP_ARENA_MAX
+# define MPFR_TMP_ARENA_MAX 1048576 /* default maximal size (in bytes) */
+#endif
+
+#ifndef MPFR_TMP_ARENA_CHUNK
+# define MPFR_TMP_ARENA_CHUNK 65536 /* minimal size of a chunk (in bytes) */
+#endif
+
+#ifndef MPFR_HAVE_GMP_IMPL
+
+typedef union
+{
+  mp_limb_t l;
+  double d;
+  long double ld;
+  void *p;
+} mpfr_tmp_align_t;
+
+/* round n up to a multiple of the alignment */
+#define ARENA_ROUND(n) \
+  (((n) + sizeof (mpfr_tmp_align_t) - 1) / sizeof (mpfr_tmp_align_t) \
+   * sizeof (mpfr_tmp_align_t))
+
+/* A chunk of size bytes, whose data follow the header; base is the number
+   of bytes of the arena in use before this chunk. */
+struct arena_chunk
+{
+  struct arena_chunk *next;
+  size_t size;
+  size_t base;
+};
+
+#define CHUNK_HEADER ARENA_ROUND (sizeof (struct arena_chunk))
+#define CHUNK_DATA(c) ((char *) (c) + CHUNK_HEADER)
+#define NODE_SIZE ARENA_ROUND (sizeof (struct tmp_marker))
+
+/* The top of the arena is at offset arena_off in the chunk arena_cur
+   (if arena_cur is null, the arena is empty and arena_off is 0). */
+static MPFR_THREAD_ATTR struct arena_chunk *arena_first = NULL;
+static MPFR_THREAD_ATTR struct arena_chunk *arena_cur = NULL;
+static MPFR_THREAD_ATTR size_t arena_off = 0;
+
+/* Current limit, total size of the chunks and statistics */
+static MPFR_THREAD_ATTR size_t arena_max = MPFR_TMP_ARENA_MAX;
+static MPFR_THREAD_ATTR size_t arena_reserved = 0;
+static MPFR_THREAD_ATTR size_t arena_high = 0;
+static MPFR_THREAD_ATTR unsigned long arena_fallbacks = 0;
+
+/* Free the chunks following c (all of them if c is null), which must be
+   unused. */
+static void
+arena_free_after (struct arena_chunk *c)
+{
+  struct arena_chunk *t, **p;
+
+  p = c == NULL ? &arena_first : &c->next;
+  while (*p != NULL)
+    {
+      t = *p;
+      *p = t->next;
+      arena_reserved -= t->size;
+      mpfr_free_func (t, CHUNK_HEADER + t->size);
+    }
+}
+
+/* Allocate n bytes (a multiple of the alignment) in the arena, or return
+   a null pointer if the limit would be exceeded. */
+static void *
+arena_alloc (size_t n)
+{
+  struct arena_chunk *c;
+  size_t used, s;
+  char *r;
+
+  if (MPFR_LIKELY (arena_cur != NULL && n <= arena_cur->size - arena_off))
+    {
+      r = CHUNK_DATA (arena_cur) + arena_off;
+      arena_off += n;
+      used = arena_cur->base + arena_off;
+      if (used > arena_high)
+        arena_high = used;
+      return r;
+    }
+
+  /* Move to the next chunk, or allocate a new one if it does not exist
+     or is too small. The remaining part of the current chunk is lost until
+     the top of the arena goes back to it. */
+  used = arena_cur == NULL ? 0 : arena_cur->base + arena_off;
+  c = arena_cur == NULL ? arena_first : arena_cur->next;
+  if (c == NULL || c->size < n)
+    {
+      arena_free_after (arena_cur);
+      /* The chunk sizes grow geometrically, so that the number of chunks
+         remains small. */
+      s = MAX (MAX (n, arena_reserved), MPFR_TMP_ARENA_CHUNK);
+      if (arena_reserved >= arena_max || n > arena_max - arena_reserved)
+        return NULL;
+      s = MIN (s, arena_max - arena_reserved);
+      c = (struct arena_chunk *) mpfr_allocate_func (CHUNK_HEADER + s);
+      c->next = NULL;
+      c->size = s;
+      arena_reserved += s;
+      if (arena_cur == NULL)
+        arena_first = c;
+      else
+        arena_cur->next = c;
+    }
+  c->base = used;
+  arena_cur = c;
+  arena_off = n;
+  used += n;
+  if (used > arena_high)
+    arena_high = used;
+  return CHUNK_DATA (c);
+}
+
+void *
+mpfr_tmp_allocate (struct tmp_marker **tmp_marker, size_t size)
+{
+  struct tmp_marker *head;
+
+  if (MPFR_LIKELY (size <= arena_max))
+    {
+      struct arena_chunk *c = arena_cur;
+      size_t off = arena_off;
+
+      head = (struct tmp_marker *) arena_alloc (NODE_SIZE
+                                                + ARENA_ROUND (size));
+      if (MPFR_LIKELY (head != NULL))
+        {
+          head->ptr = NULL;
+          head->size = off;
+          head->chunk = c;
+          head->next = *tmp_marker;
+          *tmp_marker = head;
+          return (char *) head + NODE_SIZE;
+        }
+    }
+
+  arena_fallbacks++;
+  head = (struct tmp_marker *)
+    mpfr_allocate_func (sizeof (struct tmp_marker));
+  head->ptr = mpfr_allocate_func (size);
+  head->size = size;
+  head->next = *tmp_marker;
+  *tmp_marker = head;
+  return head->ptr;
+}
+
+void
+mpfr_tmp_free (struct tmp_marker *tmp_marker)
+{
+  struct tmp_marker *t, *first = NULL;
+
+  while (tmp_marker != NULL)
+    {
+      t = tmp_marker;
+      tmp_marker = t->next;
+      if (t->ptr == NULL)
+        first = t;  /* arena block: the last one is the oldest */
+      else
+        {
+          mpfr_free_func (t->ptr, t->size);
+          mpfr_free_func (t, sizeof (struct tmp_marker));
+        }
+    }
+
+  /* Reset the top of the arena. The chunks are not freed, thus the
+     contents of *first are still available. */
+  if (first != NULL)
+    {
+      arena_cur = (struct arena_chunk *) first->chunk;
+      arena_off = first->size;
+    }
+}
+
+#endif /* Have gmp-impl.h */
+
+/* Free the unused chunks of the arena of the current thread. */
+void
+mpfr_tmp_arena_free (void)
+{
+#ifndef MPFR_HAVE_GMP_IMPL
+  arena_free_after (arena_cur);
+#endif
+}
+
+/* Set the maximal total size of the arena of the current thread (0
+   disables it) and free its unused chunks. */
+void
+mpfr_tmp_arena_config (size_t max_bytes)
+{
+#ifndef MPFR_HAVE_GMP_IMPL
+  arena_max = max_bytes;
+  arena_free_after (arena_cur);
+#endif
+}
+
+/* Get the maximal number of bytes of the arena used by the current thread
+   since the last reset, the number of bytes currently reserved by the
+   arena, and the number of temporary blocks that have been allocated by
+   the allocation function since the last reset. Null pointers are
+   ignored. */
+void
+mpfr_tmp_arena_stats (size_t *high_water, size_t *reserved,
+                      unsigned long *fallbacks)
+{
+#ifndef MPFR_HAVE_GMP_IMPL
+  if (high_water != NULL)
+    *high_water = arena_high;
+  if (reserved != NULL)
+    *reserved = arena_reserved;
+  if (fallbacks != NULL)
+    *fallbacks = arena_fallbacks;
+#else
+  if (high_water != NULL)
+    *high_water = 0;
+  if (reserved != NULL)
+    *reserved = 0;
+  if (fallbacks != NULL)
+    *fallbacks = 0;
+#endif
+}
+
+void
+mpfr_tmp_arena_stats_reset (void)
+{
+#ifndef MPFR_HAVE_GMP_IMPL
+  arena_high = arena_cur == NULL ? 0 : arena_cur->base + arena_off;
+  arena_fallbacks = 0;
+#endif
+}
@@ -0,0 +1,219 @@
+/* Tuning profiles: run-time selection of the thresholds
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-impl.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# include <cpuid.h>
+# define HAVE_CPUID 1
+#endif
+
+/* Set vendor (which must have room for 13 characters), family and model
+   to the vendor string, family and model of the processor given by the
+   CPUID instruction, the family and model including the extended family
+   and model as usual. Return 0 if this information is not available.
+   This is also used by tuneup -p. */
+int
+mpfr_tune_cpuid (char *vendor, int *family, int *model)
+{
+#ifdef HAVE_CPUID
+  unsigned int a, b, c, d;
+
+  if (__get_cpuid (0, &a, &b, &c, &d) == 0)
+    return 0;
+  memcpy (vendor, &b, 4);
+  memcpy (vendor + 4, &d, 4);
+  memcpy (vendor + 8, &c, 4);
+  vendor[12] = '\0';
+  if (__get_cpuid (1, &a, &b, &c, &d) == 0)
+    return 0;
+  *family = (a >> 8) & 15;
+  *model = (a >> 4) & 15;
+  if (*family == 15)
+    *family += (a >> 20) & 255;
+  if (*family == 6 || *family >= 15)
+    *model += ((a >> 16) & 15) << 4;
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+#ifdef MPFR_USE_TUNE_PROFILES
+
+/* A profile is a set of thresholds, with the processors for which it is
+   selected automatically: those with the given CPUID vendor string and
+   family, and a model in the list (terminated by -1). */
+struct mpfr_tune_profile
+{
+  const char *name;
+  const char *vendor;  /* NULL: never selected automatically */
+  int family;
+  const int *models;
+  mpfr_tune_param_t param;
+};
+
+#define MPFR_TUNE_PROFILE_CAT(a,b) a ## _ ## b
+#define MPFR_TUNE_PROFILE_CAT2(a,b) MPFR_TUNE_PROFILE_CAT (a,b)
+#define MPFR_TUNE_PROFILE_VAR(x) \
+  MPFR_TUNE_PROFILE_CAT2 (MPFR_TUNE_PROFILE_ID, x)
+
+/* Each profile is defined by the inclusion of a parameter file in the
+   format of mparam.h, followed by the inclusion of tune_profile.h. The
+   first inclusion of tune_profile.h undefines the parameters of mparam.h
+   that have been defined by mpfr-impl.h. */
+#include "tune_profile.h"
+
+/* The parameters selected at build time (see mpfr_buildopt_tune_case),
+   used when no other profile matches the processor. */
+#define MPFR_TUNE_PROFILE_ID build
+#define MPFR_TUNE_PROFILE_NAME "default"
+#include "mparam.h"
+#include "tune_profile.h"
+
+/* The default values of the parameters. */
+#define MPFR_TUNE_PROFILE_ID generic
+#define MPFR_TUNE_PROFILE_NAME "generic"
+#include "generic/mparam.h"
+#include "tune_profile.h"
+
+/* A parameter file generated by "tuneup -p" on a given processor defines
+   MPFR_TUNE_PROFILE_VENDOR, MPFR_TUNE_PROFILE_FAMILY and
+   MPFR_TUNE_PROFILE_MODELS (a list of models, which may be extended to
+   similar processors). It is put in a subdirectory of the architecture,
+   included below like the other profiles, and added to profiles[]. */
+
+#if defined (__x86_64__) || defined (__amd64__) || defined (_M_X64)
+/* Intel Xeon 5th generation (Emerald Rapids), only selected by name */
+#define MPFR_TUNE_PROFILE_ID emeraldrapids
+#define MPFR_TUNE_PROFILE_NAME "emeraldrapids"
+#include "x86_64/emeraldrapids/mparam.h"
+#include "tune_profile.h"
+#endif
+
+static const struct mpfr_tune_profile *const profiles[] =
+  {
+    &build_profile,
+    &generic_profile,
+#if defined (__x86_64__) || defined (__amd64__) || defined (_M_X64)
+    &emeraldrapids_profile,
+#endif
+  };
+
+static const struct mpfr_tune_profile *current_profile = &build_profile;
+const mpfr_tune_param_t *__gmpfr_tune_param = &build_profile.param;
+
+/* The function giving the processor identification for the automatic
+   selection; the tests replace it to simulate other processors. */
+int (*__gmpfr_tune_cpuid) (char *, int *, int *) = mpfr_tune_cpuid;
+
+/* Return the profile given by the MPFR_TUNE_PROFILE environment variable
+   if it exists, otherwise the profile for the current processor, or the
+   default one. */
+static const struct mpfr_tune_profile *
+tune_profile_auto (void)
+{
+  const char *var;
+  char vendor[13];
+  int family, model, i;
+  const int *m;
+
+  var = getenv ("MPFR_TUNE_PROFILE");
+  if (var != NULL)
+    for (i = 0; i < numberof (profiles); i++)
+      if (strcmp (profiles[i]->name, var) == 0)
+        return profiles[i];
+
+  if (__gmpfr_tune_cpuid (vendor, &family, &model))
+    for (i = 0; i < numberof (profiles); i++)
+      if (profiles[i]->vendor != NULL &&
+          strcmp (profiles[i]->vendor, vendor) == 0 &&
+          profiles[i]->family == family)
+        for (m = profiles[i]->models; *m >= 0; m++)
+          if (*m == model)
+            return profiles[i];
+  return profiles[0];
+}
+
+static void
+tune_profile_select (const struct mpfr_tune_profile *p)
+{
+  const mpfr_tune_param_t *t = &p->param;
+
+  /* The conditions that are checked by static assertions when the
+     thresholds are constants (see mul.c and mulders.c). */
+  MPFR_ASSERTN (t->mul_threshold >= 1 && t->sqr_threshold >= 1);
+  MPFR_ASSERTN (t->mulhigh_size >= 8 && t->sqrhigh_size > 2 &&
+                t->divhigh_size >= 15);
+  current_profile = p;
+  __gmpfr_tune_param = t;
+}
+
+#ifdef MPFR_HAVE_CONSTRUCTOR_ATTR
+
+/* Select the profile at startup. */
+static void mpfr_tune_profile_init (void) __attribute__ ((constructor));
+
+static void
+mpfr_tune_profile_init (void)
+{
+  mpfr_set_tune_profile (NULL);
+}
+
+#endif
+
+#endif /* MPFR_USE_TUNE_PROFILES */
+
+const char *
+mpfr_get_tune_profile (void)
+{
+#ifdef MPFR_USE_TUNE_PROFILES
+  return current_profile->name;
+#else
+  return "default";
+#endif
+}
+
+/* Select the profile of the given name, or if name is a null pointer, the
+   profile chosen as at startup. Return 0 on success, a non-zero value
+   if there is no such profile (the current profile is not changed). */
+int
+mpfr_set_tune_profile (const char *name)
+{
+#ifdef MPFR_USE_TUNE_PROFILES
+  int i;
+
+  if (name == NULL)
+    {
+      tune_profile_select (tune_profile_auto ());
+      return 0;
+    }
+  for (i = 0; i < numberof (profiles); i++)
+    if (strcmp (profiles[i]->name, name) == 0)
+      {
+        tune_profile_select (profiles[i]);
+        return 0;
+      }
+  return 1;
+#else
+  return name != NULL && strcmp (name, "default") != 0;
+#endif
+}
@@ -0,0 +1,93 @@
+/* Definition of a tuning profile (see tune_profile.c).  -*- mode: C -*-
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+/* This file is included several times by tune_profile.c, without guard.
+   If MPFR_TUNE_PROFILE_ID is defined, the parameters of the profile
+   have been defined by the inclusion of a parameter file (in the format
+   of mparam.h), and this file defines the tables and the profile named
+   MPFR_TUNE_PROFILE_ID##_profile. In any case, it undefines all the
+   macros of the parameter file, so that the next one can be included. */
+
+#ifdef MPFR_TUNE_PROFILE_ID
+
+/* the parameters not given by the profile have their default value */
+#include "generic/mparam.h"
+
+#ifndef MPFR_TUNE_PROFILE_VENDOR
+# define MPFR_TUNE_PROFILE_VENDOR NULL  /* never selected automatically */
+# define MPFR_TUNE_PROFILE_FAMILY 0
+# define MPFR_TUNE_PROFILE_MODELS 0
+#endif
+
+static const short MPFR_TUNE_PROFILE_VAR (mulhigh)[] = { MPFR_MULHIGH_TAB };
+static const short MPFR_TUNE_PROFILE_VAR (sqrhigh)[] = { MPFR_SQRHIGH_TAB };
+static const short MPFR_TUNE_PROFILE_VAR (divhigh)[] = { MPFR_DIVHIGH_TAB };
+static const int MPFR_TUNE_PROFILE_VAR (models)[] =
+  { MPFR_TUNE_PROFILE_MODELS, -1 };
+
+static const struct mpfr_tune_profile MPFR_TUNE_PROFILE_VAR (profile) =
+  {
+    MPFR_TUNE_PROFILE_NAME,
+    MPFR_TUNE_PROFILE_VENDOR,
+    MPFR_TUNE_PROFILE_FAMILY,
+    MPFR_TUNE_PROFILE_VAR (models),
+    {
+      MPFR_TUNE_PROFILE_VAR (mulhigh),
+      MPFR_TUNE_PROFILE_VAR (sqrhigh),
+      MPFR_TUNE_PROFILE_VAR (divhigh),
+      numberof_const (MPFR_TUNE_PROFILE_VAR (mulhigh)),
+      numberof_const (MPFR_TUNE_PROFILE_VAR (sqrhigh)),
+      numberof_const (MPFR_TUNE_PROFILE_VAR (divhigh)),
+      MPFR_MUL_THRESHOLD,
+      MPFR_SQR_THRESHOLD,
+      MPFR_DIV_THRESHOLD,
+      MPFR_DIV_Q_THRESHOLD,
+      MPFR_EXP_2_THRESHOLD,
+      MPFR_EXP_THRESHOLD,
+      MPFR_SINCOS_THRESHOLD,
+      MPFR_AI_THRESHOLD1,
+      MPFR_AI_THRESHOLD2,
+      MPFR_AI_THRESHOLD3
+    }
+  };
+
+#undef MPFR_TUNE_PROFILE_ID
+#undef MPFR_TUNE_PROFILE_NAME
+
+#endif
+
+#undef MPFR_TUNE_CASE
+#undef MPFR_TUNE_PROFILE_VENDOR
+#undef MPFR_TUNE_PROFILE_FAMILY
+#undef MPFR_TUNE_PROFILE_MODELS
+#undef MPFR_MULHIGH_TAB
+#undef MPFR_SQRHIGH_TAB
+#undef MPFR_DIVHIGH_TAB
+#undef MPFR_MUL_THRESHOLD
+#undef MPFR_SQR_THRESHOLD
+#undef MPFR_DIV_THRESHOLD
+#undef MPFR_DIV_Q_THRESHOLD
+#undef MPFR_EXP_2_THRESHOLD
+#undef MPFR_EXP_THRESHOLD
+#undef MPFR_SINCOS_THRESHOLD
+#undef MPFR_AI_THRESHOLD1
+#undef MPFR_AI_THRESHOLD2
+#undef MPFR_AI_THRESHOLD3
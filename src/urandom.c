@@ -49,8 +49,15 @@ If not, see <https://www.gnu.org/licenses/>. */
       with equal probabilities.
 */
 
-int
-mpfr_urandom (mpfr_ptr rop, gmp_randstate_t rstate, mpfr_rnd_t rnd_mode)
+/* The random bits are taken from b if it is not a null pointer,
+   otherwise from rstate. */
+#define RAND_RAW(mp,nbits)                                      \
+  (b != NULL ? mpfr_rand_buf_get (mp, b, nbits)                 \
+   : mpfr_rand_raw (mp, rstate, nbits))
+
+static int
+mpfr_urandom_aux (mpfr_ptr rop, gmp_randstate_t rstate, mpfr_rand_buf_ptr b,
+                  mpfr_rnd_t rnd_mode)
 {
   mpfr_limb_ptr rp;
   mpfr_prec_t nbits;
@@ -81,7 +88,7 @@ mpfr_urandom (mpfr_ptr rop, gmp_randstate_t rstate, mpfr_rnd_t rnd_mode)
   do
     {
       /* generate DRAW_BITS in rp[0] */
-      mpfr_rand_raw (rp, rstate, DRAW_BITS);
+      RAND_RAW (rp, DRAW_BITS);
       if (MPFR_UNLIKELY (rp[0] == 0))
         cnt = DRAW_BITS;
       else
@@ -107,7 +114,7 @@ mpfr_urandom (mpfr_ptr rop, gmp_randstate_t rstate, mpfr_rnd_t rnd_mode)
     }
   else
     {
-      mpfr_rand_raw (rp, rstate, nbits - 1);
+      RAND_RAW (rp, nbits - 1);
       nlimbs = MPFR_LIMB_SIZE (rop);
       n = nlimbs * GMP_NUMB_BITS - nbits;
       if (MPFR_LIKELY (n != 0)) /* this will put the low bits to zero */
@@ -116,7 +123,7 @@ mpfr_urandom (mpfr_ptr rop, gmp_randstate_t rstate, mpfr_rnd_t rnd_mode)
     }
 
   /* Rounding bit */
-  mpfr_rand_raw (&rbit, rstate, 1);
+  RAND_RAW (&rbit, 1);
   MPFR_ASSERTD (rbit == 0 || rbit == 1);
 
   /* Step 3 (rounding). */
@@ -135,3 +142,46 @@ mpfr_urandom (mpfr_ptr rop, gmp_randstate_t rstate, mpfr_rnd_t rnd_mode)
   MPFR_SAVE_EXPO_FREE (expo);
   return mpfr_check_range (rop, inex, rnd_mode);
 }
+
+int
+mpfr_urandom (mpfr_ptr rop, gmp_randstate_t rstate, mpfr_rnd_t rnd_mode)
+{
+  return mpfr_urandom_aux (rop, rstate, NULL, rnd_mode);
+}
+
+/* Set rop[0], ..., rop[n-1], which must all have the same precision, to
+   random numbers uniformly distributed in [0,1], rounded in the direction
+   rnd_mode. As for mpfr_urandomb_vec, the random bits are drawn from
+   rstate by large blocks, thus the results may differ from the ones of n calls
+   to mpfr_urandom. If inex is not a null pointer, the ternary values are
+   stored in inex[0], ..., inex[n-1]. Return 0 iff all the results are
+   exact, which cannot happen for n > 0. */
+int
+mpfr_urandom_vec (const mpfr_ptr *rop, int *inex, unsigned long n,
+                  gmp_randstate_t rstate, mpfr_rnd_t rnd_mode)
+{
+  mpfr_rand_buf_t b;
+  mpfr_uprec_t p;
+  unsigned long i;
+  int ret = 0;
+
+  if (n == 0)
+    return 0;
+
+  /* each number needs about p + DRAW_BITS bits */
+  p = MPFR_PREC (rop[0]) + DRAW_BITS;
+  mpfr_rand_buf_init (b, rstate, n <= (mpfr_uprec_t) -1 / p ?
+                      (mpfr_uprec_t) n * p : (mpfr_uprec_t) -1);
+  for (i = 0; i < n; i++)
+    {
+      int t;
+
+      MPFR_ASSERTN (MPFR_PREC (rop[i]) == MPFR_PREC (rop[0]));
+      t = mpfr_urandom_aux (rop[i], rstate, b, rnd_mode);
+      if (inex != NULL)
+        inex[i] = t;
+      ret |= t;
+    }
+  mpfr_rand_buf_clear (b);
+  return ret;
+}
@@ -45,8 +45,82 @@ mpfr_rand_raw (mpfr_limb_ptr mp, gmp_randstate_t rstate,
   mpz_clear (z);
 }
 
-int
-mpfr_urandomb (mpfr_ptr rop, gmp_randstate_t rstate)
+/* Initialize the buffer b for drawing random bits from rstate, where
+   about hint bits are expected to be drawn (this is only used to avoid
+   drawing many more bits than needed from rstate). */
+void
+mpfr_rand_buf_init (mpfr_rand_buf_ptr b, gmp_randstate_t rstate,
+                    mpfr_uprec_t hint)
+{
+  b->state = rstate;
+  b->buf = (mpfr_limb_ptr) mpfr_allocate_func
+    ((MPFR_PREC2LIMBS (MPFR_RAND_BUF_BITS) + 1) * MPFR_BYTES_PER_MP_LIMB);
+  MPN_ZERO (b->buf, MPFR_PREC2LIMBS (MPFR_RAND_BUF_BITS) + 1);
+  b->size = b->pos = 0;
+  b->left = hint;
+}
+
+void
+mpfr_rand_buf_clear (mpfr_rand_buf_ptr b)
+{
+  mpfr_free_func (b->buf, (MPFR_PREC2LIMBS (MPFR_RAND_BUF_BITS) + 1)
+                  * MPFR_BYTES_PER_MP_LIMB);
+}
+
+/* Same as mpfr_rand_raw, but take the bits from the buffer b, which is
+   refilled with a single call to mpfr_rand_raw when needed; the unused
+   bits are then discarded. Bit j of the integer generated by a call to
+   mpfr_rand_raw is the j-th bit of the stream, thus the bits obtained
+   from the buffer do not depend on GMP_NUMB_BITS. */
+void
+mpfr_rand_buf_get (mpfr_limb_ptr mp, mpfr_rand_buf_ptr b, mpfr_prec_t nbits)
+{
+  mp_size_t i, j, n;
+  int sh, r;
+
+  MPFR_ASSERTD (nbits >= 1);
+  b->left = b->left > (mpfr_uprec_t) nbits ? b->left - nbits : 0;
+
+  /* For large nbits, the cost of the generator dominates and the buffer
+     would just waste bits. */
+  if (nbits > MPFR_RAND_BUF_BITS / 8)
+    {
+      mpfr_rand_raw (mp, b->state, nbits);
+      return;
+    }
+
+  if (b->size - b->pos < nbits)
+    {
+      /* Draw at least 256 bits, since a call to mpfr_rand_raw has a
+         significant fixed cost. */
+      mpfr_prec_t k =
+        b->left < (mpfr_uprec_t) (MPFR_RAND_BUF_BITS - nbits) ?
+        (mpfr_prec_t) b->left + nbits : MPFR_RAND_BUF_BITS;
+      if (k < 256)
+        k = 256;
+      mpfr_rand_raw (b->buf, b->state, k);
+      b->size = k;
+      b->pos = 0;
+    }
+
+  /* The buffer has an additional limb, so that b->buf[i + j + 1] can
+     always be read (the double shift avoids a shift by GMP_NUMB_BITS). */
+  i = b->pos / GMP_NUMB_BITS;
+  sh = b->pos % GMP_NUMB_BITS;
+  n = MPFR_PREC2LIMBS (nbits);
+  for (j = 0; j < n; j++)
+    mp[j] = (b->buf[i + j] >> sh) |
+      ((b->buf[i + j + 1] << 1) << (GMP_NUMB_BITS - 1 - sh));
+  r = nbits % GMP_NUMB_BITS;
+  if (r != 0)
+    mp[n - 1] &= MPFR_LIMB_MASK (r);
+  b->pos += nbits;
+}
+
+/* Set rop to a random number uniformly distributed in [0,1), with bits
+   taken from b if it is not a null pointer, otherwise from rstate. */
+static int
+mpfr_urandomb_aux (mpfr_ptr rop, gmp_randstate_t rstate, mpfr_rand_buf_ptr b)
 {
   mpfr_limb_ptr rp;
   mpfr_prec_t nbits;
@@ -64,7 +138,10 @@ mpfr_urandomb (mpfr_ptr rop, gmp_randstate_t rstate)
   /* Uniform non-normalized significand */
   /* generate exactly nbits so that the random generator stays in the same
      state, independent of the machine word size GMP_NUMB_BITS */
-  mpfr_rand_raw (rp, rstate, nbits);
+  if (b != NULL)
+    mpfr_rand_buf_get (rp, b, nbits);
+  else
+    mpfr_rand_raw (rp, rstate, nbits);
   if (MPFR_LIKELY (cnt != 0)) /* this will put the low bits to zero */
     mpn_lshift (rp, rp, nlimbs, cnt);
 
@@ -107,3 +184,40 @@ mpfr_urandomb (mpfr_ptr rop, gmp_randstate_t rstate)
 
   return 0;
 }
+
+int
+mpfr_urandomb (mpfr_ptr rop, gmp_randstate_t rstate)
+{
+  return mpfr_urandomb_aux (rop, rstate, NULL);
+}
+
+/* Set rop[0], ..., rop[n-1], which must all have the same precision, to
+   random numbers uniformly distributed in [0,1). The random bits are
+   drawn from rstate by large blocks, thus the results may differ from the
+   ones of n calls to mpfr_urandomb, but they depend only on the state
+   of rstate, on n and on the precision. Return 0, unless the exponent
+   of some result is not in the current exponent range (see
+   mpfr_urandomb), in which case it is set to NaN and 1 is returned. */
+int
+mpfr_urandomb_vec (const mpfr_ptr *rop, unsigned long n,
+                   gmp_randstate_t rstate)
+{
+  mpfr_rand_buf_t b;
+  mpfr_prec_t p;
+  unsigned long i;
+  int ret = 0;
+
+  if (n == 0)
+    return 0;
+
+  p = MPFR_PREC (rop[0]);
+  mpfr_rand_buf_init (b, rstate, n <= (mpfr_uprec_t) -1 / (mpfr_uprec_t) p ?
+                      (mpfr_uprec_t) n * p : (mpfr_uprec_t) -1);
+  for (i = 0; i < n; i++)
+    {
+      MPFR_ASSERTN (MPFR_PREC (rop[i]) == p);
+      ret |= mpfr_urandomb_aux (rop[i], rstate, b);
+    }
+  mpfr_rand_buf_clear (b);
+  return ret;
+}
@@ -0,0 +1,239 @@
+/* Various Thresholds of MPFR, not exported.  -*- mode: C -*-
+
+Copyright 2005-2026 Free Software Foundation, Inc.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+/* Generated by MPFR's tuneup.c, 2026-10-17, gcc 12.2.0 */
+/* generated on an Intel Xeon (Emerald Rapids) virtual machine with GMP 6.2.1 */
+
+
+/* These thresholds come from a virtual machine, without GMP's speed
+   library, and are slower than the default ones for some operations:
+   this profile is not selected automatically (no MPFR_TUNE_PROFILE_VENDOR,
+   MPFR_TUNE_PROFILE_FAMILY and MPFR_TUNE_PROFILE_MODELS, which would be
+   "GenuineIntel", 6 and 207), only by its name. */
+
+#define MPFR_MULHIGH_TAB  \
+ -1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10, \
+ 0,12,12,12,12,14,14,14,16,16,16,16,18,18,18,20, \
+ 20,20,20,20,20,22,24,28,34,28,28,28,32,28,28,28, \
+ 28,32,32,32,32,32,32,32,36,36,40,36,40,40,40,40, \
+ 40,40,44,38,40,44,44,56,48,56,44,56,56,57,56,56, \
+ 56,64,56,56,56,56,56,64,56,64,64,64,64,64,64,64, \
+ 64,56,56,60,58,72,60,61,68,64,64,84,84,60,64,68, \
+ 68,64,72,72,71,72,72,76,87,72,80,80,75,80,87,80, \
+ 79,72,99,80,93,84,93,93,93,93,93,96,93,99,93,93, \
+ 99,96,102,96,99,99,99,99,111,99,96,105,105,105,108,93, \
+ 108,120,117,120,93,116,116,117,117,117,117,117,123,111,123,123, \
+ 123,128,123,123,123,117,129,123,129,135,135,123,123,129,129,116, \
+ 110,129,123,117,135,117,123,123,165,117,123,168,186,168,165,171, \
+ 163,166,168,168,168,168,173,168,165,165,168,168,165,168,201,168, \
+ 177,143,171,116,177,177,132,161,122,180,141,149,210,176,188,189, \
+ 169,165,167,168,186,239,164,240,175,201,196,144,167,201,172,184, \
+ 177,201,168,174,177,179,168,177,186,183,225,188,177,213,165,168, \
+ 193,180,189,165,188,175,178,194,177,182,180,185,182,188,180,165, \
+ 189,206,187,177,192,210,192,190,235,192,192,173,192,195,236,236, \
+ 187,164,223,225,206,242,164,214,236,234,235,238,232,226,180,168, \
+ 215,235,251,235,269,172,274,289,249,232,224,233,168,251,236,235, \
+ 199,264,236,244,256,235,264,268,236,265,240,256,251,239,251,256, \
+ 235,236,234,235,256,297,238,246,204,286,300,243,307,247,236,285, \
+ 195,366,235,238,236,224,248,281,208,291,280,253,330,255,280,318, \
+ 278,289,262,252,309,278,237,312,258,283,279,284,370,330,255,284, \
+ 335,268,330,312,252,260,325,342,260,268,260,345,341,281,329,367, \
+ 363,270,315,320,334,283,336,330,325,328,342,330,302,276,227,366, \
+ 325,424,304,352,292,335,354,328,328,402,336,336,358,319,300,330, \
+ 242,354,352,353,375,351,395,352,352,354,354,276,328,359,352,327, \
+ 359,354,352,370,370,354,336,354,262,336,372,342,371,364,336,353, \
+ 267,349,348,376,479,388,354,351,310,278,366,424,299,332,376,332, \
+ 287,378,375,325,377,450,396,395,322,354,354,359,353,377,376,377, \
+ 450,360,378,378,488,475,389,371,478,354,316,352,427,399,378,376, \
+ 394,384,348,267,422,493,396,479,413,387,382,308,317,405,330,480, \
+ 342,413,402,402,402,336,399,402,426,414,504,414,480,480,390,389, \
+ 480,350,425,407,421,468,496,425,325,414,358,426,426,306,430,455, \
+ 558,292,425,501,425,503,469,504,488,502,500,504,480,418,511,375, \
+ 480,449,300,505,456,480,466,402,341,495,478,492,493,502,480,485, \
+ 450,479,449,504,480,490,520,500,480,535,498,335,512,465,504,488, \
+ 479,486,544,492,480,480,504,480,487,480,431,495,501,504,504,503, \
+ 504,503,567,486,504,354,504,494,389,617,512,511,502,487,503,495, \
+ 512,487,510,520,520,487,520,495,504,517,512,608,528,543,544,480, \
+ 479,551,499,504,550,520,378,503,342,347,352,369,485,380,395,409, \
+ 411,479,520,527,450,470,576,478,529,528,480,447,460,484,501,488, \
+ 551,526,536,433,536,604,543,551,533,527,488,503,504,504,592,490, \
+ 504,568,479,504,496,502,534,504,500,591,519,575,568,504,523,584, \
+ 664,513,662,544,660,525,488,600,515,600,631,567,722,455,691,377, \
+ 478,656,524,443,621,568,466,505,663,535,648,616,688,650,495,567, \
+ 680,680,664,639,686,655,735,516,647,637,772,739,649,552,680,520, \
+ 728,688,664,664,662,664,534,450,668,648,664,607,640,678,760,781, \
+ 678,595,666,635,587,517,672,573,630,616,659,556,558,683,663,654, \
+ 675,752,731,697,661,668,568,535,684,695,711,688,663,680,659,616, \
+ 650,688,703,696,631,688,688,606,688,674,659,633,567,669,717,549, \
+ 560,747,562,563,688,698,728,768,589,782,711,704,688,655,736,679, \
+ 744,651,689,571,651,632,783,768,694,676,733,560,736,696,703,584, \
+ 696,584,744,712,663,662,663,676,681,648,719,658,712,680,627,682, \
+ 678,830,688,684,760,856,733,685,678,592,647,664,711,680,664,687, \
+ 686,654,736,663,662,720,745,676,664,849,728,824,664,551,703,686, \
+ 676,688,760,677,711,662,776,687,808,782,752,781,716,726,719,824, \
+ 869,689,825,682,920,642,729,725,704,775,687,780,730,686,720,831, \
+ 663,735,836,760,768,711,759,688,689,732,733,734,767,808,784,712, \
+ 766,661,754,687,854,914,719,702,758,823,717,952,760,710,775,951, \
+ 818,710,730,775,886,991,758,711,736,728,658,782,784,728,783,736, \
+ 734,766,768,574,808,798,756,899,931,736,775,727,759,760,760,760 \
+
+#define MPFR_SQRHIGH_TAB  \
+ -1,0,0,-1,-1,-1,-1,-1,-1,8,7,7,8,-1,10,11, \
+ 10,11,11,13,13,13,13,16,14,15,17,22,16,16,17,18, \
+ 18,19,20,19,22,21,24,23,-1,22,31,34,24,25,25,25, \
+ 34,27,39,34,34,43,34,41,30,51,38,36,40,34,47,34, \
+ 41,38,36,40,36,40,40,51,42,44,44,42,52,44,45,46, \
+ 72,56,54,52,45,66,59,54,56,68,48,49,51,52,58,68, \
+ 54,56,57,68,68,52,53,62,71,68,72,68,67,72,68,66, \
+ 68,62,68,68,80,64,72,73,76,64,84,88,82,79,83,94, \
+ 79,76,68,109,81,74,83,79,74,86,74,84,79,72,111,93, \
+ 84,82,95,92,84,77,124,80,79,123,79,79,80,100,82,84, \
+ 82,88,140,84,88,89,90,124,116,114,88,88,89,97,117,104, \
+ 96,108,112,118,108,169,156,98,106,117,123,158,96,126,123,118, \
+ 121,156,162,104,117,138,104,104,114,114,122,108,119,135,116,132, \
+ 107,123,122,132,129,135,125,126,123,135,123,140,128,123,116,130, \
+ 129,133,135,122,134,221,132,125,154,199,128,191,152,159,156,201, \
+ 123,159,160,174,138,134,140,141,219,144,140,169,132,201,149,170, \
+ 142,155,164,212,158,161,141,179,175,187,229,251,153,143,158,201, \
+ 265,147,140,160,190,221,211,144,183,155,147,170,186,171,147,170, \
+ 182,156,164,159,171,159,156,153,201,159,156,204,158,169,165,159, \
+ 162,220,189,171,210,171,200,168,201,170,204,201,201,182,201,213, \
+ 201,200,201,183,201,204,204,201,210,227,210,259,199,275,201,224, \
+ 185,218,306,204,214,206,216,186,204,204,212,204,213,227,233,228, \
+ 218,219,222,201,232,251,219,218,204,216,220,206,201,201,232,225, \
+ 224,237,208,254,246,237,266,202,225,221,227,230,236,242,224,315, \
+ 228,237,248,243,244,236,228,258,295,249,360,372,236,242,227,259, \
+ 261,237,249,292,316,221,276,264,273,249,221,225,244,221,273,224, \
+ 342,236,236,213,238,215,287,236,228,273,250,265,273,323,240,242, \
+ 253,245,264,267,260,359,285,291,302,252,272,232,227,272,340,248, \
+ 227,226,285,273,237,298,264,237,246,240,252,249,276,246,393,242, \
+ 322,381,340,419,286,278,324,273,244,254,251,270,270,336,249,448, \
+ 247,266,262,262,261,336,276,292,339,463,293,422,263,270,281,282, \
+ 377,346,288,273,284,472,259,297,321,285,439,264,266,285,348,432, \
+ 271,376,296,272,262,300,303,324,363,348,328,312,402,294,463,273, \
+ 396,344,309,288,340,378,301,352,352,317,378,274,281,442,326,284, \
+ 352,353,283,324,448,-1,287,496,293,290,321,296,408,354,383,348, \
+ 297,544,380,414,308,348,347,472,345,351,306,361,496,456,336,372, \
+ 361,306,357,363,388,396,358,503,479,370,310,348,360,361,361,431, \
+ 399,429,530,374,496,364,379,360,321,380,399,336,333,372,471,352, \
+ 448,346,347,464,386,395,427,348,375,400,362,363,326,424,422,356, \
+ 351,591,370,315,367,333,357,431,374,390,440,383,351,364,415,379, \
+ 346,378,374,535,356,331,383,368,640,423,524,348,648,339,431,334, \
+ 371,575,342,343,348,363,348,347,568,409,358,404,339,372,347,410, \
+ 641,342,591,341,360,427,389,476,536,368,361,388,372,411,388,499, \
+ 380,527,387,350,378,349,543,379,382,680,364,385,426,647,367,535, \
+ 535,420,535,604,536,423,387,399,536,379,536,374,362,438,690,551, \
+ 447,392,399,463,576,396,388,494,527,668,578,503,410,372,563,417, \
+ 415,560,480,656,560,456,439,664,532,528,523,576,536,411,412,428, \
+ 386,543,535,552,536,536,552,548,526,386,450,590,616,552,425,552, \
+ 439,536,396,427,544,644,742,401,694,574,534,536,406,632,543,535, \
+ 536,529,423,533,523,543,534,568,484,552,421,533,532,536,534,470, \
+ 552,688,416,630,570,592,550,588,406,599,503,568,544,557,566,536, \
+ 536,535,592,543,535,480,568,567,583,564,559,584,531,535,568,568, \
+ 638,680,566,576,694,450,544,582,566,601,607,580,559,626,534,584, \
+ 426,567,536,568,531,576,533,534,599,639,512,592,632,609,525,606, \
+ 530,624,552,621,600,760,536,598,599,599,543,796,624,614,557,533, \
+ 638,560,536,610,540,600,598,604,614,583,661,624,630,637,605,600, \
+ 655,655,727,693,600,600,626,664,630,664,663,600,552,596,664,658, \
+ 615,640,659,661,567,600,596,631,646,608,630,695,662,658,669,653, \
+ 660,672,600,671,717,599,600,655,573,488,664,626,664,662,663,664, \
+ 660,589,664,664,598,664,662,759,639,518,672,596,641,612,580,560, \
+ 666,562,714,663,727,528,723,721,758,662,854,695,630,571,735,830, \
+ 700,542,619,700,648,633,720,582,537,717,632,764,515,888,661,653, \
+ 870,600,696,632,726,500,684,789,628,687,773,566,506,593,696,547, \
+ 707,703,771,652,742,754,680,664,664,582,664,592,664,663,719,600 \
+
+#define MPFR_DIVHIGH_TAB  \
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, /*0-15*/ \
+ 0,0,0,0,0,0,0,0,0,0,0,0,18,0,0,0, /*16-31*/ \
+ 0,21,0,0,0,0,0,0,0,22,0,0,0,0,25,25, /*32-47*/ \
+ 30,28,0,0,0,37,34,0,0,40,0,0,0,0,0,0, /*48-63*/ \
+ 34,0,0,51,36,48,0,52,50,0,58,41,0,0,49,0, /*64-79*/ \
+ 0,0,63,0,61,0,48,56,0,0,0,54,62,57,49,56, /*80-95*/ \
+ 53,61,56,72,56,62,55,53,57,60,56,63,82,90,61,0, /*96-111*/ \
+ 87,94,62,60,60,66,75,61,102,68,64,78,66,89,71,71, /*112-127*/ \
+ 78,71,71,80,76,71,72,76,71,88,72,84,79,75,74,78, /*128-143*/ \
+ 74,83,80,85,83,84,85,78,82,120,79,104,112,102,94,112, /*144-159*/ \
+ 95,88,112,84,112,114,111,112,112,94,93,112,116,144,129,107, /*160-175*/ \
+ 100,112,112,120,94,119,120,110,111,112,165,116,112,144,100,98, /*176-191*/ \
+ 112,114,118,117,100,114,112,143,106,136,118,117,118,119,120,128, /*192-207*/ \
+ 128,114,120,116,114,128,120,120,128,112,128,136,126,128,127,127, /*208-223*/ \
+ 128,139,120,129,168,122,144,125,159,134,166,125,136,132,132,161, /*224-239*/ \
+ 125,126,136,127,127,128,128,142,126,160,228,127,128,136,135,136, /*240-255*/ \
+ 142,135,144,153,136,142,136,224,158,139,136,150,137,200,156,141, /*256-271*/ \
+ 168,147,172,192,144,177,173,153,188,205,166,147,251,168,148,168, /*272-287*/ \
+ 172,148,152,150,257,149,208,162,180,164,192,166,178,169,168,162, /*288-303*/ \
+ 154,183,160,166,160,205,209,183,224,168,173,174,173,160,199,184, /*304-319*/ \
+ 188,188,196,172,168,248,192,168,182,169,239,172,168,192,234,225, /*320-335*/ \
+ 203,193,184,188,224,197,228,217,188,196,188,200,233,178,192,192, /*336-351*/ \
+ 286,189,224,224,226,242,212,325,234,189,221,280,188,248,207,188, /*352-367*/ \
+ 254,206,227,249,192,202,189,231,224,233,228,234,192,227,194,228, /*368-383*/ \
+ 326,224,208,224,224,229,239,223,198,235,232,218,225,228,230,232, /*384-399*/ \
+ 233,224,280,262,264,210,228,258,228,240,212,252,209,228,224,223, /*400-415*/ \
+ 224,240,224,241,232,250,240,218,232,256,220,256,252,223,224,239, /*416-431*/ \
+ 240,282,224,225,239,224,240,257,224,240,224,224,234,253,228,240, /*432-447*/ \
+ 271,272,233,233,235,237,244,239,250,252,237,238,253,238,269,240, /*448-463*/ \
+ 258,244,240,241,249,286,246,256,246,255,254,252,250,289,281,255, /*464-479*/ \
+ 251,265,280,447,276,280,245,272,246,246,264,268,255,270,296,260, /*480-495*/ \
+ 270,257,256,279,270,333,291,293,280,354,268,255,260,292,349,314, /*496-511*/ \
+ 306,316,288,272,308,335,306,307,294,275,416,271,298,282,309,269, /*512-527*/ \
+ 273,287,338,276,276,275,319,273,294,277,326,274,329,281,325,372, /*528-543*/ \
+ 346,328,348,329,336,344,280,286,337,336,340,301,336,346,329,344, /*544-559*/ \
+ 282,346,353,337,347,304,304,336,376,293,344,331,312,332,401,362, /*560-575*/ \
+ 378,329,337,336,304,329,345,342,360,342,344,334,336,475,342,336, /*576-591*/ \
+ 346,335,415,335,384,337,336,345,346,347,361,339,344,353,379,336, /*592-607*/ \
+ 313,376,334,350,324,460,340,337,336,335,366,437,365,332,396,375, /*608-623*/ \
+ 376,377,350,384,376,344,351,329,335,347,378,323,376,376,384,326, /*624-639*/ \
+ 336,517,355,344,376,369,398,388,579,390,410,384,426,346,340,370, /*640-655*/ \
+ 359,384,368,448,339,375,360,377,348,606,463,353,354,384,388,357, /*656-671*/ \
+ 384,402,453,373,390,451,449,382,384,348,380,344,371,534,474,348, /*672-687*/ \
+ 359,376,392,352,348,377,352,407,382,384,377,376,360,355,432,408, /*688-703*/ \
+ 356,467,550,434,385,471,468,388,426,372,376,384,385,449,416,375, /*704-719*/ \
+ 376,467,655,475,409,386,513,475,588,505,376,576,378,468,455,380, /*720-735*/ \
+ 395,466,388,383,478,480,468,457,446,516,505,464,376,376,480,379, /*736-751*/ \
+ 450,715,380,465,514,547,450,382,518,391,465,465,390,391,660,393, /*752-767*/ \
+ 752,448,456,448,390,429,489,464,469,407,455,392,506,479,468,731, /*768-783*/ \
+ 455,502,412,456,398,483,401,468,510,472,480,408,480,456,476,568, /*784-799*/ \
+ 450,464,464,480,480,466,544,551,447,468,460,416,479,651,464,409, /*800-815*/ \
+ 478,760,468,447,487,500,468,701,468,471,533,455,456,424,481,457, /*816-831*/ \
+ 512,602,776,504,464,484,456,516,447,435,468,751,478,444,620,480, /*832-847*/ \
+ 510,477,489,535,478,753,504,554,482,468,484,465,486,483,448,556, /*848-863*/ \
+ 525,473,436,466,490,515,505,472,448,473,454,468,828,464,588,524, /*864-879*/ \
+ 466,465,488,692,478,465,541,598,482,471,466,477,486,474,498,621, /*880-895*/ \
+ 801,500,466,473,506,773,477,463,480,486,469,621,801,508,597,909, /*896-911*/ \
+ 480,476,464,773,495,480,468,469,542,536,480,467,480,524,566,548, /*912-927*/ \
+ 756,479,508,508,475,475,848,477,659,767,743,496,500,655,476,708, /*928-943*/ \
+ 672,536,485,515,480,478,799,480,481,521,512,504,658,533,643,488, /*944-959*/ \
+ 573,579,679,790,850,502,495,547,503,503,792,500,787,660,499,512, /*960-975*/ \
+ 500,498,512,493,510,541,524,653,529,528,500,512,502,510,511,658, /*976-991*/ \
+ 646,595,528,528,652,585,531,664,510,538,516,505,660,672,660,544, /*992-1007*/ \
+ 669,559,697,545,533,515,672,589,649,567,636,658,570,634,737,544 /*1008-1023*/ \
+
+#define MPFR_MUL_THRESHOLD 10 /* limbs */
+#define MPFR_SQR_THRESHOLD 9 /* limbs */
+#define MPFR_DIV_THRESHOLD 10 /* limbs */
+#define MPFR_DIV_Q_THRESHOLD 1893 /* limbs */
+#define MPFR_EXP_2_THRESHOLD 826 /* bits */
+#define MPFR_EXP_THRESHOLD 14599 /* bits */
+#define MPFR_SINCOS_THRESHOLD 13848 /* bits */
+#define MPFR_AI_THRESHOLD1 3607 /* threshold for negative input of mpfr_ai */
+#define MPFR_AI_THRESHOLD2 2188
+#define MPFR_AI_THRESHOLD3 -9718
+/* Tuneup completed successfully, took 1154 seconds */
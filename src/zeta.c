@@ -78,8 +78,9 @@ mpfr_zeta_part_b (mpfr_ptr b, mpfr_srcptr s, int n, int p, mpfr_t *tc)
   MPFR_GROUP_CLEAR (group);
 }
 
-/* Input: p - an integer
-   Output: fills tc[1..p], tc[i] = bernoulli(2i)/(2i)!
+/* Input: p0, p - integers
+   Output: fills tc[p0+1..p], tc[i] = bernoulli(2i)/(2i)!,
+   assuming tc[1..p0] have already been computed
    tc[1]=1/12, tc[2]=-1/720, tc[3]=1/30240, ...
    Assumes all the tc[i] have the same precision.
 
@@ -99,17 +100,18 @@ mpfr_zeta_part_b (mpfr_ptr b, mpfr_srcptr s, int n, int p, mpfr_t *tc)
    multiplication per term, instead of O(k) small divisions.
 */
 static void
-mpfr_zeta_c (int p, mpfr_t *tc)
+mpfr_zeta_c (int p0, int p, mpfr_t *tc)
 {
-  if (p > 0)
+  if (p > p0)
     {
       mpfr_t d;
       int k, l;
-      mpfr_prec_t prec = MPFR_PREC (tc[1]);
+      mpfr_prec_t prec = MPFR_PREC (tc[p]);
 
       mpfr_init2 (d, prec);
-      mpfr_div_ui (tc[1], __gmpfr_one, 12, MPFR_RNDN);
-      for (k = 2; k <= p; k++)
+      if (p0 == 0)
+        mpfr_div_ui (tc[1], __gmpfr_one, 12, MPFR_RNDN);
+      for (k = MAX (2, p0 + 1); k <= p; k++)
         {
           mpfr_set_ui (d, k-1, MPFR_RNDN);
           mpfr_div_ui (d, d, 12*k+6, MPFR_RNDN);
@@ -125,6 +127,73 @@ mpfr_zeta_c (int p, mpfr_t *tc)
     }
 }
 
+/* Cache for the coefficients tc[1..p] computed by mpfr_zeta_c, shared
+   by the successive calls of mpfr_zeta_pos done by mpfr_zeta_vec.
+   Since tc[k] only depends on tc[1..k-1] and on the working precision,
+   the coefficients can be extended from p to p' > p without changing
+   tc[1..p], so that the results do not depend on the cache state. */
+typedef struct {
+  mpfr_t *tc;          /* tc[1..p] are initialized, tc[0] is unused */
+  int p;
+  int alloc;           /* number of allocated entries, including tc[0] */
+  mpfr_prec_t prec;    /* common precision of tc[1..p] */
+} mpfr_zeta_tc_t;
+
+static void
+mpfr_zeta_tc_init (mpfr_zeta_tc_t *cache)
+{
+  cache->tc = NULL;
+  cache->p = 0;
+  cache->alloc = 0;
+  cache->prec = 0;
+}
+
+static void
+mpfr_zeta_tc_clear (mpfr_zeta_tc_t *cache)
+{
+  int l;
+
+  for (l = 1; l <= cache->p; l++)
+    mpfr_clear (cache->tc[l]);
+  if (cache->alloc != 0)
+    mpfr_free_func (cache->tc, cache->alloc * sizeof (mpfr_t));
+  mpfr_zeta_tc_init (cache);
+}
+
+/* Return an array whose entries 1 to p contain the coefficients tc[i]
+   computed with precision prec, reusing the ones from the cache. */
+static mpfr_t *
+mpfr_zeta_tc_get (mpfr_zeta_tc_t *cache, int p, mpfr_prec_t prec)
+{
+  int l;
+
+  if (cache->prec != prec)
+    {
+      for (l = 1; l <= cache->p; l++)
+        mpfr_clear (cache->tc[l]);
+      cache->p = 0;
+      cache->prec = prec;
+    }
+  if (p > cache->p)
+    {
+      if (p + 1 > cache->alloc)
+        {
+          int alloc = MAX (p + 1, 2 * cache->alloc);
+
+          cache->tc = (mpfr_t *) (cache->alloc == 0 ?
+            mpfr_allocate_func (alloc * sizeof (mpfr_t)) :
+            mpfr_reallocate_func (cache->tc, cache->alloc * sizeof (mpfr_t),
+                                  alloc * sizeof (mpfr_t)));
+          cache->alloc = alloc;
+        }
+      for (l = cache->p + 1; l <= p; l++)
+        mpfr_init2 (cache->tc[l], prec);
+      mpfr_zeta_c (cache->p, p, cache->tc);
+      cache->p = p;
+    }
+  return cache->tc;
+}
+
 /* Input: s - a floating-point number
           n - an integer
    Output: sum - a floating-point number approximating sum(1/i^s, i=1..n-1) */
@@ -153,11 +222,13 @@ mpfr_zeta_part_a (mpfr_ptr sum, mpfr_srcptr s, int n)
 
 /* Input: s - a floating-point number >= 1/2.
           rnd_mode - a rounding mode.
+          cache - a cache for the tc[] coefficients, or NULL.
           Assumes s is neither NaN nor Infinite.
    Output: z - Zeta(s) rounded to the precision of z with direction rnd_mode
 */
 static int
-mpfr_zeta_pos (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode)
+mpfr_zeta_pos (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode,
+               mpfr_zeta_tc_t *cache)
 {
   mpfr_t b, c, z_pre, f, s1;
   double beta, sd, dnep;
@@ -260,16 +331,22 @@ mpfr_zeta_pos (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode)
 
           /* internal precision is dint */
 
-          size = (p + 1) * sizeof(mpfr_t);
-          tc1 = (mpfr_t*) mpfr_allocate_func (size);
-          for (l=1; l<=p; l++)
-            mpfr_init2 (tc1[l], dint);
+          if (cache != NULL)
+            tc1 = mpfr_zeta_tc_get (cache, p, dint);
+          else
+            {
+              size = (p + 1) * sizeof(mpfr_t);
+              tc1 = (mpfr_t*) mpfr_allocate_func (size);
+              for (l=1; l<=p; l++)
+                mpfr_init2 (tc1[l], dint);
+            }
           MPFR_GROUP_REPREC_4 (group, dint, b, c, z_pre, f);
 
           /* precision of z is precz */
 
           /* Computation of the coefficients c_k */
-          mpfr_zeta_c (p, tc1);
+          if (cache == NULL)
+            mpfr_zeta_c (0, p, tc1);
           /* Computation of the 3 parts of the function Zeta. */
           mpfr_zeta_part_a (z_pre, s, n);
           mpfr_zeta_part_b (b, s, n, p, tc1);
@@ -279,9 +356,12 @@ mpfr_zeta_pos (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode)
           mpfr_div (c, c, f, MPFR_RNDN);
           mpfr_add (z_pre, z_pre, c, MPFR_RNDN);
           mpfr_add (z_pre, z_pre, b, MPFR_RNDN);
-          for (l=1; l<=p; l++)
-            mpfr_clear (tc1[l]);
-          mpfr_free_func (tc1, size);
+          if (cache == NULL)
+            {
+              for (l=1; l<=p; l++)
+                mpfr_clear (tc1[l]);
+              mpfr_free_func (tc1, size);
+            }
           /* End branch 2 */
         }
 
@@ -360,7 +440,7 @@ compute_add (mpfr_srcptr s, mpfr_prec_t precz)
    The comments in the code are for rnd = RNDD. */
 static void
 mpfr_reflection_overflow (mpfr_ptr z, mpfr_ptr s1, mpfr_srcptr s, mpfr_ptr y,
-                          mpfr_ptr p, mpfr_rnd_t rnd)
+                          mpfr_ptr p, mpfr_rnd_t rnd, mpfr_zeta_tc_t *cache)
 {
   mpz_t sint;
 
@@ -416,7 +496,7 @@ mpfr_reflection_overflow (mpfr_ptr z, mpfr_ptr s1, mpfr_srcptr s, mpfr_ptr y,
     }
   mpz_clear (sint);
   /* now y <= |sin(Pi*s/2)| when rnd=RNDD, y >= |sin(Pi*s/2)| when rnd=RNDU */
-  mpfr_zeta_pos (z, s1, rnd); /* zeta(1-s) */
+  mpfr_zeta_pos (z, s1, rnd, cache); /* zeta(1-s) */
   mpfr_mul (z, z, y, rnd);
   /* now z <= |sin(Pi*s/2)|*zeta(1-s) */
   mpfr_log (z, z, rnd);
@@ -434,8 +514,9 @@ mpfr_reflection_overflow (mpfr_ptr z, mpfr_ptr s1, mpfr_srcptr s, mpfr_ptr y,
     mpfr_nextbelow (p); /* restore original p */
 }
 
-int
-mpfr_zeta (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode)
+static int
+mpfr_zeta_aux (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode,
+               mpfr_zeta_tc_t *cache)
 {
   mpfr_t z_pre, s1, y, p;
   long add;
@@ -535,7 +616,7 @@ mpfr_zeta (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode)
 
   /* Compute Zeta */
   if (MPFR_IS_POS (s) && MPFR_GET_EXP (s) >= 0) /* Case s >= 1/2 */
-    inex = mpfr_zeta_pos (z, s, rnd_mode);
+    inex = mpfr_zeta_pos (z, s, rnd_mode, cache);
   else /* use reflection formula
           zeta(s) = 2^s*Pi^(s-1)*sin(Pi*s/2)*gamma(1-s)*zeta(1-s) */
     {
@@ -590,7 +671,8 @@ mpfr_zeta (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode)
                  4. Correct the sign from the sign of sin(...).
                  5. Round then multiply by 2. Here, an overflow in either
                  operation means a real overflow. */
-              mpfr_reflection_overflow (z_pre, s1, s, y, p, MPFR_RNDD);
+              mpfr_reflection_overflow (z_pre, s1, s, y, p, MPFR_RNDD,
+                                        cache);
               /* z_pre is a lower bound of |zeta(s)|/2, thus if it overflows,
                  or has exponent emax, then |zeta(s)| overflows too. */
               if (MPFR_IS_INF (z_pre) || MPFR_GET_EXP(z_pre) == __gmpfr_emax)
@@ -605,7 +687,8 @@ mpfr_zeta (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode)
                   int ok = 0;
                   mpfr_t z_down;
                   mpfr_init2 (z_up, mpfr_get_prec (z_pre));
-                  mpfr_reflection_overflow (z_up, s1, s, y, p, MPFR_RNDU);
+                  mpfr_reflection_overflow (z_up, s1, s, y, p, MPFR_RNDU,
+                                            cache);
                   /* if the lower approximation z_pre does not overflow, but
                      z_up does, we need more precision */
                   if (MPFR_IS_INF (z_up) || MPFR_GET_EXP(z_up) == __gmpfr_emax)
@@ -633,7 +716,7 @@ mpfr_zeta (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode)
                     goto next_loop;
                 }
             }
-          mpfr_zeta_pos (z_pre, s1, MPFR_RNDN);   /* zeta(1-s)  */
+          mpfr_zeta_pos (z_pre, s1, MPFR_RNDN, cache); /* zeta(1-s) */
           mpfr_mul (z_pre, z_pre, y, MPFR_RNDN);  /* gamma(1-s)*zeta(1-s) */
 
           /* multiply z_pre by 2^s*Pi^(s-1) where p=Pi, s1=1-s */
@@ -685,3 +768,39 @@ mpfr_zeta (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode)
   MPFR_SAVE_EXPO_FREE (expo);
   return mpfr_check_range (z, inex, rnd_mode);
 }
+
+int
+mpfr_zeta (mpfr_ptr z, mpfr_srcptr s, mpfr_rnd_t rnd_mode)
+{
+  MPFR_PERF_FUNC (MPFR_PREC (z));
+
+  return mpfr_zeta_aux (z, s, rnd_mode, NULL);
+}
+
+/* Set z[i] to zeta(s[i]) for 0 <= i < n. The Bernoulli-like coefficients
+   tc[] only depend on the working precision (and on how many of them are
+   needed), thus they are computed once and shared by all the evaluations
+   done at the same working precision, in particular when all z[i] (resp.
+   all s[i]) have the same precision. The results are identical to those
+   of mpfr_zeta. */
+int
+mpfr_zeta_vec (const mpfr_ptr *z, int *inex, const mpfr_ptr *s,
+               unsigned long n, mpfr_rnd_t rnd_mode)
+{
+  mpfr_zeta_tc_t cache;
+  unsigned long i;
+  int ret = 0;
+
+  MPFR_LOG_FUNC (("n=%lu rnd=%d", n, rnd_mode), ("ret=%d", ret));
+
+  mpfr_zeta_tc_init (&cache);
+  for (i = 0; i < n; i++)
+    {
+      int t = mpfr_zeta_aux (z[i], s[i], rnd_mode, &cache);
+      if (inex != NULL)
+        inex[i] = t;
+      ret |= t != 0;
+    }
+  mpfr_zeta_tc_clear (&cache);
+  return ret;
+}
@@ -22,6 +22,230 @@ If not, see <https://www.gnu.org/licenses/>. */
 #define MPFR_NEED_LONGLONG_H
 #include "mpfr-impl.h"
 
+/* Set q to floor(d/k^m), where d >= 0, k >= 1 and m >= 1, using u as a
+   temporary variable. The variables q and d may be the same. */
+static void
+mpfr_zeta_ui_tdiv_pow (mpz_t q, mpz_t d, unsigned long k, unsigned long m,
+                       mpz_t u)
+{
+  unsigned long kbits;
+
+  count_leading_zeros (kbits, k);
+  kbits = GMP_NUMB_BITS - kbits;
+  /* if k^m is too large, use mpz_tdiv_q */
+  if (m * kbits > 2 * GMP_NUMB_BITS)
+    {
+      /* if we know in advance that k^m > d, then floor(d/k^m) will
+         be zero below, so there is no need to compute k^m */
+      kbits = (kbits - 1) * m + 1;
+      /* k^m has at least kbits bits */
+      if (kbits > mpz_sizeinbase (d, 2))
+        mpz_set_ui (q, 0);
+      else
+        {
+          mpz_ui_pow_ui (u, k, m);
+          mpz_tdiv_q (q, d, u);
+        }
+    }
+  else /* use several mpz_tdiv_q_ui calls */
+    {
+      unsigned long km = k, mm = m - 1;
+      while (mm > 0 && km < ULONG_MAX / k)
+        {
+          km *= k;
+          mm --;
+        }
+      mpz_tdiv_q_ui (q, d, km);
+      while (mm > 0)
+        {
+          km = k;
+          mm --;
+          while (mm > 0 && km < ULONG_MAX / k)
+            {
+              km *= k;
+              mm --;
+            }
+          mpz_tdiv_q_ui (q, q, km);
+        }
+    }
+}
+
+/* Compute in y[j] an approximation of zeta(ms[j]) for 0 <= j < cnt, where
+   2 <= ms[0] < ms[1] < ... < ms[cnt-1], with working precision p, which
+   must be the precision of all the y[j]. The error on y[j] is bounded by
+   err[j] ulps.
+
+   The d[k] below do not depend on m, and since floor(floor(a/b)/c) =
+   floor(a/(bc)) for positive integers, the quotients floor(d[k]/k^m)
+   for the successive exponents are obtained from each other by small
+   divisions, thus a single pass over k serves all the exponents, and the
+   results are the same as with separate computations. */
+static void
+mpfr_zeta_ui_borwein (mpfr_t *y, unsigned long *err, const unsigned long *ms,
+                      unsigned long cnt, mpfr_prec_t p)
+{
+  unsigned long n, k, j;
+  mpz_t d, t, q, u, *s;
+
+  s = (mpz_t *) mpfr_allocate_func (cnt * sizeof (mpz_t));
+  for (j = 0; j < cnt; j++)
+    mpz_init_set_ui (s[j], 0);
+  mpz_init (d);
+  mpz_init (t);
+  mpz_init (q);
+  mpz_init (u);
+
+  /* 0.39321985067869744 = log(2)/log(3+sqrt(8)) */
+  n = 1 + (unsigned long) (0.39321985067869744 * (double) p);
+
+  /* computation of the d[k] */
+  mpz_set_ui (t, 1);
+  mpz_mul_2exp (t, t, 2 * n - 1); /* t[n] */
+  mpz_set (d, t);
+  for (k = n; k > 0; k--)
+    {
+      for (j = 0; j < cnt; j++)
+        {
+          mpfr_zeta_ui_tdiv_pow (q, j == 0 ? d : q, k,
+                                 j == 0 ? ms[0] : ms[j] - ms[j-1], u);
+          if (mpz_sgn (q) == 0)
+            break; /* the next quotients are zero too */
+          if (k % 2)
+            mpz_add (s[j], s[j], q);
+          else
+            mpz_sub (s[j], s[j], q);
+        }
+
+      /* we have d[k] = sum(t[i], i=k+1..n)
+         with t[i] = n*(n+i-1)!*4^i/(n-i)!/(2i)!
+         t[k-1]/t[k] = k*(2k-1)/(n-k+1)/(n+k-1)/2 */
+#if (GMP_NUMB_BITS == 32)
+#define KMAX 46341 /* max k such that k*(2k-1) < 2^32 */
+#elif (GMP_NUMB_BITS == 64)
+#define KMAX 3037000500
+#endif
+#ifdef KMAX
+      if (k <= KMAX)
+        mpz_mul_ui (t, t, k * (2 * k - 1));
+      else
+#endif
+        {
+          mpz_mul_ui (t, t, k);
+          mpz_mul_ui (t, t, 2 * k - 1);
+        }
+      mpz_fdiv_q_2exp (t, t, 1);
+      /* Warning: the test below assumes that an unsigned long
+         has no padding bits. */
+      if (n < 1UL << ((sizeof(unsigned long) * CHAR_BIT) / 2))
+        /* (n - k + 1) * (n + k - 1) < n^2 */
+        mpz_divexact_ui (t, t, (n - k + 1) * (n + k - 1));
+      else
+        {
+          mpz_divexact_ui (t, t, n - k + 1);
+          mpz_divexact_ui (t, t, n + k - 1);
+        }
+      mpz_add (d, d, t);
+    }
+
+  for (j = 0; j < cnt; j++)
+    {
+      unsigned long e = n + 4;
+
+      /* multiply by 1/(1-2^(1-m)) = 1 + 2^(1-m) + 2^(2-m) + ... */
+      mpz_fdiv_q_2exp (t, s[j], ms[j] - 1);
+      do
+        {
+          e ++;
+          mpz_add (s[j], s[j], t);
+          mpz_fdiv_q_2exp (t, t, ms[j] - 1);
+        }
+      while (mpz_cmp_ui (t, 0) > 0);
+
+      /* divide by d[n] */
+      mpz_mul_2exp (s[j], s[j], p);
+      mpz_tdiv_q (s[j], s[j], d);
+      mpfr_set_z (y[j], s[j], MPFR_RNDN);
+      mpfr_div_2ui (y[j], y[j], p, MPFR_RNDN);
+
+      err[j] = MPFR_INT_CEIL_LOG2 (e);
+      mpz_clear (s[j]);
+    }
+
+  mpfr_free_func (s, cnt * sizeof (mpz_t));
+  mpz_clear (d);
+  mpz_clear (t);
+  mpz_clear (q);
+  mpz_clear (u);
+}
+
+/* Handle the cases m >= 2 where zeta(m) is so close to 1 or to 1 + 2^(-m)
+   that the correct rounding can be determined without any computation.
+   Return non-zero if this is the case, with the ternary value in *inex.
+   Assumes r <> MPFR_RNDA and an extended exponent range. */
+static int
+mpfr_zeta_ui_near_one (mpfr_ptr z, unsigned long m, mpfr_rnd_t r, int *inex)
+{
+  mpfr_prec_t p = MPFR_PREC(z);
+  mpfr_t y;
+  int ret = 0;
+
+  if (m >= p) /* 2^(-m) < ulp(1) = 2^(1-p). This means that
+                 2^(-m) <= 1/2*ulp(1). We have 3^(-m)+4^(-m)+... < 2^(-m)
+                 i.e. zeta(m) < 1+2*2^(-m) for m >= 3 */
+    {
+      if (m == 2) /* necessarily p=2 */
+        *inex = mpfr_set_ui_2exp (z, 13, -3, r);
+      else if (r == MPFR_RNDZ || r == MPFR_RNDD ||
+               (r == MPFR_RNDN && m > p))
+        {
+          mpfr_set_ui (z, 1, r);
+          *inex = -1;
+        }
+      else
+        {
+          mpfr_set_ui (z, 1, r);
+          mpfr_nextabove (z);
+          *inex = 1;
+        }
+      return 1;
+    }
+
+  /* now treat also the case where zeta(m) - (1+1/2^m) < 1/2*ulp(1),
+     and the result is either 1+2^(-m) or 1+2^(-m)+2^(1-p). */
+  if (m >= p / 2) /* otherwise 4^(-m) > 2^(-p) */
+    {
+      mpfr_init2 (y, 31);
+      /* the following is a lower bound for log(3)/log(2) */
+      mpfr_set_str_binary (y, "1.100101011100000000011010001110");
+      mpfr_mul_ui (y, y, m, MPFR_RNDZ); /* lower bound for log2(3^m) */
+      if (mpfr_cmp_ui (y, p + 2) >= 0)
+        {
+          mpfr_set_ui (z, 1, MPFR_RNDZ);
+          mpfr_div_2ui (z, z, m, MPFR_RNDZ);
+          mpfr_add_ui (z, z, 1, MPFR_RNDZ);
+          if (r != MPFR_RNDU)
+            *inex = -1;
+          else
+            {
+              mpfr_nextabove (z);
+              *inex = 1;
+            }
+          ret = 1;
+        }
+      mpfr_clear (y);
+    }
+
+  return ret;
+}
+
+/* Initial working precision for a target precision p */
+static mpfr_prec_t
+mpfr_zeta_ui_wprec (mpfr_prec_t p)
+{
+  p += MPFR_INT_CEIL_LOG2(p); /* account of the n term in the error */
+  return p + MPFR_INT_CEIL_LOG2(p) + 15; /* initial value */
+}
+
 int
 mpfr_zeta_ui (mpfr_ptr z, unsigned long m, mpfr_rnd_t r)
 {
@@ -42,9 +266,8 @@ mpfr_zeta_ui (mpfr_ptr z, unsigned long m, mpfr_rnd_t r)
     }
   else /* m >= 2 */
     {
-      mpfr_prec_t p = MPFR_PREC(z);
-      unsigned long n, k, err, kbits;
-      mpz_t d, t, s, q;
+      mpfr_prec_t p;
+      unsigned long err;
       mpfr_t y;
       int inex;
       MPFR_SAVE_EXPO_DECL (expo);
@@ -54,188 +277,144 @@ mpfr_zeta_ui (mpfr_ptr z, unsigned long m, mpfr_rnd_t r)
 
       MPFR_SAVE_EXPO_MARK (expo);
 
-      if (m >= p) /* 2^(-m) < ulp(1) = 2^(1-p). This means that
-                     2^(-m) <= 1/2*ulp(1). We have 3^(-m)+4^(-m)+... < 2^(-m)
-                     i.e. zeta(m) < 1+2*2^(-m) for m >= 3 */
-        {
-          if (m == 2) /* necessarily p=2 */
-            inex = mpfr_set_ui_2exp (z, 13, -3, r);
-          else if (r == MPFR_RNDZ || r == MPFR_RNDD ||
-                   (r == MPFR_RNDN && m > p))
-            {
-              mpfr_set_ui (z, 1, r);
-              inex = -1;
-            }
-          else
-            {
-              mpfr_set_ui (z, 1, r);
-              mpfr_nextabove (z);
-              inex = 1;
-            }
-          goto end;
-        }
+      if (mpfr_zeta_ui_near_one (z, m, r, &inex))
+        goto end;
 
-      /* now treat also the case where zeta(m) - (1+1/2^m) < 1/2*ulp(1),
-         and the result is either 1+2^(-m) or 1+2^(-m)+2^(1-p). */
-      mpfr_init2 (y, 31);
+      p = mpfr_zeta_ui_wprec (MPFR_PREC(z));
+      mpfr_init2 (y, p);
 
-      if (m >= p / 2) /* otherwise 4^(-m) > 2^(-p) */
+      MPFR_ZIV_INIT (loop, p);
+      for(;;)
         {
-          /* the following is a lower bound for log(3)/log(2) */
-          mpfr_set_str_binary (y, "1.100101011100000000011010001110");
-          mpfr_mul_ui (y, y, m, MPFR_RNDZ); /* lower bound for log2(3^m) */
-          if (mpfr_cmp_ui (y, p + 2) >= 0)
-            {
-              mpfr_clear (y);
-              mpfr_set_ui (z, 1, MPFR_RNDZ);
-              mpfr_div_2ui (z, z, m, MPFR_RNDZ);
-              mpfr_add_ui (z, z, 1, MPFR_RNDZ);
-              if (r != MPFR_RNDU)
-                inex = -1;
-              else
-                {
-                  mpfr_nextabove (z);
-                  inex = 1;
-                }
-              goto end;
-            }
+          mpfr_set_prec (y, p);
+          mpfr_zeta_ui_borwein (&y, &err, &m, 1, p);
+
+          if (MPFR_LIKELY(MPFR_CAN_ROUND (y, p - err, MPFR_PREC(z), r)))
+            break;
+
+          MPFR_ZIV_NEXT (loop, p);
         }
+      MPFR_ZIV_FREE (loop);
+
+      inex = mpfr_set (z, y, r);
+      mpfr_clear (y);
+
+    end:
+      MPFR_LOG_VAR (z);
+      MPFR_LOG_MSG (("inex = %d before mpfr_check_range\n", inex));
+      MPFR_SAVE_EXPO_FREE (expo);
+      return mpfr_check_range (z, inex, r);
+    }
+}
+
+/* Set z[i] to zeta(m+i) for 0 <= i < n. The values that cannot be
+   obtained directly are computed together by mpfr_zeta_ui_borwein,
+   which shares the Borwein sums between the different exponents. */
+int
+mpfr_zeta_ui_range (const mpfr_ptr *z, int *inex, unsigned long m,
+                    unsigned long n, mpfr_rnd_t r)
+{
+  unsigned long i, j, cnt, alloc, *idx, *ms, *err;
+  mpfr_t *y;
+  mpfr_prec_t p;
+  int *t, ret = 0;
+  MPFR_ZIV_DECL (loop);
+  MPFR_SAVE_EXPO_DECL (expo);
+
+  MPFR_LOG_FUNC (("m=%lu n=%lu rnd=%d", m, n, r), ("ret=%d", ret));
+
+  if (n == 0)
+    return 0;
+
+  MPFR_ASSERTN (m + (n - 1) >= m); /* no wraparound */
+
+  t = (int *) mpfr_allocate_func (n * sizeof (int));
+  idx = (unsigned long *) mpfr_allocate_func (3 * n * sizeof (unsigned long));
+  ms = idx + n;
+  err = ms + n;
 
-      mpz_init (s);
-      mpz_init (d);
-      mpz_init (t);
-      mpz_init (q);
+  /* zeta(0) and zeta(1) */
+  for (i = 0; i < n && m + i < 2; i++)
+    t[i] = mpfr_zeta_ui (z[i], m + i, r);
 
-      p += MPFR_INT_CEIL_LOG2(p); /* account of the n term in the error */
+  if (r == MPFR_RNDA)
+    r = MPFR_RNDU; /* since the other results are positive */
 
-      p += MPFR_INT_CEIL_LOG2(p) + 15; /* initial value */
+  MPFR_SAVE_EXPO_MARK (expo);
+
+  /* the exponents m+i that need the Borwein sums, in increasing order */
+  cnt = 0;
+  p = MPFR_PREC_MIN;
+  for (j = i; j < n; j++)
+    if (! mpfr_zeta_ui_near_one (z[j], m + j, r, &t[j]))
+      {
+        idx[cnt] = j;
+        ms[cnt] = m + j;
+        cnt++;
+        if (MPFR_PREC (z[j]) > p)
+          p = MPFR_PREC (z[j]);
+      }
+
+  if (cnt != 0)
+    {
+      alloc = cnt;
+      y = (mpfr_t *) mpfr_allocate_func (alloc * sizeof (mpfr_t));
+      for (j = 0; j < cnt; j++)
+        mpfr_init2 (y[j], MPFR_PREC_MIN);
+      p = mpfr_zeta_ui_wprec (p);
 
       MPFR_ZIV_INIT (loop, p);
-      for(;;)
+      for (;;)
         {
-          /* 0.39321985067869744 = log(2)/log(3+sqrt(8)) */
-          n = 1 + (unsigned long) (0.39321985067869744 * (double) p);
-          err = n + 4;
+          unsigned long k;
 
-          mpfr_set_prec (y, p);
+          for (j = 0; j < cnt; j++)
+            mpfr_set_prec (y[j], p);
+          mpfr_zeta_ui_borwein (y, err, ms, cnt, p);
 
-          /* computation of the d[k] */
-          mpz_set_ui (s, 0);
-          mpz_set_ui (t, 1);
-          mpz_mul_2exp (t, t, 2 * n - 1); /* t[n] */
-          mpz_set (d, t);
-          for (k = n; k > 0; k--)
+          /* keep in idx[], ms[] only the exponents for which the rounding
+             test fails */
+          for (j = k = 0; j < cnt; j++)
             {
-              count_leading_zeros (kbits, k);
-              kbits = GMP_NUMB_BITS - kbits;
-              /* if k^m is too large, use mpz_tdiv_q */
-              if (m * kbits > 2 * GMP_NUMB_BITS)
-                {
-                  /* if we know in advance that k^m > d, then floor(d/k^m) will
-                     be zero below, so there is no need to compute k^m */
-                  kbits = (kbits - 1) * m + 1;
-                  /* k^m has at least kbits bits */
-                  if (kbits > mpz_sizeinbase (d, 2))
-                    mpz_set_ui (q, 0);
-                  else
-                    {
-                      mpz_ui_pow_ui (q, k, m);
-                      mpz_tdiv_q (q, d, q);
-                    }
-                }
-              else /* use several mpz_tdiv_q_ui calls */
-                {
-                  unsigned long km = k, mm = m - 1;
-                  while (mm > 0 && km < ULONG_MAX / k)
-                    {
-                      km *= k;
-                      mm --;
-                    }
-                  mpz_tdiv_q_ui (q, d, km);
-                  while (mm > 0)
-                    {
-                      km = k;
-                      mm --;
-                      while (mm > 0 && km < ULONG_MAX / k)
-                        {
-                          km *= k;
-                          mm --;
-                        }
-                      mpz_tdiv_q_ui (q, q, km);
-                    }
-                }
-              if (k % 2)
-                mpz_add (s, s, q);
-              else
-                mpz_sub (s, s, q);
+              mpfr_ptr zj = z[idx[j]];
 
-              /* we have d[k] = sum(t[i], i=k+1..n)
-                 with t[i] = n*(n+i-1)!*4^i/(n-i)!/(2i)!
-                 t[k-1]/t[k] = k*(2k-1)/(n-k+1)/(n+k-1)/2 */
-#if (GMP_NUMB_BITS == 32)
-#define KMAX 46341 /* max k such that k*(2k-1) < 2^32 */
-#elif (GMP_NUMB_BITS == 64)
-#define KMAX 3037000500
-#endif
-#ifdef KMAX
-              if (k <= KMAX)
-                mpz_mul_ui (t, t, k * (2 * k - 1));
-              else
-#endif
-                {
-                  mpz_mul_ui (t, t, k);
-                  mpz_mul_ui (t, t, 2 * k - 1);
-                }
-              mpz_fdiv_q_2exp (t, t, 1);
-              /* Warning: the test below assumes that an unsigned long
-                 has no padding bits. */
-              if (n < 1UL << ((sizeof(unsigned long) * CHAR_BIT) / 2))
-                /* (n - k + 1) * (n + k - 1) < n^2 */
-                mpz_divexact_ui (t, t, (n - k + 1) * (n + k - 1));
+              if (MPFR_LIKELY (MPFR_CAN_ROUND (y[j], p - err[j],
+                                               MPFR_PREC (zj), r)))
+                t[idx[j]] = mpfr_set (zj, y[j], r);
               else
                 {
-                  mpz_divexact_ui (t, t, n - k + 1);
-                  mpz_divexact_ui (t, t, n + k - 1);
+                  idx[k] = idx[j];
+                  ms[k] = ms[j];
+                  k++;
                 }
-              mpz_add (d, d, t);
             }
-
-          /* multiply by 1/(1-2^(1-m)) = 1 + 2^(1-m) + 2^(2-m) + ... */
-          mpz_fdiv_q_2exp (t, s, m - 1);
-          do
-            {
-              err ++;
-              mpz_add (s, s, t);
-              mpz_fdiv_q_2exp (t, t, m - 1);
-            }
-          while (mpz_cmp_ui (t, 0) > 0);
-
-          /* divide by d[n] */
-          mpz_mul_2exp (s, s, p);
-          mpz_tdiv_q (s, s, d);
-          mpfr_set_z (y, s, MPFR_RNDN);
-          mpfr_div_2ui (y, y, p, MPFR_RNDN);
-
-          err = MPFR_INT_CEIL_LOG2 (err);
-
-          if (MPFR_LIKELY(MPFR_CAN_ROUND (y, p - err, MPFR_PREC(z), r)))
+          if (k == 0)
             break;
 
+          for (j = k; j < cnt; j++)
+            mpfr_clear (y[j]);
+          cnt = k;
           MPFR_ZIV_NEXT (loop, p);
         }
       MPFR_ZIV_FREE (loop);
 
-      mpz_clear (d);
-      mpz_clear (t);
-      mpz_clear (q);
-      mpz_clear (s);
-      inex = mpfr_set (z, y, r);
-      mpfr_clear (y);
+      for (j = 0; j < cnt; j++)
+        mpfr_clear (y[j]);
+      mpfr_free_func (y, alloc * sizeof (mpfr_t));
+    }
 
-    end:
-      MPFR_LOG_VAR (z);
-      MPFR_LOG_MSG (("inex = %d before mpfr_check_range\n", inex));
-      MPFR_SAVE_EXPO_FREE (expo);
-      return mpfr_check_range (z, inex, r);
+  MPFR_SAVE_EXPO_FREE (expo);
+
+  for (i = 0; i < n; i++)
+    {
+      if (m + i >= 2)
+        t[i] = mpfr_check_range (z[i], t[i], r);
+      if (inex != NULL)
+        inex[i] = t[i];
+      ret |= t[i] != 0;
     }
+
+  mpfr_free_func (idx, 3 * n * sizeof (unsigned long));
+  mpfr_free_func (t, n * sizeof (int));
+  return ret;
 }
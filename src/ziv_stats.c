@@ -0,0 +1,105 @@
+/* mpfr_ziv_stats, mpfr_ziv_stats_reset -- Ziv loop statistics
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-impl.h"
+
+/* List of the Ziv loop records of the current thread that have been
+   entered at least once (see MPFR_ZIV_STAT_DECL in mpfr-impl.h). The
+   records are static variables, thus are never freed. */
+static MPFR_THREAD_ATTR struct __mpfr_ziv_stat_s *ziv_stats = NULL;
+
+/* Count an entry in the Ziv loop of record s if first is non-zero,
+   otherwise a new iteration, in s and in the performance counters of
+   the current function (see MPFR_PERF_FUNC). Only called while the
+   performance counters are enabled. */
+void
+mpfr_ziv_stat_count (struct __mpfr_ziv_stat_s *s, int first)
+{
+  if (MPFR_UNLIKELY (! s->registered))
+    {
+      s->next = ziv_stats;
+      s->registered = 1;
+      ziv_stats = s;
+    }
+  s->loops += first;
+  s->iterations ++;
+  if (__gmpfr_perf_current != NULL)
+    {
+      __gmpfr_perf_current->d.ziv_loops += first;
+      __gmpfr_perf_current->d.ziv_iterations ++;
+    }
+}
+
+/* Several records may have the same name (when a function has several
+   Ziv loops, or for static functions with the same name in different
+   files): they are merged.
+   Return the number of distinct functions, and store the data of the
+   first n ones in the arrays that are not null pointers. */
+size_t
+mpfr_ziv_stats (const char **name, unsigned long *loops,
+                unsigned long *iterations, size_t n)
+{
+  struct __mpfr_ziv_stat_s *s, *t;
+  size_t k = 0;
+
+  for (s = ziv_stats; s != NULL; s = s->next)
+    {
+      unsigned long l, it;
+
+      /* skip this record if its name has already been seen */
+      for (t = ziv_stats; t != s; t = t->next)
+        if (strcmp (t->name, s->name) == 0)
+          break;
+      if (t != s)
+        continue;
+
+      l = it = 0;
+      for (t = s; t != NULL; t = t->next)
+        if (strcmp (t->name, s->name) == 0)
+          {
+            l += t->loops;
+            it += t->iterations;
+          }
+      if (l == 0)
+        continue;  /* reset since it was entered */
+
+      if (k < n)
+        {
+          if (name != NULL)
+            name[k] = s->name;
+          if (loops != NULL)
+            loops[k] = l;
+          if (iterations != NULL)
+            iterations[k] = it;
+        }
+      k++;
+    }
+  return k;
+}
+
+void
+mpfr_ziv_stats_reset (void)
+{
+  struct __mpfr_ziv_stat_s *s;
+
+  for (s = ziv_stats; s != NULL; s = s->next)
+    s->loops = s->iterations = 0;
+}
@@ -24,9 +24,9 @@ If not, see <https://www.gnu.org/licenses/>. */
 #define TEST_FUNCTION mpfr_ai
 #define TEST_RANDOM_EMIN (-5)
 #define TEST_RANDOM_EMAX 5
-#define REDUCE_EMAX 7 /* this is to avoid that test_generic() calls mpfr_ai
-                         with too large inputs. FIXME: remove this once
-                         mpfr_ai can handle large inputs */
+#define REDUCE_EMAX 20 /* this is to avoid that test_generic() calls mpfr_ai
+                          with huge negative inputs, for which the working
+                          precision is about 3/2*EXP(x) */
 #include "tgeneric.c"
 
 static void
@@ -45,7 +45,6 @@ check_large (void)
       printf ("Error in mpfr_ai for x=-2^8\n");
       exit (1);
     }
-#if 0 /* disabled since mpfr_ai does not currently handle large arguments */
   mpfr_set_str_binary (x, "-1E26");
   mpfr_ai (y, x, MPFR_RNDN);
   mpfr_set_str_binary (z, "-110001111100000011001010010101001101001011001011101011001010100100001110001101101101000010000011001000001011E-118");
@@ -54,6 +53,22 @@ check_large (void)
       printf ("Error in mpfr_ai for x=-2^26\n");
       exit (1);
     }
+  /* the following value was computed with the series */
+  mpfr_set_str_binary (x, "1E10");
+  mpfr_ai (y, x, MPFR_RNDN);
+  mpfr_set_str_binary (z, "0.10110111100100011011101111100011011110111001111110000100101010100010011111011001110000100000000010101100101010E-31520");
+  if (mpfr_equal_p (y, z) == 0)
+    {
+      printf ("Error in mpfr_ai for x=2^10\n");
+      exit (1);
+    }
+  /* Ai(x) underflows even in the extended exponent range */
+  mpfr_set_str_binary (x, "0.11111111111111111111111111111111111111E1073741823");
+  mpfr_clear_flags ();
+  MPFR_ASSERTN (mpfr_ai (y, x, MPFR_RNDN) < 0);
+  MPFR_ASSERTN (MPFR_IS_ZERO (y) && MPFR_IS_POS (y));
+  MPFR_ASSERTN (__gmpfr_flags == (MPFR_FLAGS_UNDERFLOW | MPFR_FLAGS_INEXACT));
+#if 0 /* disabled since the working precision would be about 2^31 bits */
   mpfr_set_str_binary (x, "-0.11111111111111111111111111111111111111E1073741823");
   mpfr_ai (y, x, MPFR_RNDN);
   /* FIXME: compute the correctly rounded value we should get for Ai(x),
@@ -130,6 +130,24 @@ check_sharedcache_p (void)
 #endif
 }
 
+static void
+check_philox_p (void)
+{
+#if defined(MPFR_HAVE_GMP_RANDFNPTR)
+  if (!mpfr_buildopt_philox_p ())
+    {
+      printf ("Error: mpfr_buildopt_philox_p should return true\n");
+      exit (1);
+    }
+#else
+  if (mpfr_buildopt_philox_p ())
+    {
+      printf ("Error: mpfr_buildopt_philox_p should return false\n");
+      exit (1);
+    }
+#endif
+}
+
 int
 main (void)
 {
@@ -141,6 +159,7 @@ main (void)
   check_float128_p();
   check_gmpinternals_p();
   check_sharedcache_p ();
+  check_philox_p ();
   {
     const char *s = mpfr_buildopt_tune_case ();
     (void) strlen (s);
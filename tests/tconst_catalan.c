@@ -48,6 +48,41 @@ exercise_Ziv (void)
   mpfr_clear (y);
 }
 
+/* Check that the results are the same when the internal sum is extended
+   (the precision increases without freeing the cache) and when it is
+   computed from scratch. */
+static void
+check_extend (void)
+{
+  mpfr_prec_t p[] = { 17, 100, 150, 1000, 1001, 3000 };
+  mpfr_t x[numberof (p)], y;
+  int i;
+
+  mpfr_free_cache ();
+  for (i = 0; i < numberof (p); i++)
+    {
+      mpfr_init2 (x[i], p[i]);
+      mpfr_const_catalan (x[i], MPFR_RNDU);
+    }
+  for (i = 0; i < numberof (p); i++)
+    {
+      mpfr_free_cache ();
+      mpfr_init2 (y, p[i]);
+      mpfr_const_catalan (y, MPFR_RNDU);
+      if (! mpfr_equal_p (x[i], y))
+        {
+          printf ("Error in check_extend for prec=%ld\n", (long) p[i]);
+          printf ("expected ");
+          mpfr_dump (y);
+          printf ("got      ");
+          mpfr_dump (x[i]);
+          exit (1);
+        }
+      mpfr_clear (y);
+      mpfr_clear (x[i]);
+    }
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -56,6 +91,7 @@ main (int argc, char *argv[])
   tests_start_mpfr ();
 
   exercise_Ziv ();
+  check_extend ();
   mpfr_init2 (x, 32);
   (mpfr_const_catalan) (x, MPFR_RNDN);
   mpfr_mul_2ui (x, x, 32, MPFR_RNDN);
@@ -138,6 +138,41 @@ check_cache (void)
   mpfr_clear (x);
 }
 
+/* Check that the results are the same when the internal sum is extended
+   (the precision increases without freeing the cache) and when it is
+   computed from scratch. */
+static void
+check_extend (void)
+{
+  mpfr_prec_t p[] = { 17, 100, 150, 1000, 1001, 5000 };
+  mpfr_t x[numberof (p)], y;
+  int inex[numberof (p)], i, j;
+
+  mpfr_free_cache ();
+  for (i = 0; i < numberof (p); i++)
+    {
+      mpfr_init2 (x[i], p[i]);
+      inex[i] = mpfr_const_log2 (x[i], MPFR_RNDZ);
+    }
+  for (i = 0; i < numberof (p); i++)
+    {
+      mpfr_free_cache ();
+      mpfr_init2 (y, p[i]);
+      j = mpfr_const_log2 (y, MPFR_RNDZ);
+      if (! mpfr_equal_p (x[i], y) || ! SAME_SIGN (inex[i], j))
+        {
+          printf ("Error in check_extend for prec=%ld\n", (long) p[i]);
+          printf ("expected inex=%d ", j);
+          mpfr_dump (y);
+          printf ("got      inex=%d ", inex[i]);
+          mpfr_dump (x[i]);
+          exit (1);
+        }
+      mpfr_clear (y);
+      mpfr_clear (x[i]);
+    }
+}
+
 /* Wrapper for tgeneric */
 static int
 my_const_log2 (mpfr_ptr x, mpfr_srcptr y, mpfr_rnd_t r)
@@ -225,6 +260,7 @@ main (int argc, char *argv[])
 
   check_large ();
   check_cache ();
+  check_extend ();
 
   test_generic (MPFR_PREC_MIN, 200, 1);
 
@@ -1892,6 +1892,135 @@ check_divhigh_basecase (mpfr_prec_t N, int K)
     }
 }
 
+/* check the special code for 2*GMP_NUMB_BITS < p <= 3*GMP_NUMB_BITS
+   against the generic code (used when the precisions differ), also near
+   the underflow and overflow thresholds */
+static void
+check_div_3 (void)
+{
+  mpfr_t q1, q2, u, u2, v;
+  mpfr_exp_t emin, emax, e = 0;
+  mpfr_flags_t f1, f2;
+  mpfr_prec_t p;
+  int i, j, k, r, inex1, inex2;
+
+  emin = mpfr_get_emin ();
+  emax = mpfr_get_emax ();
+  for (p = 2 * GMP_NUMB_BITS + 1; p <= 3 * GMP_NUMB_BITS; p++)
+    {
+      mpfr_inits2 (p, q1, q2, u, v, (mpfr_ptr) 0);
+      mpfr_init2 (u2, p + 1);
+      for (i = 0; i < 20; i++)
+        {
+          mpfr_set_ui (u, 1, MPFR_RNDN);
+          mpfr_set_ui (v, 1, MPFR_RNDN);
+          /* limbs either random, or 0, or 111...111 */
+          for (j = 0; j < 3; j++)
+            {
+              MPFR_MANT(u)[j] = RAND_BOOL () ? randlimb () :
+                RAND_BOOL () ? MPFR_LIMB_ZERO : MPFR_LIMB_MAX;
+              MPFR_MANT(v)[j] = RAND_BOOL () ? randlimb () :
+                RAND_BOOL () ? MPFR_LIMB_ZERO : MPFR_LIMB_MAX;
+            }
+          MPFR_MANT(u)[2] |= MPFR_LIMB_HIGHBIT;
+          MPFR_MANT(v)[2] |= MPFR_LIMB_HIGHBIT;
+          MPFR_MANT(u)[0] &= ~MPFR_LIMB_MASK (3 * GMP_NUMB_BITS - p);
+          MPFR_MANT(v)[0] &= ~MPFR_LIMB_MASK (3 * GMP_NUMB_BITS - p);
+          if (i % 4 == 0)
+            {
+              mpfr_set (u, v, MPFR_RNDN);
+              if (i % 8 == 0)
+                mpfr_nextabove (u);
+            }
+          mpfr_set_exp (u, (mpfr_exp_t) (randlimb () % 16) - 8);
+          if (RAND_BOOL ())
+            mpfr_neg (u, u, MPFR_RNDN);
+          if (RAND_BOOL ())
+            mpfr_neg (v, v, MPFR_RNDN);
+          mpfr_set (u2, u, MPFR_RNDN);
+          RND_LOOP_NO_RNDF (r)
+            for (k = 0; k < 5; k++)
+              {
+                if (k == 1 || k == 2)
+                  set_emin (e + k - 1);
+                else if (k == 3 || k == 4)
+                  set_emax (e + 3 - k);
+                mpfr_clear_flags ();
+                inex1 = mpfr_div (q1, u, v, (mpfr_rnd_t) r);
+                f1 = __gmpfr_flags;
+                mpfr_clear_flags ();
+                inex2 = mpfr_div (q2, u2, v, (mpfr_rnd_t) r);
+                f2 = __gmpfr_flags;
+                set_emin (emin);
+                set_emax (emax);
+                if (k == 0)
+                  e = mpfr_get_exp (q1);
+                if (! mpfr_equal_p (q1, q2) ||
+                    mpfr_signbit (q1) != mpfr_signbit (q2) ||
+                    ! SAME_SIGN (inex1, inex2) || f1 != f2)
+                  {
+                    printf ("Error in check_div_3 for p=%ld, %s, k=%d\n",
+                            (long) p, mpfr_print_rnd_mode ((mpfr_rnd_t) r),
+                            k);
+                    printf ("u = ");
+                    mpfr_dump (u);
+                    printf ("v = ");
+                    mpfr_dump (v);
+                    printf ("got      ");
+                    mpfr_dump (q1);
+                    printf ("expected ");
+                    mpfr_dump (q2);
+                    printf ("inex = %d and %d, flags = %u and %u\n",
+                            inex1, inex2, (unsigned int) f1,
+                            (unsigned int) f2);
+                    exit (1);
+                  }
+              }
+        }
+      mpfr_clears (q1, q2, u, u2, v, (mpfr_ptr) 0);
+    }
+}
+
+/* check mpfr_div above MPFR_DIV_Q_THRESHOLD, where mpfr_divhigh_n
+   uses mpn_div_q */
+static void
+check_div_q (void)
+{
+  mpfr_prec_t p;
+  mpfr_t q, u, v, t, w;
+  int inex, inex2, r;
+
+  p = MPFR_DIV_Q_THRESHOLD * GMP_NUMB_BITS + 17;
+  mpfr_inits2 (p, q, u, v, (mpfr_ptr) 0);
+  mpfr_inits2 (2 * p, t, w, (mpfr_ptr) 0);
+  RND_LOOP_NO_RNDF (r)
+    {
+      do mpfr_urandomb (u, RANDS); while (mpfr_zero_p (u));
+      do mpfr_urandomb (v, RANDS); while (mpfr_zero_p (v));
+      if (RAND_BOOL ())
+        mpfr_neg (u, u, MPFR_RNDN);
+      if (RAND_BOOL ())
+        mpfr_neg (v, v, MPFR_RNDN);
+      inex = mpfr_div (q, u, v, (mpfr_rnd_t) r);
+      /* t = q*v - u, which has the sign of inex times the sign of v */
+      inex2 = mpfr_mul (t, q, v, MPFR_RNDN);
+      MPFR_ASSERTN (inex2 == 0);
+      inex2 = mpfr_sub (t, t, u, MPFR_RNDN);
+      MPFR_ASSERTN (inex2 == 0);
+      MPFR_ASSERTN (SAME_SIGN (inex, mpfr_sgn (t) * mpfr_sgn (v)));
+      /* |t| < ulp(q)*|v|, and |t| <= 1/2 ulp(q)*|v| for MPFR_RNDN */
+      mpfr_mul_2si (w, v, mpfr_get_exp (q) - p - (r == MPFR_RNDN),
+                    MPFR_RNDN);
+      MPFR_ASSERTN (mpfr_cmpabs (t, w) < (r == MPFR_RNDN));
+      if (r == MPFR_RNDU || (r == MPFR_RNDA && MPFR_IS_POS (q)) ||
+          (r == MPFR_RNDZ && MPFR_IS_NEG (q)))
+        MPFR_ASSERTN (inex >= 0);
+      else if (r != MPFR_RNDN)
+        MPFR_ASSERTN (inex <= 0);
+    }
+  mpfr_clears (q, u, v, t, w, (mpfr_ptr) 0);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -1903,6 +2032,8 @@ main (int argc, char *argv[])
   check_divhigh_basecase (100, 1000);
   coverage (1024);
   coverage2 ();
+  check_div_q ();
+  check_div_3 ();
   bug20180126 ();
   bug20171218 ();
   testall_rndf (9);
@@ -0,0 +1,249 @@
+/* Test file for the fixed-point code of mpfr_exp, mpfr_log, mpfr_sin and
+   mpfr_cos in small precision (elem_fixed.c).
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-test.h"
+
+typedef int (*func_t) (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+
+static const func_t funcs[] = { mpfr_exp, mpfr_log, mpfr_sin, mpfr_cos };
+static const char *const names[] = { "mpfr_exp", "mpfr_log", "mpfr_sin",
+                                     "mpfr_cos" };
+
+/* the precision of the reference values, for which the generic code
+   is used */
+#define PREF (4 * GMP_NUMB_BITS + 17)
+
+/* Set x to a random number for the function of index j: random
+   precision, exponent from -30 to 33 (the fixed-point code works up to 32),
+   and some inputs close to 1 for the logarithm. */
+static void
+random_input (mpfr_ptr x, int j)
+{
+  mpfr_t t;
+  long d;
+
+  mpfr_set_prec (x, 2 + randlimb () % (3 * GMP_NUMB_BITS));
+  mpfr_urandomb (x, RANDS);
+  if (mpfr_zero_p (x))
+    mpfr_set_ui (x, 1, MPFR_RNDN);
+  mpfr_set_exp (x, (mpfr_exp_t) (randlimb () % 64) - 30);
+  if (j == 1 && RAND_BOOL ())
+    {
+      /* x = 1 + t or 1 - t with t small */
+      mpfr_init2 (t, MPFR_PREC (x));
+      mpfr_set (t, x, MPFR_RNDN);
+      d = randlimb () % (2 * GMP_NUMB_BITS);
+      mpfr_set_prec (x, MPFR_PREC (t) + d + 2);
+      mpfr_mul_2si (t, t, - (long) mpfr_get_exp (t) - d, MPFR_RNDN);
+      mpfr_ui_sub (x, 1, t, MPFR_RNDN);
+      if (RAND_BOOL ())
+        mpfr_ui_sub (x, 2, x, MPFR_RNDN);
+      mpfr_clear (t);
+    }
+  else if (j != 1 && RAND_BOOL ())
+    mpfr_neg (x, x, MPFR_RNDN);
+}
+
+/* Check the function of index j at x in precision p, against a value
+   computed in a larger precision and rounded, also near the underflow and
+   overflow thresholds. */
+static void
+check_value (int j, mpfr_srcptr x, mpfr_prec_t p)
+{
+  mpfr_t x2, y, z, t, t2;
+  mpfr_exp_t emin, emax, e;
+  mpfr_flags_t f1, f2;
+  int r, k, inex, inex1, inex2;
+
+  emin = mpfr_get_emin ();
+  emax = mpfr_get_emax ();
+  mpfr_inits2 (p, y, t, t2, (mpfr_ptr) 0);
+  mpfr_init2 (z, PREF);
+  funcs[j] (z, x, MPFR_RNDN);
+  RND_LOOP_NO_RNDF (r)
+    {
+      /* skip the cases of overflow and underflow in the whole exponent
+         range (exp of a large number) and the hard-to-round cases */
+      if (! mpfr_regular_p (z) ||
+          ! mpfr_can_round (z, PREF - 2, MPFR_RNDN, MPFR_RNDZ,
+                            p + (r == MPFR_RNDN)))
+        continue;
+      inex = mpfr_set (t, z, (mpfr_rnd_t) r);
+      MPFR_ASSERTN (inex != 0);
+      e = mpfr_get_exp (t);
+      for (k = 0; k < 5; k++)
+        {
+          /* x must be in the reduced exponent range */
+          if ((k == 1 || k == 2) ? mpfr_get_exp (x) < e + k - 1 :
+              (k == 3 || k == 4) ? mpfr_get_exp (x) > e + 3 - k : 0)
+            continue;
+          mpfr_set (t2, t, MPFR_RNDN);
+          if (k == 1 || k == 2)
+            set_emin (e + k - 1);
+          else if (k == 3 || k == 4)
+            set_emax (e + 3 - k);
+          mpfr_clear_flags ();
+          inex1 = funcs[j] (y, x, (mpfr_rnd_t) r);
+          f1 = __gmpfr_flags;
+          mpfr_clear_flags ();
+          inex2 = mpfr_check_range (t2, inex, (mpfr_rnd_t) r);
+          f2 = __gmpfr_flags;
+          set_emin (emin);
+          set_emax (emax);
+          if (! mpfr_equal_p (y, t2) || ! SAME_SIGN (inex1, inex2) ||
+              f1 != f2)
+            {
+              printf ("Error in %s for p=%ld, %s, k=%d\n", names[j],
+                      (long) p, mpfr_print_rnd_mode ((mpfr_rnd_t) r), k);
+              printf ("x = ");
+              mpfr_dump (x);
+              printf ("got      ");
+              mpfr_dump (y);
+              printf ("expected ");
+              mpfr_dump (t2);
+              printf ("inex = %d and %d, flags = %u and %u\n",
+                      inex1, inex2, (unsigned int) f1, (unsigned int) f2);
+              exit (1);
+            }
+        }
+    }
+
+  /* faithful rounding, with the input as the output (a failure of the
+     fixed-point code must not modify the output) */
+  if (mpfr_regular_p (z) &&
+      mpfr_can_round (z, PREF - 2, MPFR_RNDN, MPFR_RNDZ, p))
+    {
+      mpfr_init2 (x2, p);
+      mpfr_set (x2, x, MPFR_RNDN);
+      if (mpfr_equal_p (x2, x))
+        {
+          funcs[j] (x2, x2, MPFR_RNDF);
+          mpfr_set (t, z, MPFR_RNDD);
+          mpfr_set (t2, z, MPFR_RNDU);
+          if (! mpfr_equal_p (x2, t) && ! mpfr_equal_p (x2, t2))
+            {
+              printf ("Error in %s for p=%ld, MPFR_RNDF\n", names[j],
+                      (long) p);
+              printf ("x = ");
+              mpfr_dump (x);
+              printf ("got ");
+              mpfr_dump (x2);
+              exit (1);
+            }
+        }
+      mpfr_clear (x2);
+    }
+  mpfr_clears (y, z, t, t2, (mpfr_ptr) 0);
+}
+
+static void
+check_random (void)
+{
+  mpfr_t x;
+  mpfr_prec_t p;
+  int i, j;
+
+  mpfr_init2 (x, MPFR_PREC_MIN);
+  for (j = 0; j < 4; j++)
+    for (p = MPFR_PREC_MIN; p <= 2 * GMP_NUMB_BITS + 1; p++)
+      for (i = 0; i < 20; i++)
+        {
+          do
+            random_input (x, j);
+          while (j == 1 && mpfr_cmp_ui (x, 1) == 0);
+          check_value (j, x, p);
+        }
+  mpfr_clear (x);
+}
+
+/* Inputs at the limit of the domain of the fixed-point code, or close
+   to the points where the argument reduction changes. */
+static void
+check_special (void)
+{
+  mpfr_t x;
+  mpfr_prec_t p;
+  int i, j;
+
+  mpfr_init2 (x, 3 * GMP_NUMB_BITS);
+  for (i = 0; i < 9; i++)
+    {
+      switch (i)
+        {
+        case 0: /* close to 1, so that log(x) is small */
+          mpfr_set_ui (x, 1, MPFR_RNDN);
+          mpfr_nextabove (x);
+          break;
+        case 1:
+          mpfr_set_ui (x, 1, MPFR_RNDN);
+          mpfr_nextbelow (x);
+          break;
+        case 2: /* largest exponent handled by the fixed-point code */
+          mpfr_set_ui_2exp (x, 1, 32, MPFR_RNDN);
+          mpfr_nextbelow (x);
+          break;
+        case 3:
+          mpfr_set_ui_2exp (x, 1, 32, MPFR_RNDN);
+          break;
+        case 4: /* close to pi/4, pi/2 and pi */
+          mpfr_const_pi (x, MPFR_RNDN);
+          mpfr_div_2ui (x, x, 2, MPFR_RNDN);
+          break;
+        case 5:
+          mpfr_const_pi (x, MPFR_RNDN);
+          mpfr_div_2ui (x, x, 1, MPFR_RNDN);
+          break;
+        case 6:
+          mpfr_const_pi (x, MPFR_RNDN);
+          break;
+        case 7: /* close to log(2) and 2 */
+          mpfr_const_log2 (x, MPFR_RNDN);
+          break;
+        default:
+          mpfr_set_ui (x, 2, MPFR_RNDN);
+          mpfr_nextbelow (x);
+          break;
+        }
+      for (p = MPFR_PREC_MIN; p <= 2 * GMP_NUMB_BITS + 1; p++)
+        for (j = 0; j < 4; j++)
+          {
+            check_value (j, x, p);
+            mpfr_neg (x, x, MPFR_RNDN);
+            if (j != 1)
+              check_value (j, x, p);
+            mpfr_neg (x, x, MPFR_RNDN);
+          }
+    }
+  mpfr_clear (x);
+}
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+  check_special ();
+  check_random ();
+
+  tests_end_mpfr ();
+  return 0;
+}
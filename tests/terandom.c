@@ -99,6 +99,51 @@ test_erandom (long nbtests, mpfr_prec_t prec, mpfr_rnd_t rnd,
 }
 
 
+#ifndef MPFR_USE_MINI_GMP
+/* Check that mpfr_erandom_vec gives the same results as successive calls
+   to mpfr_erandom. */
+static void
+test_erandom_vec (mpfr_prec_t p)
+{
+  gmp_randstate_t s1, s2;
+  mpfr_t x[10], y;
+  mpfr_ptr px[10];
+  int inex[10], inexy;
+  unsigned long i, n = numberof (x);
+
+  gmp_randinit_default (s1);
+  gmp_randinit_default (s2);
+  gmp_randseed_ui (s1, 42);
+  gmp_randseed_ui (s2, 42);
+  for (i = 0; i < n; i++)
+    {
+      mpfr_init2 (x[i], p);
+      px[i] = x[i];
+    }
+  mpfr_init2 (y, p);
+  MPFR_ASSERTN (mpfr_erandom_vec (px, inex, n, s1, MPFR_RNDN) != 0);
+  for (i = 0; i < n; i++)
+    {
+      inexy = mpfr_erandom (y, s2, MPFR_RNDN);
+      if (! mpfr_equal_p (x[i], y) || inex[i] != inexy)
+        {
+          printf ("Error in mpfr_erandom_vec for p=%ld, i=%lu\n", (long) p, i);
+          printf ("Expected ");
+          mpfr_dump (y);
+          printf ("Got      ");
+          mpfr_dump (x[i]);
+          printf ("with inex=%d instead of %d\n", inex[i], inexy);
+          exit (1);
+        }
+    }
+  for (i = 0; i < n; i++)
+    mpfr_clear (x[i]);
+  mpfr_clear (y);
+  gmp_randclear (s1);
+  gmp_randclear (s2);
+}
+#endif
+
 int
 main (int argc, char *argv[])
 {
@@ -121,6 +166,11 @@ main (int argc, char *argv[])
   test_special (2);
   test_special (42000);
 
+#ifndef MPFR_USE_MINI_GMP
+  test_erandom_vec (2);
+  test_erandom_vec (420);
+#endif
+
   tests_end_mpfr ();
   return 0;
 }
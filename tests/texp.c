@@ -205,6 +205,51 @@ compare_exp2_exp3 (mpfr_prec_t p0, mpfr_prec_t p1)
   mpfr_clear (z);
 }
 
+/* Check mpfr_exp against mpfr_exp_2 on inputs with few significant bits,
+   which mpfr_exp sends to mpfr_exp_3 from MPFR_EXP_SPARSE_THRESHOLD. */
+static void
+check_sparse (void)
+{
+  mpfr_t x, y, z;
+  mpfr_prec_t prec;
+  mpfr_rnd_t rnd;
+  int i, inex2, inex;
+
+  mpfr_init2 (x, 64);
+  mpfr_init (y);
+  mpfr_init (z);
+  for (i = 0; i < 10; i++)
+    {
+      prec = 2500 + (randlimb () % 1000);
+      mpfr_set_prec (y, prec);
+      mpfr_set_prec (z, prec);
+      mpfr_set_prec (x, 1 + (randlimb () % 64));
+      do
+        mpfr_urandomb (x, RANDS);
+      while (MPFR_IS_ZERO (x));
+      mpfr_mul_2si (x, x, (long) (randlimb () % 16) - 8, MPFR_RNDN);
+      if (randlimb () & 1)
+        mpfr_neg (x, x, MPFR_RNDN);
+      rnd = RND_RAND_NO_RNDF ();
+      inex2 = mpfr_exp_2 (y, x, rnd);
+      inex = mpfr_exp (z, x, rnd);
+      if (mpfr_cmp (y, z) || ! SAME_SIGN (inex2, inex))
+        {
+          printf ("mpfr_exp_2 and mpfr_exp disagree for rnd=%s, prec=%ld "
+                  "and\nx=", mpfr_print_rnd_mode (rnd), (long) prec);
+          mpfr_dump (x);
+          printf ("mpfr_exp_2 gives (inex=%d) ", inex2);
+          mpfr_dump (y);
+          printf ("mpfr_exp gives (inex=%d) ", inex);
+          mpfr_dump (z);
+          exit (1);
+        }
+    }
+  mpfr_clear (x);
+  mpfr_clear (y);
+  mpfr_clear (z);
+}
+
 static void
 check_large (void)
 {
@@ -1007,6 +1052,7 @@ main (int argc, char *argv[])
   test_generic (MPFR_PREC_MIN, 100, 100);
 
   compare_exp2_exp3 (20, 1000);
+  check_sparse ();
   check_worst_cases();
   check3("0.0", MPFR_RNDU, "1.0");
   check3("-1e-170", MPFR_RNDU, "1.0");
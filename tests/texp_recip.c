@@ -0,0 +1,162 @@
+/* Test file for mpfr_exp_recip.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+
+#include "mpfr-test.h"
+
+/* encoding of a ternary value in the return value of mpfr_exp_recip */
+#define CODE(i) ((i) == 0 ? 0 : (i) > 0 ? 1 : 2)
+
+/* check mpfr_exp_recip (ep, em, x) against mpfr_exp, with the outputs
+   of precision pp and pm, and also when ep or em is x */
+static void
+check (mpfr_srcptr x, mpfr_prec_t pp, mpfr_prec_t pm, mpfr_rnd_t rnd)
+{
+  mpfr_t ep, em, e1, e2, nx;
+  int ret, i1, i2, k;
+  mpfr_flags_t flags, ex_flags;
+
+  mpfr_init2 (ep, pp);
+  mpfr_init2 (em, pm);
+  mpfr_init2 (e1, pp);
+  mpfr_init2 (e2, pm);
+  mpfr_init2 (nx, MPFR_PREC (x));
+  mpfr_neg (nx, x, MPFR_RNDN);
+
+  mpfr_clear_flags ();
+  i1 = mpfr_exp (e1, x, rnd);
+  i2 = mpfr_exp (e2, nx, rnd);
+  ex_flags = __gmpfr_flags;
+
+  for (k = 0; k < 3; k++)
+    {
+      mpfr_ptr p = ep, m = em;
+
+      mpfr_set_prec (ep, pp);
+      mpfr_set_prec (em, pm);
+      /* k = 1: ep is x; k = 2: em is x */
+      if (k == 1)
+        {
+          if (pp != MPFR_PREC (x))
+            continue;
+          mpfr_set (ep, x, MPFR_RNDN);
+        }
+      if (k == 2)
+        {
+          if (pm != MPFR_PREC (x))
+            continue;
+          mpfr_set (em, x, MPFR_RNDN);
+        }
+      mpfr_clear_flags ();
+      ret = mpfr_exp_recip (p, m, k == 1 ? p : k == 2 ? m : x, rnd);
+      flags = __gmpfr_flags;
+      if (! SAME_VAL (ep, e1) || ! SAME_VAL (em, e2) ||
+          ret != (CODE (i1) | (CODE (i2) << 2)) || flags != ex_flags)
+        {
+          printf ("Error in mpfr_exp_recip for %s, k = %d, x = ",
+                  mpfr_print_rnd_mode (rnd), k);
+          mpfr_dump (x);
+          printf ("expected ");
+          mpfr_dump (e1);
+          printf ("         ");
+          mpfr_dump (e2);
+          printf ("with ret = %d, flags =", CODE (i1) | (CODE (i2) << 2));
+          flags_out (ex_flags);
+          printf ("got      ");
+          mpfr_dump (ep);
+          printf ("         ");
+          mpfr_dump (em);
+          printf ("with ret = %d, flags =", ret);
+          flags_out (flags);
+          exit (1);
+        }
+    }
+
+  mpfr_clears (ep, em, e1, e2, nx, (mpfr_ptr) 0);
+}
+
+static void
+check_special (void)
+{
+  mpfr_t x;
+  int r;
+
+  mpfr_init2 (x, 17);
+  RND_LOOP_NO_RNDF (r)
+    {
+      mpfr_set_nan (x);
+      check (x, 17, 23, (mpfr_rnd_t) r);
+      mpfr_set_inf (x, 1);
+      check (x, 17, 23, (mpfr_rnd_t) r);
+      mpfr_set_inf (x, -1);
+      check (x, 17, 23, (mpfr_rnd_t) r);
+      mpfr_set_zero (x, 1);
+      check (x, 17, 23, (mpfr_rnd_t) r);
+      mpfr_set_zero (x, -1);
+      check (x, 17, 23, (mpfr_rnd_t) r);
+      /* overflow of exp(x), underflow of exp(-x) */
+      mpfr_set_ui_2exp (x, 1, 40, MPFR_RNDN);
+      check (x, 17, 23, (mpfr_rnd_t) r);
+      mpfr_neg (x, x, MPFR_RNDN);
+      check (x, 17, 23, (mpfr_rnd_t) r);
+      /* tiny input */
+      mpfr_set_si_2exp (x, -3, -100, MPFR_RNDN);
+      check (x, 17, 23, (mpfr_rnd_t) r);
+    }
+  mpfr_clear (x);
+}
+
+static void
+check_random (void)
+{
+  mpfr_t x;
+  mpfr_prec_t p;
+  int i, r;
+
+  for (p = MPFR_PREC_MIN; p <= 300; p += 13)
+    {
+      mpfr_init2 (x, p);
+      for (i = 0; i < 10; i++)
+        {
+          mpfr_urandomb (x, RANDS);
+          if (mpfr_zero_p (x))
+            continue;
+          mpfr_mul_2si (x, x, (int) (randlimb () % 36) - 25, MPFR_RNDN);
+          if (randlimb () & 1)
+            mpfr_neg (x, x, MPFR_RNDN);
+          RND_LOOP_NO_RNDF (r)
+            check (x, p + (randlimb () % 16), p, (mpfr_rnd_t) r);
+        }
+      mpfr_clear (x);
+    }
+}
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+  check_special ();
+  check_random ();
+
+  tests_end_mpfr ();
+  return 0;
+}
@@ -1007,6 +1007,117 @@ bug20171219 (void)
   mpfr_clear (u);
 }
 
+/* Check the special code for PREC(s) = PREC(x) = PREC(y) = PREC(z) <= 3
+   limbs, with various exponent differences and cancellations, also in a
+   reduced exponent range (for the overflow and underflow cases), and
+   with s = z for mpfr_fms. The result is compared with the exact product
+   followed by mpfr_add. */
+static void
+check_small (void)
+{
+  mpfr_t x, y, z, s, t, u;
+  mpfr_prec_t p;
+  mpfr_exp_t emin, emax, ez;
+  mpfr_rnd_t rnd;
+  mpfr_flags_t flags1, flags2;
+  int i, inex1, inex2, red;
+
+  emin = mpfr_get_emin ();
+  emax = mpfr_get_emax ();
+  for (p = MPFR_PREC_MIN; p <= 3 * GMP_NUMB_BITS; p++)
+    {
+      mpfr_inits2 (p, x, y, z, s, t, (mpfr_ptr) 0);
+      mpfr_init2 (u, 2 * p);
+      for (i = 0; i < 200; i++)
+        {
+          do mpfr_urandomb (x, RANDS); while (mpfr_zero_p (x));
+          do mpfr_urandomb (y, RANDS); while (mpfr_zero_p (y));
+          do mpfr_urandomb (z, RANDS); while (mpfr_zero_p (z));
+          mpfr_set_exp (x, (mpfr_exp_t) (randlimb () % 41) - 20);
+          mpfr_set_exp (y, (mpfr_exp_t) (randlimb () % 41) - 20);
+          if (RAND_BOOL ())
+            mpfr_neg (x, x, MPFR_RNDN);
+          if (RAND_BOOL ())
+            mpfr_neg (y, y, MPFR_RNDN);
+          if (RAND_BOOL ())
+            mpfr_neg (z, z, MPFR_RNDN);
+          ez = mpfr_get_exp (x) + mpfr_get_exp (y);
+          switch (i % 4)
+            {
+            case 0:
+              mpfr_set_exp (z, ez + (mpfr_exp_t) (randlimb () % 9) - 4);
+              break;
+            case 1:
+              mpfr_set_exp (z, ez + (mpfr_exp_t) (randlimb () % (8 * p + 1))
+                            - 4 * p);
+              break;
+            case 2:
+              /* cancellation */
+              mpfr_mul (z, x, y, RND_RAND_NO_RNDF ());
+              mpfr_neg (z, z, MPFR_RNDN);
+              if (RAND_BOOL ())
+                mpfr_nextabove (z);
+              break;
+            default:
+              mpfr_set_exp (z, ez + (RAND_BOOL () ? 500 : -500));
+            }
+          rnd = RND_RAND_NO_RNDF ();
+          red = RAND_BOOL () && mpfr_get_exp (z) >= -30 &&
+            mpfr_get_exp (z) <= 30;
+
+          inex1 = mpfr_mul (u, x, y, MPFR_RNDN);
+          MPFR_ASSERTN (inex1 == 0);
+          mpfr_clear_flags ();
+          inex1 = mpfr_add (t, u, z, rnd);
+          if (red)
+            {
+              set_emin (-30);
+              set_emax (30);
+              inex1 = mpfr_check_range (t, inex1, rnd);
+            }
+          flags1 = __gmpfr_flags;
+          mpfr_clear_flags ();
+          inex2 = mpfr_fma (s, x, y, z, rnd);
+          flags2 = __gmpfr_flags;
+          set_emin (emin);
+          set_emax (emax);
+          if (! mpfr_equal_p (s, t) || MPFR_SIGN (s) != MPFR_SIGN (t) ||
+              ! SAME_SIGN (inex1, inex2) || flags1 != flags2)
+            {
+              printf ("Error in check_small for prec=%u rnd=%s%s\n",
+                      (unsigned int) p, mpfr_print_rnd_mode (rnd),
+                      red ? " (reduced exponent range)" : "");
+              printf ("x="); mpfr_dump (x);
+              printf ("y="); mpfr_dump (y);
+              printf ("z="); mpfr_dump (z);
+              printf ("expected "); mpfr_dump (t);
+              printf ("got      "); mpfr_dump (s);
+              printf ("expected inex=%d flags=%u, got inex=%d flags=%u\n",
+                      inex1, (unsigned int) flags1,
+                      inex2, (unsigned int) flags2);
+              exit (1);
+            }
+
+          /* s = z for mpfr_fms */
+          inex1 = mpfr_sub (t, u, z, rnd);
+          mpfr_set (s, z, MPFR_RNDN);
+          inex2 = mpfr_fms (s, x, y, s, rnd);
+          if (! mpfr_equal_p (s, t) || ! SAME_SIGN (inex1, inex2))
+            {
+              printf ("Error in check_small for mpfr_fms, prec=%u rnd=%s\n",
+                      (unsigned int) p, mpfr_print_rnd_mode (rnd));
+              printf ("x="); mpfr_dump (x);
+              printf ("y="); mpfr_dump (y);
+              printf ("z="); mpfr_dump (z);
+              printf ("expected "); mpfr_dump (t);
+              printf ("got      "); mpfr_dump (s);
+              exit (1);
+            }
+        }
+      mpfr_clears (x, y, z, s, t, u, (mpfr_ptr) 0);
+    }
+}
+
 /* coverage test for mpfr_set_1_2, case prec < GMP_NUMB_BITS,
    inex > 0, rb <> 0, sb = 0 */
 static void
@@ -1068,6 +1179,7 @@ main (int argc, char *argv[])
 
   bug20171219 ();
   bug20101018 ();
+  check_small ();
 
   mpfr_init (x);
   mpfr_init (s);
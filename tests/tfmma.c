@@ -661,6 +661,113 @@ double_rounding (void)
     }
 }
 
+/* Check the special code for 1 to 3 limbs, against the exact products
+   added with mpfr_add or mpfr_sub. */
+static void
+check_small (void)
+{
+  mpfr_t a, b, c, d, z, t, ab, cd;
+  mpfr_prec_t p;
+  mpfr_exp_t emin, emax, e;
+  mpfr_rnd_t rnd;
+  mpfr_flags_t flags1, flags2;
+  int i, neg, inex1, inex2, red;
+
+  emin = mpfr_get_emin ();
+  emax = mpfr_get_emax ();
+  for (p = MPFR_PREC_MIN; p <= 3 * GMP_NUMB_BITS; p++)
+    {
+      mpfr_inits2 (p, a, b, c, d, z, t, (mpfr_ptr) 0);
+      mpfr_inits2 (2 * p, ab, cd, (mpfr_ptr) 0);
+      for (i = 0; i < 200; i++)
+        {
+          do mpfr_urandomb (a, RANDS); while (mpfr_zero_p (a));
+          do mpfr_urandomb (b, RANDS); while (mpfr_zero_p (b));
+          do mpfr_urandomb (c, RANDS); while (mpfr_zero_p (c));
+          do mpfr_urandomb (d, RANDS); while (mpfr_zero_p (d));
+          mpfr_set_exp (a, (mpfr_exp_t) (randlimb () % 41) - 20);
+          mpfr_set_exp (b, (mpfr_exp_t) (randlimb () % 41) - 20);
+          mpfr_set_exp (c, (mpfr_exp_t) (randlimb () % 41) - 20);
+          if (RAND_BOOL ())
+            mpfr_neg (a, a, MPFR_RNDN);
+          if (RAND_BOOL ())
+            mpfr_neg (b, b, MPFR_RNDN);
+          if (RAND_BOOL ())
+            mpfr_neg (c, c, MPFR_RNDN);
+          if (RAND_BOOL ())
+            mpfr_neg (d, d, MPFR_RNDN);
+          e = mpfr_get_exp (a) + mpfr_get_exp (b) - mpfr_get_exp (c);
+          switch (i % 4)
+            {
+            case 0:
+              e += (mpfr_exp_t) (randlimb () % 9) - 4;
+              break;
+            case 1:
+              e += (mpfr_exp_t) (randlimb () % (8 * p + 1)) - 4 * p;
+              break;
+            case 2:
+              /* cancellation: c*d is close to -a*b or to a*b */
+              mpfr_set (c, a, MPFR_RNDN);
+              mpfr_set (d, b, MPFR_RNDN);
+              if (RAND_BOOL ())
+                mpfr_nextabove (d);
+              if (RAND_BOOL ())
+                mpfr_neg (d, d, MPFR_RNDN);
+              e = mpfr_get_exp (d);
+              break;
+            default:
+              e += RAND_BOOL () ? 200 : -200;
+            }
+          mpfr_set_exp (d, e);
+          rnd = RND_RAND_NO_RNDF ();
+          neg = RAND_BOOL ();
+
+          inex1 = mpfr_mul (ab, a, b, MPFR_RNDN);
+          MPFR_ASSERTN (inex1 == 0);
+          inex1 = mpfr_mul (cd, c, d, MPFR_RNDN);
+          MPFR_ASSERTN (inex1 == 0);
+          e = MAX (mpfr_get_exp (ab), mpfr_get_exp (cd));
+          red = RAND_BOOL () && e >= -30 && e <= 30;
+          mpfr_clear_flags ();
+          inex1 = neg ? mpfr_sub (t, ab, cd, rnd) : mpfr_add (t, ab, cd, rnd);
+          if (red)
+            {
+              set_emin (-30);
+              set_emax (30);
+              inex1 = mpfr_check_range (t, inex1, rnd);
+            }
+          flags1 = __gmpfr_flags;
+          mpfr_clear_flags ();
+          /* z = d */
+          mpfr_set (z, d, MPFR_RNDN);
+          inex2 = neg ? mpfr_fmms (z, a, b, c, z, rnd)
+            : mpfr_fmma (z, a, b, c, z, rnd);
+          flags2 = __gmpfr_flags;
+          set_emin (emin);
+          set_emax (emax);
+          if (! mpfr_equal_p (z, t) || MPFR_SIGN (z) != MPFR_SIGN (t) ||
+              ! SAME_SIGN (inex1, inex2) || flags1 != flags2)
+            {
+              printf ("Error in check_small for %s, prec=%u rnd=%s%s\n",
+                      neg ? "mpfr_fmms" : "mpfr_fmma",
+                      (unsigned int) p, mpfr_print_rnd_mode (rnd),
+                      red ? " (reduced exponent range)" : "");
+              printf ("a="); mpfr_dump (a);
+              printf ("b="); mpfr_dump (b);
+              printf ("c="); mpfr_dump (c);
+              printf ("d="); mpfr_dump (d);
+              printf ("expected "); mpfr_dump (t);
+              printf ("got      "); mpfr_dump (z);
+              printf ("expected inex=%d flags=%u, got inex=%d flags=%u\n",
+                      inex1, (unsigned int) flags1,
+                      inex2, (unsigned int) flags2);
+              exit (1);
+            }
+        }
+      mpfr_clears (a, b, c, d, z, t, ab, cd, (mpfr_ptr) 0);
+    }
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -677,6 +784,7 @@ main (int argc, char *argv[])
   bug20170405 ();
   double_rounding ();
   extreme_underflow ();
+  check_small ();
 
   tests_end_mpfr ();
   return 0;
@@ -78,6 +78,81 @@ bug20260429 (void)
   mpfr_clears (x, y, (mpfr_ptr) 0);
 }
 
+/* Check mpfr_jn_range against mpfr_jn. */
+static void
+test_range (void)
+{
+  mpfr_t y[24], x, z;
+  mpfr_ptr py[24];
+  int inex[24], inex2, j, r;
+  unsigned long i, m, n = numberof (y);
+  mpfr_prec_t prec;
+  static const char *xs[] = { "0.375", "5.5", "-7.25", "30.125", "100.5",
+                              "1e-5" };
+  static const unsigned long ms[] = { 0, 3, 50 };
+
+  mpfr_init2 (x, 64);
+  for (prec = MPFR_PREC_MIN; prec <= 200; prec += 37)
+    for (j = 0; j < numberof (xs); j++)
+      for (m = 0; m < numberof (ms); m++)
+        RND_LOOP_NO_RNDF (r)
+          {
+            mpfr_set_str (x, xs[j], 10, MPFR_RNDN);
+            mpfr_init2 (z, prec + 7);
+            for (i = 0; i < n; i++)
+              {
+                mpfr_init2 (y[i], prec + (i % 8));
+                py[i] = y[i];
+              }
+            mpfr_jn_range (py, inex, ms[m], n, x, (mpfr_rnd_t) r);
+            for (i = 0; i < n; i++)
+              {
+                mpfr_set_prec (z, mpfr_get_prec (y[i]));
+                inex2 = mpfr_jn (z, ms[m] + i, x, (mpfr_rnd_t) r);
+                if (! SAME_VAL (y[i], z) || ! SAME_SIGN (inex[i], inex2))
+                  {
+                    printf ("Error in mpfr_jn_range for n = %lu, "
+                            "prec = %lu, %s\nx = ", ms[m] + i,
+                            (unsigned long) mpfr_get_prec (z),
+                            mpfr_print_rnd_mode ((mpfr_rnd_t) r));
+                    mpfr_dump (x);
+                    printf ("expected ");
+                    mpfr_dump (z);
+                    printf ("  with inex = %d\n", inex2);
+                    printf ("got      ");
+                    mpfr_dump (y[i]);
+                    printf ("  with inex = %d\n", inex[i]);
+                    exit (1);
+                  }
+              }
+            for (i = 0; i < n; i++)
+              mpfr_clear (y[i]);
+            mpfr_clear (z);
+          }
+
+  /* the input may be one of the outputs */
+  mpfr_set_prec (x, 53);
+  mpfr_init2 (z, 53);
+  for (i = 0; i < 4; i++)
+    {
+      mpfr_init2 (y[i], 53);
+      py[i] = y[i];
+    }
+  mpfr_set_str (y[1], "2.75", 10, MPFR_RNDN);
+  mpfr_set (x, y[1], MPFR_RNDN);
+  mpfr_jn_range (py, NULL, 0, 4, y[1], MPFR_RNDN);
+  for (i = 0; i < 4; i++)
+    {
+      mpfr_jn (z, i, x, MPFR_RNDN);
+      MPFR_ASSERTN (mpfr_equal_p (y[i], z));
+      mpfr_clear (y[i]);
+    }
+  mpfr_clear (z);
+  mpfr_clear (x);
+
+  MPFR_ASSERTN (mpfr_jn_range (py, NULL, 0, 0, x, MPFR_RNDN) == 0);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -371,6 +446,7 @@ main (int argc, char *argv[])
   mpfr_clear (y);
 
   test_generic_si (MPFR_PREC_MIN, 100, 100);
+  test_range ();
 
   tests_end_mpfr ();
 
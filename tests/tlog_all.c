@@ -0,0 +1,163 @@
+/* Test file for mpfr_log_all.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+
+#include "mpfr-test.h"
+
+/* encoding of a ternary value in the return value of mpfr_log_all */
+#define CODE(i) ((i) == 0 ? 0 : (i) > 0 ? 1 : 2)
+
+static int (*const f[3]) (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t) =
+  { mpfr_log, mpfr_log2, mpfr_log10 };
+
+/* check mpfr_log_all on x against mpfr_log, mpfr_log2 and mpfr_log10, with the outputs of
+   precision p[i], computing only the outputs i such that bit i of mask
+   is set, and if 0 <= alias < 3, with output alias being x */
+static void
+check (mpfr_srcptr x, mpfr_prec_t p[3], int mask, int alias, mpfr_rnd_t rnd)
+{
+  mpfr_t y[3], e[3];
+  mpfr_ptr py[3];
+  int ret, exret, ex[3], i;
+  mpfr_flags_t flags, ex_flags;
+
+  if (alias >= 0 && alias < 3 && (! (mask & (1 << alias)) ||
+                                  p[alias] != MPFR_PREC (x)))
+    return;
+
+  mpfr_clear_flags ();
+  exret = 0;
+  for (i = 0; i < 3; i++)
+    {
+      mpfr_init2 (y[i], p[i]);
+      mpfr_init2 (e[i], p[i]);
+      py[i] = (mask & (1 << i)) ? y[i] : NULL;
+      ex[i] = (mask & (1 << i)) ? f[i] (e[i], x, rnd) : 0;
+      exret |= CODE (ex[i]) << (2 * i);
+    }
+  ex_flags = __gmpfr_flags;
+
+  if (alias >= 0 && alias < 3)
+    mpfr_set (y[alias], x, MPFR_RNDN);
+  mpfr_clear_flags ();
+  ret = mpfr_log_all (py[0], py[1], py[2], alias >= 0 && alias < 3 ? py[alias] : x,
+              rnd);
+  flags = __gmpfr_flags;
+
+  for (i = 0; i < 3; i++)
+    if ((mask & (1 << i)) && ! SAME_VAL (y[i], e[i]))
+      break;
+  if (i < 3 || ret != exret || flags != ex_flags)
+    {
+      printf ("Error in mpfr_log_all for %s, mask = %d, alias = %d, x = ",
+              mpfr_print_rnd_mode (rnd), mask, alias);
+      mpfr_dump (x);
+      for (i = 0; i < 3; i++)
+        if (mask & (1 << i))
+          {
+            printf ("output %d: expected ", i);
+            mpfr_dump (e[i]);
+            printf ("          got      ");
+            mpfr_dump (y[i]);
+          }
+      printf ("expected ret = %d, flags =", exret);
+      flags_out (ex_flags);
+      printf ("got      ret = %d, flags =", ret);
+      flags_out (flags);
+      exit (1);
+    }
+
+  for (i = 0; i < 3; i++)
+    {
+      mpfr_clear (y[i]);
+      mpfr_clear (e[i]);
+    }
+}
+
+static const char *special[] = { "@NaN@", "@Inf@", "-@Inf@", "0", "-0",
+                                "-1.5", "1", "2", "0.125", "10", "1000",
+                                "1e20", "0.999999", "3" };
+
+#define RANDOM_INPUT(x)                                                 \
+  do                                                                    \
+    {                                                                   \
+      mpfr_urandomb (x, RANDS);                                         \
+      mpfr_mul_2si (x, x, (int) (randlimb () % 200) - 100, MPFR_RNDN);  \
+      if (randlimb () % 4 == 0)                                         \
+        mpfr_add_ui (x, x, 1, MPFR_RNDN);                               \
+    }                                                                   \
+  while (0)
+
+static void
+check_special (void)
+{
+  mpfr_t x;
+  mpfr_prec_t p[3] = { 17, 23, 31 };
+  int i, r;
+
+  mpfr_init2 (x, 17);
+  for (i = 0; i < numberof (special); i++)
+    RND_LOOP_NO_RNDF (r)
+      {
+        mpfr_set_str (x, special[i], 10, MPFR_RNDN);
+        check (x, p, 7, -1, (mpfr_rnd_t) r);
+        check (x, p, 3, -1, (mpfr_rnd_t) r);
+        check (x, p, 6, -1, (mpfr_rnd_t) r);
+      }
+  mpfr_clear (x);
+}
+
+static void
+check_random (void)
+{
+  mpfr_t x;
+  mpfr_prec_t p[3], q;
+  int i, j, r;
+
+  for (q = MPFR_PREC_MIN; q <= 300; q += 13)
+    {
+      mpfr_init2 (x, q);
+      for (i = 0; i < 8; i++)
+        {
+          RANDOM_INPUT (x);
+          if (mpfr_zero_p (x))
+            continue;
+          for (j = 0; j < 3; j++)
+            p[j] = q + (randlimb () % 3 == 0 ? 0 : randlimb () % 16);
+          RND_LOOP_NO_RNDF (r)
+            check (x, p, 1 + randlimb () % 7, (int) (randlimb () % 5),
+                   (mpfr_rnd_t) r);
+        }
+      mpfr_clear (x);
+    }
+}
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+  check_special ();
+  check_random ();
+
+  tests_end_mpfr ();
+  return 0;
+}
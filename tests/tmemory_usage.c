@@ -0,0 +1,160 @@
+/* Test file for mpfr_memory_usage and mpfr_memory_limit.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-test.h"
+
+static size_t
+total (mpfr_memory_usage_t *u)
+{
+  return u->const_pi + u->const_log2 + u->const_euler + u->const_catalan
+    + u->bernoulli + u->pool + u->tmp;
+}
+
+/* Check that each cache is taken into account. */
+static void
+check_usage (void)
+{
+  mpfr_memory_usage_t u;
+  mpfr_t x;
+  size_t t;
+
+  mpfr_free_cache ();
+  t = mpfr_memory_usage (&u);
+  if (t != 0 || total (&u) != 0)
+    {
+      printf ("Error in check_usage: non-empty caches (%lu)\n",
+              (unsigned long) t);
+      exit (1);
+    }
+
+  mpfr_init2 (x, 10000);
+  mpfr_const_pi (x, MPFR_RNDN);
+  mpfr_const_log2 (x, MPFR_RNDN);
+  mpfr_const_euler (x, MPFR_RNDN);
+  mpfr_const_catalan (x, MPFR_RNDN);
+  t = mpfr_memory_usage (&u);
+  MPFR_ASSERTN (t == total (&u));
+  MPFR_ASSERTN (u.const_pi >= 10000 / CHAR_BIT);
+  MPFR_ASSERTN (u.const_log2 >= 10000 / CHAR_BIT);
+  MPFR_ASSERTN (u.const_euler >= 10000 / CHAR_BIT);
+  MPFR_ASSERTN (u.const_catalan >= 10000 / CHAR_BIT);
+  MPFR_ASSERTN (u.evictions == 0);
+
+  /* the Bernoulli numbers are cached by mpfr_lngamma */
+  mpfr_set_prec (x, 1000);
+  mpfr_set_ui (x, 1000, MPFR_RNDN);
+  mpfr_lngamma (x, x, MPFR_RNDN);
+  mpfr_memory_usage (&u);
+  MPFR_ASSERTN (u.bernoulli > 0);
+
+  mpfr_clear (x);
+  mpfr_free_cache ();
+  t = mpfr_memory_usage (&u);
+  MPFR_ASSERTN (t == 0);
+}
+
+/* Check that the caches are freed when they exceed the limit (with shared
+   caches, the constant caches are not freed). */
+static void
+check_limit (void)
+{
+#if !defined(MPFR_WANT_SHARED_CACHE)
+  mpfr_memory_usage_t u;
+  mpfr_t x;
+  unsigned long e;
+  size_t t;
+
+  mpfr_free_cache ();
+  mpfr_init2 (x, 10000);
+
+  mpfr_memory_usage (&u);
+  e = u.evictions;
+  MPFR_ASSERTN (mpfr_memory_limit (1000) == 0);
+  mpfr_const_pi (x, MPFR_RNDN);
+  t = mpfr_memory_usage (&u);
+  if (t != 0 || u.evictions != e + 1)
+    {
+      printf ("Error in check_limit: got usage %lu and %lu evictions\n",
+              (unsigned long) t, u.evictions - e);
+      exit (1);
+    }
+
+  /* below the limit */
+  MPFR_ASSERTN (mpfr_memory_limit (1000000) == 1000);
+  mpfr_const_pi (x, MPFR_RNDN);
+  mpfr_const_pi (x, MPFR_RNDN);
+  mpfr_memory_usage (&u);
+  MPFR_ASSERTN (u.const_pi != 0);
+  MPFR_ASSERTN (u.evictions == e + 1);
+
+  MPFR_ASSERTN (mpfr_memory_limit (0) == 1000000);
+  mpfr_clear (x);
+  mpfr_free_cache ();
+#endif
+}
+
+/* Check that the results do not depend on the limit, in particular for
+   functions using several caches. */
+static void
+check_functions (void)
+{
+  mpfr_t x, y, z;
+  size_t l[] = { 0, 1, 5000, 100000 };
+  int i;
+
+  mpfr_inits2 (3000, x, y, z, (mpfr_ptr) 0);
+  for (i = 0; i < numberof (l); i++)
+    {
+      mpfr_free_cache ();
+      mpfr_memory_limit (l[i]);
+      mpfr_set_ui (x, 17, MPFR_RNDN);
+      mpfr_div_ui (x, x, 3, MPFR_RNDN);
+      mpfr_lngamma (y, x, MPFR_RNDN);
+      mpfr_const_euler (x, MPFR_RNDN);
+      mpfr_add (y, y, x, MPFR_RNDN);
+      mpfr_set_ui (x, 3, MPFR_RNDN);
+      mpfr_digamma (x, x, MPFR_RNDN);
+      mpfr_add (y, y, x, MPFR_RNDN);
+      if (i > 0 && ! mpfr_equal_p (y, z))
+        {
+          printf ("Error in check_functions for limit=%lu\n",
+                  (unsigned long) l[i]);
+          exit (1);
+        }
+      mpfr_set (z, y, MPFR_RNDN);
+    }
+  mpfr_memory_limit (0);
+  mpfr_clears (x, y, z, (mpfr_ptr) 0);
+  mpfr_free_cache ();
+}
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+  check_usage ();
+  check_limit ();
+  check_functions ();
+
+  tests_end_mpfr ();
+  return 0;
+}
@@ -22,7 +22,11 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include "mpfr-test.h"
 
 /* The number of variants of nrandom */
-#define NRANDOM_VERSIONS 2
+#define NRANDOM_VERSIONS 3
+
+static int (*const nrandom_fn[NRANDOM_VERSIONS])
+  (mpfr_ptr, gmp_randstate_t, mpfr_rnd_t) =
+  { mpfr_nrandom_v1, mpfr_nrandom_v2, mpfr_nrandom_v3 };
 
 static void
 test_special (int version, mpfr_prec_t p)
@@ -32,8 +36,7 @@ test_special (int version, mpfr_prec_t p)
 
   mpfr_init2 (x, p);
 
-  inexact = (version == 1 ? mpfr_nrandom_v1 : mpfr_nrandom_v2)
-    (x, RANDS, MPFR_RNDN);
+  inexact = nrandom_fn[version - 1] (x, RANDS, MPFR_RNDN);
   if (inexact == 0)
     {
       printf ("Error: mpfr_nrandom_v%d() returns a zero ternary value.\n",
@@ -46,8 +49,9 @@ test_special (int version, mpfr_prec_t p)
 
 #define NRES 10
 
-/* First NRES entries for v1, second NRES entries for v2 */
-static const char *res[2*NRES] = {
+/* First NRES entries for v1, second NRES entries for v2, third NRES entries
+   for v3 */
+static const char *res[NRANDOM_VERSIONS*NRES] = {
   "-2.07609e2d96da78b2d6bea3ab30d4359222a82f8a35e4e4464303ad4808f57458@0",
   "1.a4650a963ab9f266ed009ee96c8788f6b88212f5f2a4d4aef65db2a9e57c44bc@-1",
   "c.0b3cda7f370a36febed972dbb47f2503f7e08a651edbf12d0303d968257841b0@-1",
@@ -68,7 +72,18 @@ static const char *res[2*NRES] = {
   "-8.ed5bb0dab7e39130db211bc4bbce42f0fd4f40db3bc6be9e87c779358e4afc40@-1",
   "3.09fd2a1bfa048dbf1e7850ac6cbea2514a0f3ce011e964d9f331cbcab2efdf10@-1",
   "1.21209642062a049a1ad0e1792dc8a971020cab00adb5fce5a7ad1c546e91b88a@0",
-  "3.0a0818187463c0025f895b41ddb7076c5bf157e3b898e9248baf4ad266fc2f70@-1" };
+  "3.0a0818187463c0025f895b41ddb7076c5bf157e3b898e9248baf4ad266fc2f70@-1",
+
+  "-f.297c3bcc60cd6162752d39e0fde8d66e735cd71a98d615dfcf16701b19039210@-1",
+  "9.5808a7220ca7b8e9f9a018731d91b487525173825870a8696f5072d243941e30@-1",
+  "1.9276e3966bb8881fbc3fc16b1aa11d5f351182f27bc9fba5d7e99a0ca1927f40@-1",
+  "-a.daa9a32f622b930e242b322cf84df9a49d68e0e86d1d8c645d383366339ce010@-2",
+  "d.7447ea37517a57ed62a602ad559001b2c16fe15cedef0fb5a8190c7533825210@-1",
+  "-9.029ccc775853f0b6728e45c41d8278b46aaec98f40978fd36270121b1d74aeb0@-2",
+  "-a.d0c0eb523efda18eeb299e0025b69e2cb5afa8eacc350d6488aa0be28d793910@-1",
+  "c.d64f149e483bae31f31f7a4130a45ef3f9923f76cd64dc25868bf2dfa5253a80@-1",
+  "-1.d7a073e88bb9c98c5031c0ce941456631a793322348bc99e6708fa6d34775d32@-1",
+  "-c.19092d783b69f800691942a63307fc97a99beda709f758a5509bb60c89f61280@-2" };
 
 /* If checkval is true, check the obtained results by using a fixed seed
    for reproducibility. */
@@ -94,7 +109,7 @@ test_nrandom (int version, long nbtests, mpfr_prec_t prec, mpfr_rnd_t rnd,
 
   for (i = 0; i < nbtests; i++)
     {
-      inexact = (version == 1 ? mpfr_nrandom_v1 : mpfr_nrandom_v2)
+      inexact = nrandom_fn[version - 1]
         (t[i], checkval ? s : RANDS, MPFR_RNDN);
 
       if (checkval &&
@@ -155,6 +170,95 @@ test_nrandom (int version, long nbtests, mpfr_prec_t prec, mpfr_rnd_t rnd,
   return;
 }
 
+#ifndef MPFR_USE_MINI_GMP
+/* Check that mpfr_nrandom_vec gives the same results as successive calls
+   to mpfr_nrandom. */
+static void
+test_nrandom_vec (mpfr_prec_t p)
+{
+  gmp_randstate_t s1, s2;
+  mpfr_t x[10], y;
+  mpfr_ptr px[10];
+  int inex[10], inexy;
+  unsigned long i, n = numberof (x);
+
+  gmp_randinit_default (s1);
+  gmp_randinit_default (s2);
+  gmp_randseed_ui (s1, 42);
+  gmp_randseed_ui (s2, 42);
+  for (i = 0; i < n; i++)
+    {
+      mpfr_init2 (x[i], p);
+      px[i] = x[i];
+    }
+  mpfr_init2 (y, p);
+  MPFR_ASSERTN (mpfr_nrandom_vec (px, inex, n, s1, MPFR_RNDN) != 0);
+  for (i = 0; i < n; i++)
+    {
+      inexy = mpfr_nrandom (y, s2, MPFR_RNDN);
+      if (! mpfr_equal_p (x[i], y) || inex[i] != inexy)
+        {
+          printf ("Error in mpfr_nrandom_vec for p=%ld, i=%lu\n", (long) p, i);
+          printf ("Expected ");
+          mpfr_dump (y);
+          printf ("Got      ");
+          mpfr_dump (x[i]);
+          printf ("with inex=%d instead of %d\n", inex[i], inexy);
+          exit (1);
+        }
+    }
+  for (i = 0; i < n; i++)
+    mpfr_clear (x[i]);
+  mpfr_clear (y);
+  gmp_randclear (s1);
+  gmp_randclear (s2);
+}
+#endif
+
+#ifndef MPFR_USE_MINI_GMP
+/* Check that mpfr_nrandom_v3 rounds the deviate correctly, by generating
+   it with the same random bits in two directed rounding modes, and that
+   the tail (|x| >= 4), which is handled separately, is reached. */
+static void
+test_nrandom_v3 (void)
+{
+  gmp_randstate_t s, t;
+  mpfr_t x, y;
+  long i, tail = 0;
+  int inex1, inex2;
+
+  gmp_randinit_default (s);
+  gmp_randseed_ui (s, 42);
+  mpfr_init2 (x, 8);
+  mpfr_init2 (y, 8);
+  for (i = 0; i < 400000; i++)
+    {
+      gmp_randinit_set (t, s);
+      inex1 = mpfr_nrandom_v3 (x, s, MPFR_RNDD);
+      inex2 = mpfr_nrandom_v3 (y, t, MPFR_RNDU);
+      gmp_randclear (t);
+      mpfr_nextabove (x);
+      if (inex1 >= 0 || inex2 <= 0 || ! mpfr_equal_p (x, y))
+        {
+          printf ("Error in test_nrandom_v3 for i=%ld\n", i);
+          printf ("inex1=%d inex2=%d\n", inex1, inex2);
+          printf ("x=");
+          mpfr_dump (x);
+          printf ("y=");
+          mpfr_dump (y);
+          exit (1);
+        }
+      if (mpfr_cmpabs_ui (y, 4) >= 0)
+        tail++;
+    }
+  /* about 25 values are expected in the tail */
+  MPFR_ASSERTN (tail > 0);
+  mpfr_clear (x);
+  mpfr_clear (y);
+  gmp_randclear (s);
+}
+#endif
+
 int
 main (int argc, char *argv[])
 {
@@ -190,6 +294,12 @@ main (int argc, char *argv[])
       test_special (v, 42000);
     }
 
+#ifndef MPFR_USE_MINI_GMP
+  test_nrandom_vec (2);
+  test_nrandom_vec (420);
+  test_nrandom_v3 ();
+#endif
+
   tests_end_mpfr ();
   return 0;
 }
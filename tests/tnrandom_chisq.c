@@ -22,7 +22,11 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include "mpfr-test.h"
 
 /* The number of variants of nrandom */
-#define NRANDOM_VERSIONS 2
+#define NRANDOM_VERSIONS 3
+
+static int (*const nrandom_fn[NRANDOM_VERSIONS])
+  (mpfr_ptr, gmp_randstate_t, mpfr_rnd_t) =
+  { mpfr_nrandom_v1, mpfr_nrandom_v2, mpfr_nrandom_v3 };
 
 /* Return Phi(x) = erf(x / sqrt(2)) / 2, the cumulative probability function
  * for the normal distribution.  We only take differences of this function so
@@ -112,8 +116,7 @@ test_nrandom_chisq_cont (int version, gmp_randstate_t s,
 
   for (k = 0; k < num; ++k)
     {
-      inexact = (version == 1 ? mpfr_nrandom_v1 : mpfr_nrandom_v2)
-        (x, s, rndd);
+      inexact = nrandom_fn[version - 1] (x, s, rndd);
       if (inexact == 0)
         {
           /* one call in the loop pretended to return an exact number! */
@@ -240,8 +243,7 @@ test_nrandom_chisq_disc (int version, gmp_randstate_t s,
 
   for (k = 0; k < num; ++k)
     {
-      inexact = (version == 1 ? mpfr_nrandom_v1 : mpfr_nrandom_v2)
-        (x, s, rnd);
+      inexact = nrandom_fn[version - 1] (x, s, rnd);
       if (mpfr_signbit (x))
         {
           inexact = -inexact;
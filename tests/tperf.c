@@ -0,0 +1,139 @@
+/* Test file for mpfr_perf_enable, mpfr_perf_snapshot and mpfr_perf_reset.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-test.h"
+
+/* Return the counters of the function f, or NULL. */
+static mpfr_perf_t *
+find (const char *f)
+{
+  static mpfr_perf_t tab[64];
+  size_t n, i;
+
+  n = mpfr_perf_snapshot (tab, numberof (tab));
+  for (i = 0; i < n && i < numberof (tab); i++)
+    if (strcmp (tab[i].name, f) == 0)
+      return &tab[i];
+  return NULL;
+}
+
+static void
+check (void)
+{
+  mpfr_t x, y;
+  mpfr_perf_t *r;
+  unsigned long s;
+  int i;
+
+  mpfr_init2 (x, 53);
+  mpfr_init2 (y, 53);
+  mpfr_set_ui (x, 1, MPFR_RNDN);
+
+  /* nothing is counted when the counters are disabled */
+  if (mpfr_perf_enable (0) != 0)
+    {
+      printf ("Error, counters enabled by default\n");
+      exit (1);
+    }
+  mpfr_perf_reset ();
+  mpfr_sin (y, x, MPFR_RNDN);
+  if (mpfr_perf_snapshot (NULL, 0) != 0)
+    {
+      printf ("Error, counters used while disabled\n");
+      exit (1);
+    }
+
+  mpfr_perf_enable (1);
+  for (i = 0; i < 3; i++)
+    mpfr_sin (y, x, MPFR_RNDN);
+  mpfr_set_prec (y, 200);
+  mpfr_sin (y, x, MPFR_RNDN);
+  mpfr_set_prec (y, 5000);
+  mpfr_sin (y, x, MPFR_RNDN);
+  /* mpfr_tan calls mpfr_sin_cos, which must not be counted */
+  mpfr_tan (y, x, MPFR_RNDN);
+  if (mpfr_perf_enable (0) != 1)
+    {
+      printf ("Error, wrong return value of mpfr_perf_enable\n");
+      exit (1);
+    }
+  mpfr_sin (y, x, MPFR_RNDN);
+
+  r = find ("mpfr_sin");
+  if (r == NULL || r->calls != 5)
+    {
+      printf ("Error, wrong number of calls for mpfr_sin\n");
+      exit (1);
+    }
+  /* 53 <= 64, 2^7 < 200 <= 2^8, 2^12 < 5000 <= 2^13 */
+  for (i = 0, s = 0; i < MPFR_PERF_NBUCKETS; i++)
+    s += r->prec_hist[i];
+  if (r->prec_hist[0] != 3 || r->prec_hist[2] != 1 || r->prec_hist[7] != 1
+      || s != 5)
+    {
+      printf ("Error, wrong precision histogram for mpfr_sin:");
+      for (i = 0; i < MPFR_PERF_NBUCKETS; i++)
+        printf (" %lu", r->prec_hist[i]);
+      printf ("\n");
+      exit (1);
+    }
+#ifdef MPFR_PERF_TIMING
+  /* at least the calls in precision 200 and 5000 use a Ziv loop (in small
+     precision, mpfr_sin may use fixed-point code) */
+  if (r->ziv_loops < 2 || r->ziv_iterations < r->ziv_loops || r->ticks < 0)
+    {
+      printf ("Error, wrong Ziv counts or time for mpfr_sin\n");
+      exit (1);
+    }
+#endif
+  r = find ("mpfr_tan");
+  if (r == NULL || r->calls != 1 || r->prec_hist[7] != 1)
+    {
+      printf ("Error, wrong counters for mpfr_tan\n");
+      exit (1);
+    }
+  if (find ("mpfr_sin_cos") != NULL)
+    {
+      printf ("Error, nested call of mpfr_sin_cos counted\n");
+      exit (1);
+    }
+
+  mpfr_perf_reset ();
+  if (mpfr_perf_snapshot (NULL, 0) != 0)
+    {
+      printf ("Error, non-empty counters after reset\n");
+      exit (1);
+    }
+
+  mpfr_clear (x);
+  mpfr_clear (y);
+}
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+  check ();
+
+  tests_end_mpfr ();
+  return 0;
+}
@@ -0,0 +1,554 @@
+/* Test file for mpfr_poly_eval and mpfr_poly_eval_vec.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-test.h"
+
+#define NMAX 50
+
+/* Set r to the exact value of c[0] + c[1]*x + ... + c[n-1]*x^(n-1) for
+   finite numbers, with Horner's rule in a large enough precision. */
+static void
+exact_eval (mpfr_ptr r, mpfr_ptr *c, unsigned long n, mpfr_srcptr x)
+{
+  int inex;
+
+  mpfr_set_prec (r, 16384);
+  mpfr_set_zero (r, 1);
+  while (n-- > 0)
+    {
+      inex = mpfr_fma (r, r, x, c[n], MPFR_RNDN);
+      MPFR_ASSERTN (inex == 0);
+    }
+}
+
+/* Return the sign of an exact zero result, as for mpfr_sum: the common
+   sign of the terms c[i]*x^i if they are all zeros of the same sign, and
+   otherwise, +0, except for MPFR_RNDD. */
+static int
+zero_sign (mpfr_ptr *c, unsigned long n, mpfr_srcptr x, mpfr_rnd_t rnd)
+{
+  unsigned long i;
+  int s = 0, si;
+
+  for (i = 0; i < n; i++)
+    {
+      if (! mpfr_zero_p (c[i]) && (i == 0 || ! mpfr_zero_p (x)))
+        return rnd == MPFR_RNDD;
+      si = MPFR_IS_NEG (c[i]) ^ (MPFR_IS_NEG (x) && (i & 1));
+      if (i > 0 && si != s)
+        return rnd == MPFR_RNDD;
+      s = si;
+    }
+  return s;
+}
+
+/* Check mpfr_poly_eval and mpfr_poly_eval_vec on x, in precision p, against
+   the exact value rounded (which must be a finite number), and also with
+   the result in x and in c[0]. */
+static void
+check_exact (mpfr_ptr *c, unsigned long n, mpfr_srcptr x, mpfr_prec_t p)
+{
+  mpfr_t r, y1, y2, c0;
+  mpfr_ptr yp, xp;
+  mpfr_flags_t flags1, flags2;
+  int inex1, inex2, inex3, k, rnd, t[1];
+
+  mpfr_init2 (r, MPFR_PREC_MIN);
+  exact_eval (r, c, n, x);
+  mpfr_inits2 (p, y1, y2, (mpfr_ptr) 0);
+  RND_LOOP_NO_RNDF (rnd)
+    {
+      mpfr_clear_flags ();
+      inex1 = mpfr_set (y1, r, (mpfr_rnd_t) rnd);
+      flags1 = __gmpfr_flags;
+      if (mpfr_zero_p (y1))
+        mpfr_setsign (y1, y1, zero_sign (c, n, x, (mpfr_rnd_t) rnd),
+                      MPFR_RNDN);
+      for (k = 0; k < 4; k++)
+        {
+          /* k = 1: y is x; k = 2: y is c[0]; k = 3: vector version */
+          if ((k == 1 && MPFR_PREC (x) != p) ||
+              (k == 2 && (n == 0 || MPFR_PREC (c[0]) != p)))
+            continue;
+          mpfr_clear_flags ();
+          if (k == 1)
+            {
+              mpfr_set (y2, x, MPFR_RNDN);
+              inex2 = mpfr_poly_eval (y2, c, n, y2, (mpfr_rnd_t) rnd);
+            }
+          else if (k == 2)
+            {
+              mpfr_init2 (c0, p);
+              mpfr_set (c0, c[0], MPFR_RNDN);
+              mpfr_swap (c0, c[0]);
+              mpfr_clear_flags ();
+              inex2 = mpfr_poly_eval (c[0], c, n, x, (mpfr_rnd_t) rnd);
+              mpfr_swap (c0, c[0]);
+              mpfr_set (y2, c0, MPFR_RNDN);
+              mpfr_clear (c0);
+            }
+          else if (k == 3)
+            {
+              xp = (mpfr_ptr) x;
+              yp = y2;
+              inex3 = mpfr_poly_eval_vec (&yp, t, c, n, &xp, 1,
+                                          (mpfr_rnd_t) rnd);
+              inex2 = t[0];
+              MPFR_ASSERTN ((inex2 != 0) == (inex3 != 0));
+            }
+          else
+            inex2 = mpfr_poly_eval (y2, c, n, x, (mpfr_rnd_t) rnd);
+          flags2 = __gmpfr_flags;
+          if (! SAME_VAL (y1, y2) || ! SAME_SIGN (inex1, inex2) ||
+              flags1 != flags2)
+            {
+              unsigned long i;
+
+              printf ("Error in mpfr_poly_eval for n = %lu, p = %ld, %s, "
+                      "k = %d\n", n, (long) p,
+                      mpfr_print_rnd_mode ((mpfr_rnd_t) rnd), k);
+              for (i = 0; i < n; i++)
+                {
+                  printf ("c[%lu] = ", i);
+                  mpfr_dump (c[i]);
+                }
+              printf ("x = ");
+              mpfr_dump (x);
+              printf ("expected ");
+              mpfr_dump (y1);
+              printf ("with inex = %d, flags =", inex1);
+              flags_out (flags1);
+              printf ("got      ");
+              mpfr_dump (y2);
+              printf ("with inex = %d, flags =", inex2);
+              flags_out (flags2);
+              exit (1);
+            }
+        }
+    }
+  mpfr_clears (r, y1, y2, (mpfr_ptr) 0);
+}
+
+/* random coefficients of random precisions and exponents, some of them
+   zero, and x random, an integer or a power of 2 */
+static void
+check_random (void)
+{
+  mpfr_t cc[NMAX], x;
+  mpfr_ptr c[NMAX];
+  unsigned long i, n;
+  mpfr_prec_t p;
+  int j;
+
+  for (i = 0; i < NMAX; i++)
+    {
+      mpfr_init2 (cc[i], MPFR_PREC_MIN);
+      c[i] = cc[i];
+    }
+  mpfr_init2 (x, MPFR_PREC_MIN);
+  for (j = 0; j < 200; j++)
+    {
+      n = j < 100 ? randlimb () % 13 : randlimb () % (NMAX + 1);
+      p = MPFR_PREC_MIN + randlimb () % 150;
+      for (i = 0; i < n; i++)
+        {
+          mpfr_set_prec (cc[i], MPFR_PREC_MIN + randlimb () % 100);
+          if (randlimb () % 8 == 0)
+            mpfr_set_zero (cc[i], RAND_BOOL () ? 1 : -1);
+          else
+            {
+              mpfr_urandomb (cc[i], RANDS);
+              mpfr_mul_2si (cc[i], cc[i], (long) (randlimb () % 21) - 10,
+                            MPFR_RNDN);
+              if (RAND_BOOL ())
+                mpfr_neg (cc[i], cc[i], MPFR_RNDN);
+            }
+        }
+      mpfr_set_prec (x, MPFR_PREC_MIN + randlimb () % (n > 12 ? 60 : 100));
+      switch (randlimb () % 4)
+        {
+        case 0:
+          mpfr_set_si (x, (long) (randlimb () % 7) - 3, MPFR_RNDN);
+          break;
+        case 1:
+          mpfr_set_si_2exp (x, RAND_BOOL () ? 1 : -1,
+                            (long) (randlimb () % 9) - 4, MPFR_RNDN);
+          break;
+        default:
+          mpfr_urandomb (x, RANDS);
+          mpfr_mul_2si (x, x, (long) (randlimb () % 5) - 2, MPFR_RNDN);
+          if (RAND_BOOL ())
+            mpfr_neg (x, x, MPFR_RNDN);
+        }
+      check_exact (c, n, x, p);
+    }
+  for (i = 0; i < NMAX; i++)
+    mpfr_clear (cc[i]);
+  mpfr_clear (x);
+}
+
+/* x and the coefficients with 64 bits, which is the working precision of
+   the first attempt for n = 5 and a 40-bit result, so that they are used
+   without any conversion */
+static void
+check_prec64 (void)
+{
+  mpfr_t cc[5], x;
+  mpfr_ptr c[5];
+  unsigned long i;
+  int j;
+
+  for (i = 0; i < 5; i++)
+    {
+      mpfr_init2 (cc[i], 64);
+      c[i] = cc[i];
+    }
+  mpfr_init2 (x, 64);
+  for (j = 0; j < 20; j++)
+    {
+      for (i = 0; i < 5; i++)
+        {
+          mpfr_urandomb (cc[i], RANDS);
+          if (RAND_BOOL ())
+            mpfr_neg (cc[i], cc[i], MPFR_RNDN);
+        }
+      mpfr_urandomb (x, RANDS);
+      if (RAND_BOOL ())
+        mpfr_neg (x, x, MPFR_RNDN);
+      check_exact (c, 5, x, 40);
+    }
+  for (i = 0; i < 5; i++)
+    mpfr_clear (cc[i]);
+  mpfr_clear (x);
+}
+
+/* polynomials with large cancellations: (x-a)^k expanded, at x close to
+   a, and at x = a (exact zero) */
+static void
+check_cancel (void)
+{
+  mpfr_t cc[10], x, a;
+  mpfr_ptr c[10];
+  int i, k;
+
+  mpfr_init2 (a, 20);
+  mpfr_init2 (x, 60);
+  for (i = 0; i < 10; i++)
+    {
+      mpfr_init2 (cc[i], 200);
+      c[i] = cc[i];
+    }
+  mpfr_set_ui_2exp (a, 3, -1, MPFR_RNDN);
+  for (k = 1; k < 10; k++)
+    {
+      /* coefficients of (x-a)^k, exact in 200 bits */
+      mpfr_set_ui (cc[0], 1, MPFR_RNDN);
+      for (i = 1; i <= k; i++)
+        {
+          int l;
+
+          mpfr_set_zero (cc[i], 1);
+          for (l = i; l > 0; l--)
+            mpfr_fms (cc[l], cc[l], a, cc[l - 1], MPFR_RNDN);
+          mpfr_mul (cc[0], cc[0], a, MPFR_RNDN);
+          mpfr_neg (cc[0], cc[0], MPFR_RNDN);
+        }
+      for (i = 0; i < 3; i++)
+        {
+          mpfr_set (x, a, MPFR_RNDN);
+          if (i == 1)
+            mpfr_nextabove (x);
+          else if (i == 2)
+            mpfr_nextbelow (x);
+          check_exact (c, k + 1, x, 53);
+          check_exact (c, k + 1, x, 2);
+        }
+    }
+  for (i = 0; i < 10; i++)
+    mpfr_clear (cc[i]);
+  mpfr_clears (a, x, (mpfr_ptr) 0);
+}
+
+/* NaN, infinities and zeros */
+static void
+check_special (void)
+{
+  mpfr_t cc[3], x, y;
+  mpfr_ptr c[3];
+  int i, inex;
+
+  for (i = 0; i < 3; i++)
+    {
+      mpfr_init2 (cc[i], 10);
+      mpfr_set_ui (cc[i], i + 1, MPFR_RNDN);
+      c[i] = cc[i];
+    }
+  mpfr_inits2 (10, x, y, (mpfr_ptr) 0);
+
+  /* n = 0: +0 */
+  mpfr_set_nan (x);
+  inex = mpfr_poly_eval (y, c, 0, x, MPFR_RNDD);
+  MPFR_ASSERTN (inex == 0 && MPFR_IS_ZERO (y) && MPFR_IS_POS (y));
+
+  /* x^0 = 1 even for x = NaN */
+  mpfr_clear_flags ();
+  inex = mpfr_poly_eval (y, c, 1, x, MPFR_RNDN);
+  MPFR_ASSERTN (inex == 0 && mpfr_cmp_ui (y, 1) == 0 &&
+                __gmpfr_flags == 0);
+  mpfr_clear_flags ();
+  inex = mpfr_poly_eval (y, c, 3, x, MPFR_RNDN);
+  MPFR_ASSERTN (inex == 0 && mpfr_nan_p (y) && mpfr_nanflag_p ());
+
+  /* at x = -Inf: 1 + 2x + 3x^2 gives -Inf + Inf = NaN, 1 - 2x + 3x^2
+     gives +Inf, 1 - 2x + 0x^2 gives NaN (0 * Inf), and 1 + 2x gives -Inf;
+     at x = +0: 1 + 0x + 3x^2 gives 1 */
+  mpfr_set_inf (x, -1);
+  mpfr_clear_flags ();
+  inex = mpfr_poly_eval (y, c, 3, x, MPFR_RNDN);
+  MPFR_ASSERTN (inex == 0 && mpfr_nan_p (y) && mpfr_nanflag_p ());
+  mpfr_neg (cc[1], cc[1], MPFR_RNDN);
+  inex = mpfr_poly_eval (y, c, 3, x, MPFR_RNDN);
+  MPFR_ASSERTN (inex == 0 && mpfr_inf_p (y) && MPFR_IS_POS (y));
+  mpfr_set_zero (cc[2], 1);
+  mpfr_clear_flags ();
+  inex = mpfr_poly_eval (y, c, 3, x, MPFR_RNDN);
+  MPFR_ASSERTN (inex == 0 && mpfr_nan_p (y) && mpfr_nanflag_p ());
+  mpfr_neg (cc[1], cc[1], MPFR_RNDN);
+  inex = mpfr_poly_eval (y, c, 2, x, MPFR_RNDN);
+  MPFR_ASSERTN (inex == 0 && mpfr_inf_p (y) && MPFR_IS_NEG (y));
+  mpfr_set_zero (x, 1);
+  mpfr_set_zero (cc[1], 1);
+  mpfr_set_ui (cc[2], 3, MPFR_RNDN);
+  inex = mpfr_poly_eval (y, c, 3, x, MPFR_RNDN);
+  MPFR_ASSERTN (inex == 0 && mpfr_cmp_ui (y, 1) == 0);
+
+  /* infinite coefficients at a regular x: 1 + Inf*x - Inf*x^2 at x = -3
+     gives -Inf - Inf = -Inf, and at x = 3, Inf - Inf = NaN */
+  mpfr_set_si (x, -3, MPFR_RNDN);
+  mpfr_set_inf (cc[1], 1);
+  mpfr_set_inf (cc[2], -1);
+  inex = mpfr_poly_eval (y, c, 3, x, MPFR_RNDN);
+  MPFR_ASSERTN (inex == 0 && mpfr_inf_p (y) && MPFR_IS_NEG (y));
+  mpfr_neg (x, x, MPFR_RNDN);
+  inex = mpfr_poly_eval (y, c, 3, x, MPFR_RNDN);
+  MPFR_ASSERTN (inex == 0 && mpfr_nan_p (y));
+  mpfr_set_nan (cc[0]);
+  mpfr_set_ui (cc[1], 1, MPFR_RNDN);
+  mpfr_set_ui (cc[2], 1, MPFR_RNDN);
+  inex = mpfr_poly_eval (y, c, 3, x, MPFR_RNDN);
+  MPFR_ASSERTN (inex == 0 && mpfr_nan_p (y));
+
+  for (i = 0; i < 3; i++)
+    mpfr_clear (cc[i]);
+  mpfr_clears (x, y, (mpfr_ptr) 0);
+}
+
+/* mpfr_poly_eval_vec on several values, some of them special, with
+   y[j] = x[j] for odd j, against mpfr_poly_eval */
+static void
+check_vec (void)
+{
+  mpfr_t cc[20], xx[8], yy[8], z, zx;
+  mpfr_ptr c[20], x[8], y[8];
+  int inex[8], i, j, ret, t, inex2;
+
+  for (i = 0; i < 20; i++)
+    {
+      mpfr_init2 (cc[i], 40);
+      mpfr_urandomb (cc[i], RANDS);
+      mpfr_sub_d (cc[i], cc[i], 0.5, MPFR_RNDN);
+      c[i] = cc[i];
+    }
+  mpfr_init2 (z, 30);
+  mpfr_init2 (zx, 30);
+  for (j = 0; j < 8; j++)
+    {
+      mpfr_init2 (xx[j], 30);
+      mpfr_init2 (yy[j], 30);
+      x[j] = xx[j];
+      y[j] = (j & 1) ? xx[j] : yy[j];
+    }
+  for (i = 0; i <= 20; i++)
+    {
+      for (j = 0; j < 8; j++)
+        {
+          if (j == 3)
+            mpfr_set_inf (xx[j], 1);
+          else if (j == 4)
+            mpfr_set_zero (xx[j], -1);
+          else
+            {
+              mpfr_urandomb (xx[j], RANDS);
+              mpfr_mul_2si (xx[j], xx[j], j - 3, MPFR_RNDN);
+            }
+          /* copy of the input, since x[j] is overwritten for odd j */
+          if (j & 1)
+            mpfr_set (yy[j], xx[j], MPFR_RNDN);
+        }
+      ret = mpfr_poly_eval_vec (y, inex, c, i, x, 8, MPFR_RNDU);
+      t = 0;
+      for (j = 0; j < 8; j++)
+        {
+          mpfr_set (zx, (j & 1) ? yy[j] : xx[j], MPFR_RNDN);
+          inex2 = mpfr_poly_eval (z, c, i, zx, MPFR_RNDU);
+          t |= inex2 != 0;
+          if (! SAME_VAL (z, y[j]) || inex[j] != inex2)
+            {
+              printf ("Error in mpfr_poly_eval_vec for n = %d, j = %d\n",
+                      i, j);
+              printf ("expected ");
+              mpfr_dump (z);
+              printf ("with inex = %d\n", inex2);
+              printf ("got      ");
+              mpfr_dump (y[j]);
+              printf ("with inex = %d\n", inex[j]);
+              exit (1);
+            }
+        }
+      MPFR_ASSERTN ((ret != 0) == t);
+    }
+  for (i = 0; i < 20; i++)
+    mpfr_clear (cc[i]);
+  for (j = 0; j < 8; j++)
+    {
+      mpfr_clear (xx[j]);
+      mpfr_clear (yy[j]);
+    }
+  mpfr_clears (z, zx, (mpfr_ptr) 0);
+}
+
+/* huge and tiny x in the largest exponent range, where the terms and the
+   intermediate results can be outside the extended exponent range: the
+   expected results are obtained from simpler operations */
+static void
+check_extreme (void)
+{
+  mpfr_t cc[3], x, y1, y2, t;
+  mpfr_ptr c[3];
+  mpfr_exp_t emin, emax, b;
+  mpfr_flags_t flags1, flags2;
+  int i, j, r, inex1, inex2;
+
+  emin = mpfr_get_emin ();
+  emax = mpfr_get_emax ();
+  set_emin (MPFR_EMIN_MIN);
+  set_emax (MPFR_EMAX_MAX);
+  for (i = 0; i < 3; i++)
+    {
+      mpfr_init2 (cc[i], 10);
+      c[i] = cc[i];
+    }
+  mpfr_inits2 (10, x, y1, y2, t, (mpfr_ptr) 0);
+  b = (MPFR_EMAX_MAX + 1) / 2;
+
+  for (j = 0; j < 8; j++)
+    RND_LOOP_NO_RNDF (r)
+      {
+        mpfr_rnd_t rnd = (mpfr_rnd_t) r;
+
+        mpfr_set_ui (cc[0], 1, MPFR_RNDN);
+        mpfr_set_ui (cc[1], j == 2 || j == 3 || j == 6 ? 0 : 1, MPFR_RNDN);
+        mpfr_set_si (cc[2], j == 3 || j == 5 ? -1 : 1, MPFR_RNDN);
+        if (j < 4)
+          mpfr_set_si_2exp (x, j == 1 ? -1 : 1, MPFR_EMIN_MIN + 10,
+                            MPFR_RNDN);
+        else if (j < 6)
+          mpfr_set_ui_2exp (x, 1, MPFR_EMAX_MAX - 10, MPFR_RNDN);
+        else
+          mpfr_set_ui_2exp (x, 1, j == 6 ? -b : b, MPFR_RNDN);
+        mpfr_clear_flags ();
+        switch (j)
+          {
+          case 0:
+          case 1:
+          case 2:
+            /* 1 + x + x^2 at x = +/-2^(emin+10), and 1 + x^2, which round
+               like 1 + x */
+            inex1 = mpfr_add (y1, cc[0], x, rnd);
+            break;
+          case 3:
+            /* 1 - x^2, which rounds like 1 - x */
+            inex1 = mpfr_sub (y1, cc[0], x, rnd);
+            break;
+          case 4:
+            /* 1 + x + x^2 at x = 2^(emax-10): overflow */
+            inex1 = mpfr_sqr (y1, x, rnd);
+            break;
+          case 5:
+            /* 1 + x - x^2: overflow */
+            mpfr_neg (t, x, MPFR_RNDN);
+            inex1 = mpfr_mul (y1, x, t, rnd);
+            break;
+          case 6:
+            /* x^2/2 = 2^(emin-2) at x = 2^(-b): underflow (midpoint) */
+            mpfr_set_zero (cc[0], 1);
+            mpfr_set_ui_2exp (cc[2], 1, -1, MPFR_RNDN);
+            inex1 = mpfr_set_ui_2exp (y1, 1, -2 * b - 1, rnd);
+            break;
+          default:
+            /* 1 + x + 2^(5-2b) x^2 = 2^b + 33 at x = 2^b, where x^2 is
+               larger than the maximum exponent */
+            mpfr_set_ui_2exp (cc[2], 1, 5 - 2 * b, MPFR_RNDN);
+            inex1 = mpfr_add_ui (y1, x, 33, rnd);
+          }
+        flags1 = __gmpfr_flags;
+        mpfr_clear_flags ();
+        inex2 = mpfr_poly_eval (y2, c, 3, x, rnd);
+        flags2 = __gmpfr_flags;
+        if (! SAME_VAL (y1, y2) || ! SAME_SIGN (inex1, inex2) ||
+            flags1 != flags2)
+          {
+            printf ("Error in check_extreme for j = %d, %s\n", j,
+                    mpfr_print_rnd_mode (rnd));
+            printf ("expected ");
+            mpfr_dump (y1);
+            printf ("with inex = %d, flags =", inex1);
+            flags_out (flags1);
+            printf ("got      ");
+            mpfr_dump (y2);
+            printf ("with inex = %d, flags =", inex2);
+            flags_out (flags2);
+            exit (1);
+          }
+      }
+
+  for (i = 0; i < 3; i++)
+    mpfr_clear (cc[i]);
+  mpfr_clears (x, y1, y2, t, (mpfr_ptr) 0);
+  set_emin (emin);
+  set_emax (emax);
+}
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+  check_special ();
+  check_cancel ();
+  check_random ();
+  check_prec64 ();
+  check_vec ();
+  check_extreme ();
+
+  tests_end_mpfr ();
+  return 0;
+}
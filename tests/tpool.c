@@ -0,0 +1,182 @@
+/* Test file for the mpz_t pool: mpfr_pool_config, mpfr_pool_stats,
+   mpfr_pool_stats_reset and mpfr_free_pool.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-test.h"
+
+#if MPFR_POOL_NENTRIES
+
+static void
+check_stats (unsigned long h, unsigned long m, size_t b, const char *msg)
+{
+  unsigned long hits, misses;
+  size_t bytes;
+
+  mpfr_pool_stats (&hits, &misses, &bytes);
+  if (hits != h || misses != m || bytes != b)
+    {
+      printf ("Error in %s\n", msg);
+      printf ("expected hits=%lu misses=%lu bytes=%lu\n",
+              h, m, (unsigned long) b);
+      printf ("got      hits=%lu misses=%lu bytes=%lu\n",
+              hits, misses, (unsigned long) bytes);
+      exit (1);
+    }
+}
+
+/* Check that a mpz_t given back to the pool is reused, and that
+   mpfr_mpz_init2 takes a mpz_t that is large enough. */
+static void
+check_reuse (void)
+{
+  mpz_t a, b, c;
+  size_t s;
+
+  mpfr_free_pool ();
+  mpfr_pool_config (1024, 1 << 20);
+  mpfr_pool_stats_reset ();
+  check_stats (0, 0, 0, "check_reuse (initial)");
+
+  mpfr_mpz_init2 (a, 10 * GMP_NUMB_BITS);
+  mpfr_mpz_init2 (b, 100 * GMP_NUMB_BITS);
+  check_stats (0, 2, 0, "check_reuse (misses)");
+  s = (ALLOC (a) + ALLOC (b)) * MPFR_BYTES_PER_MP_LIMB;
+  mpfr_mpz_clear (a);
+  mpfr_mpz_clear (b);
+  check_stats (0, 2, s, "check_reuse (clear)");
+
+  /* 20 limbs: b is the only one large enough */
+  mpfr_mpz_init2 (c, 20 * GMP_NUMB_BITS);
+  MPFR_ASSERTN (ALLOC (c) >= 100);
+  MPFR_ASSERTN (mpz_sgn (c) == 0);
+  check_stats (1, 2, s - ALLOC (c) * MPFR_BYTES_PER_MP_LIMB,
+               "check_reuse (init2)");
+  mpz_set_ui (c, 17);
+  mpfr_mpz_clear (c);
+
+  /* 200 limbs: none is large enough */
+  mpfr_mpz_init2 (c, 200 * GMP_NUMB_BITS);
+  check_stats (1, 3, s, "check_reuse (init2, large)");
+  mpfr_mpz_clear (c);
+
+  /* mpfr_mpz_init takes the largest one */
+  mpfr_mpz_init (c);
+  MPFR_ASSERTN (ALLOC (c) >= 200);
+  MPFR_ASSERTN (mpz_sgn (c) == 0);
+  check_stats (2, 3, s, "check_reuse (init)");
+  mpfr_mpz_clear (c);
+
+  mpfr_free_pool ();
+  check_stats (2, 3, 0, "check_reuse (mpfr_free_pool)");
+}
+
+/* Check the limits set by mpfr_pool_config. */
+static void
+check_config (void)
+{
+  mpz_t a[4];
+  int i;
+
+  mpfr_free_pool ();
+  mpfr_pool_stats_reset ();
+
+  /* disabled pool */
+  mpfr_pool_config (0, 1 << 20);
+  for (i = 0; i < 2; i++)
+    {
+      mpfr_mpz_init2 (a[0], GMP_NUMB_BITS);
+      mpfr_mpz_clear (a[0]);
+    }
+  check_stats (0, 2, 0, "check_config (disabled)");
+
+  /* entries larger than max_limbs are not cached */
+  mpfr_pool_config (8, 1 << 20);
+  mpfr_mpz_init2 (a[0], 4 * GMP_NUMB_BITS);
+  mpfr_mpz_init2 (a[1], 16 * GMP_NUMB_BITS);
+  mpfr_mpz_clear (a[0]);
+  mpfr_mpz_clear (a[1]);
+  check_stats (0, 4, 4 * MPFR_BYTES_PER_MP_LIMB, "check_config (max_limbs)");
+
+  /* the total size does not exceed max_bytes */
+  mpfr_free_pool ();
+  mpfr_pool_config (1024, 10 * MPFR_BYTES_PER_MP_LIMB);
+  for (i = 0; i < 4; i++)
+    mpfr_mpz_init2 (a[i], 4 * GMP_NUMB_BITS);
+  for (i = 0; i < 4; i++)
+    mpfr_mpz_clear (a[i]);
+  check_stats (0, 8, 8 * MPFR_BYTES_PER_MP_LIMB, "check_config (max_bytes)");
+
+  /* reducing the limits trims the pool */
+  mpfr_pool_config (1024, 5 * MPFR_BYTES_PER_MP_LIMB);
+  check_stats (0, 8, 4 * MPFR_BYTES_PER_MP_LIMB, "check_config (trim)");
+  mpfr_pool_config (2, 1 << 20);
+  check_stats (0, 8, 0, "check_config (trim, max_limbs)");
+
+  mpfr_pool_config (1024, 1 << 20);
+  mpfr_free_pool ();
+}
+
+/* Check that the MPFR functions using mpz_t internally work with any
+   configuration of the pool. */
+static void
+check_functions (void)
+{
+  mpfr_t x, y, z;
+  size_t l[] = { 0, 1, 3, 1024 };
+  int i;
+
+  mpfr_inits2 (2000, x, y, z, (mpfr_ptr) 0);
+  for (i = 0; i < numberof (l); i++)
+    {
+      mpfr_pool_config (l[i], 1 << 20);
+      mpfr_const_pi (x, MPFR_RNDN);
+      mpfr_set_ui (y, 3, MPFR_RNDN);
+      mpfr_sqrt (y, y, MPFR_RNDN);
+      mpfr_gamma (y, y, MPFR_RNDN);
+      if (i > 0 && ! mpfr_equal_p (y, z))
+        {
+          printf ("Error in check_functions for max_limbs=%lu\n",
+                  (unsigned long) l[i]);
+          exit (1);
+        }
+      mpfr_set (z, y, MPFR_RNDN);
+      mpfr_free_cache ();
+    }
+  mpfr_clears (x, y, z, (mpfr_ptr) 0);
+  mpfr_pool_config (1024, 1 << 20);
+}
+
+#endif
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+#if MPFR_POOL_NENTRIES
+  check_reuse ();
+  check_config ();
+  check_functions ();
+#endif
+
+  tests_end_mpfr ();
+  return 0;
+}
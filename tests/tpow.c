@@ -1989,6 +1989,177 @@ check_binary128 (void)
   mpfr_clear (t);
 }
 
+/* check mpfr_pow_ui with large exponents (sliding-window method) against
+   mpfr_pow_z, which uses the binary method */
+static void
+check_pow_ui_window (void)
+{
+  mpfr_t x, y1, y2;
+  mpz_t z;
+  mpfr_prec_t p;
+  unsigned long n;
+  int i, r, inex1, inex2;
+  mpfr_flags_t flags1, flags2;
+
+  mpz_init (z);
+  for (p = MPFR_PREC_MIN; p <= 200; p += 11)
+    {
+      mpfr_inits2 (p, x, y1, y2, (mpfr_ptr) 0);
+      for (i = 0; i < 20; i++)
+        {
+          /* n with at least 16 bits, and x close to 1 so that x^n is
+             usually representable */
+          n = randlimb () | 0x8000;
+          if (i & 1)
+            n = (unsigned long) (n & 0xffffff);
+          mpfr_urandomb (x, RANDS);
+          mpfr_div_2ui (x, x, 10 + (i & 15), MPFR_RNDN);
+          mpfr_add_ui (x, x, 1, MPFR_RNDN);
+          if (i & 2)
+            mpfr_neg (x, x, MPFR_RNDN);
+          mpz_set_ui (z, n);
+          RND_LOOP_NO_RNDF (r)
+            {
+              mpfr_clear_flags ();
+              inex1 = mpfr_pow_ui (y1, x, n, (mpfr_rnd_t) r);
+              flags1 = __gmpfr_flags;
+              mpfr_clear_flags ();
+              inex2 = mpfr_pow_z (y2, x, z, (mpfr_rnd_t) r);
+              flags2 = __gmpfr_flags;
+              if (! SAME_VAL (y1, y2) || ! SAME_SIGN (inex1, inex2) ||
+                  flags1 != flags2)
+                {
+                  printf ("Error in check_pow_ui_window for n = %lu, %s\n",
+                          n, mpfr_print_rnd_mode ((mpfr_rnd_t) r));
+                  printf ("x = ");
+                  mpfr_dump (x);
+                  printf ("got      ");
+                  mpfr_dump (y1);
+                  printf ("expected ");
+                  mpfr_dump (y2);
+                  printf ("inex = %d and %d, flags = %u and %u\n",
+                          inex1, inex2, (unsigned int) flags1,
+                          (unsigned int) flags2);
+                  exit (1);
+                }
+            }
+        }
+      mpfr_clears (x, y1, y2, (mpfr_ptr) 0);
+    }
+  mpz_clear (z);
+}
+
+/* check mpfr_pow with dyadic exponents n/2^k (computed with k square roots
+   for k <= 8) against exp(y*log(x)) computed in a larger precision, and
+   exact cases */
+static void
+check_dyadic (void)
+{
+  mpfr_t x, y, z, t, u;
+  mpfr_prec_t p;
+  mpfr_exp_t e;
+  long n;
+  int i, k, r, inex, inex2;
+
+  mpfr_init2 (y, 32);
+  mpfr_init2 (t, 400);
+
+  /* exact cases: 9^(3/2) = 27, 4^(-3/2) = 1/8, (9/4)^(1/2) = 3/2,
+     16^(3/4) = 8, 256^(-5/8) = 1/32, and 3^44^(3/4) = 3^33, which fits
+     in 53 bits while 3^132 is not exact in the working precision */
+  mpfr_init2 (x, 70);
+  mpfr_init2 (z, 53);
+  mpfr_init2 (u, 53);
+  for (i = 0; i < 6; i++)
+    {
+      static const long xn[] = { 9, 4, 9, 16, 256, 3 };
+      static const long yn[] = { 3, -3, 1, 3, -5, 3 };
+      static const int yk[] = { 1, 1, 1, 2, 3, 2 };
+
+      mpfr_set_ui (x, xn[i], MPFR_RNDN);
+      if (i == 2)
+        mpfr_div_2ui (x, x, 2, MPFR_RNDN);
+      if (i == 5)
+        mpfr_pow_ui (x, x, 44, MPFR_RNDN);
+      mpfr_set_si_2exp (y, yn[i], - yk[i], MPFR_RNDN);
+      switch (i)
+        {
+        case 0: mpfr_set_ui (u, 27, MPFR_RNDN); break;
+        case 1: mpfr_set_ui_2exp (u, 1, -3, MPFR_RNDN); break;
+        case 2: mpfr_set_ui_2exp (u, 3, -1, MPFR_RNDN); break;
+        case 3: mpfr_set_ui (u, 8, MPFR_RNDN); break;
+        case 4: mpfr_set_ui_2exp (u, 1, -5, MPFR_RNDN); break;
+        default: mpfr_ui_pow_ui (u, 3, 33, MPFR_RNDN);
+        }
+      RND_LOOP (r)
+        {
+          mpfr_clear_flags ();
+          inex = mpfr_pow (z, x, y, (mpfr_rnd_t) r);
+          if (! mpfr_equal_p (z, u) || inex != 0 || __gmpfr_flags != 0)
+            {
+              printf ("Error in check_dyadic (exact case %d, %s)\n",
+                      i, mpfr_print_rnd_mode ((mpfr_rnd_t) r));
+              printf ("got ");
+              mpfr_dump (z);
+              printf ("inex = %d, flags = %u\n", inex,
+                      (unsigned int) __gmpfr_flags);
+              exit (1);
+            }
+        }
+    }
+  mpfr_clears (x, z, u, (mpfr_ptr) 0);
+
+  for (p = MPFR_PREC_MIN; p <= 200; p += 7)
+    {
+      mpfr_inits2 (p, x, z, u, (mpfr_ptr) 0);
+      for (i = 0; i < 10; i++)
+        {
+          n = 2 * (long) (randlimb () % (i < 5 ? 10 : 65536)) + 1;
+          if (i & 1)
+            n = -n;
+          /* k = 9 and 10 use the general case */
+          k = 1 + (int) (randlimb () % 10);
+          mpfr_set_si_2exp (y, n, -k, MPFR_RNDN);
+          do
+            mpfr_urandomb (x, RANDS);
+          while (mpfr_zero_p (x));
+          mpfr_set_exp (x, (mpfr_exp_t) (randlimb () % 64) - 32);
+          if (mpfr_cmp_ui (x, 1) == 0)
+            continue;
+          mpfr_log (t, x, MPFR_RNDN);
+          mpfr_mul (t, t, y, MPFR_RNDN);
+          e = mpfr_get_exp (t);
+          mpfr_exp (t, t, MPFR_RNDN);
+          /* same error bound as in mpfr_pow_general */
+          e = e >= -1 ? e + 3 : 1;
+          RND_LOOP_NO_RNDF (r)
+            {
+              if (! mpfr_can_round (t, 400 - e, MPFR_RNDN, MPFR_RNDZ,
+                                    p + (r == MPFR_RNDN)))
+                continue;
+              inex2 = mpfr_set (u, t, (mpfr_rnd_t) r);
+              inex = mpfr_pow (z, x, y, (mpfr_rnd_t) r);
+              if (! mpfr_equal_p (z, u) || ! SAME_SIGN (inex, inex2))
+                {
+                  printf ("Error in check_dyadic for n = %ld, k = %d, %s\n",
+                          n, k, mpfr_print_rnd_mode ((mpfr_rnd_t) r));
+                  printf ("x = ");
+                  mpfr_dump (x);
+                  printf ("got      ");
+                  mpfr_dump (z);
+                  printf ("expected ");
+                  mpfr_dump (u);
+                  printf ("inex = %d and %d\n", inex, inex2);
+                  exit (1);
+                }
+            }
+        }
+      mpfr_clears (x, z, u, (mpfr_ptr) 0);
+    }
+  mpfr_clear (y);
+  mpfr_clear (t);
+}
+
 int
 main (int argc, char **argv)
 {
@@ -2001,7 +2172,9 @@ main (int argc, char **argv)
   special ();
   particular_cases ();
   check_pow_ui ();
+  check_pow_ui_window ();
   check_pow_si ();
+  check_dyadic ();
   check_pown_ieee754_2019 ();
   check_special_pow_si ();
   pow_si_long_min ();
@@ -0,0 +1,188 @@
+/* Test file for mpfr_pow_prepare, mpfr_pow_apply and mpfr_pow_clear.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-test.h"
+
+/* check mpfr_pow_apply (z, b, y) against mpfr_pow (z, x, y), where b is
+   the base x prepared, with an output of precision pz, and also when z
+   is y */
+static void
+check (mpfr_pow_base_ptr b, mpfr_srcptr x, mpfr_srcptr y, mpfr_prec_t pz,
+       mpfr_rnd_t rnd)
+{
+  mpfr_t z1, z2;
+  int i1, i2, k;
+  mpfr_flags_t flags1, flags2;
+
+  mpfr_init2 (z1, pz);
+  mpfr_clear_flags ();
+  i1 = mpfr_pow (z1, x, y, rnd);
+  flags1 = __gmpfr_flags;
+
+  for (k = 0; k < 2; k++)
+    {
+      /* k = 1: z is y */
+      if (k == 1 && pz != MPFR_PREC (y))
+        continue;
+      mpfr_init2 (z2, pz);
+      if (k == 1)
+        mpfr_set (z2, y, MPFR_RNDN);
+      mpfr_clear_flags ();
+      i2 = mpfr_pow_apply (z2, b, k == 1 ? z2 : y, rnd);
+      flags2 = __gmpfr_flags;
+      if (! SAME_VAL (z1, z2) || ! SAME_SIGN (i1, i2) || flags1 != flags2)
+        {
+          printf ("Error in mpfr_pow_apply for %s, k = %d\n",
+                  mpfr_print_rnd_mode (rnd), k);
+          printf ("x = ");
+          mpfr_dump (x);
+          printf ("y = ");
+          mpfr_dump (y);
+          printf ("expected ");
+          mpfr_dump (z1);
+          printf ("with inex = %d, flags =", i1);
+          flags_out (flags1);
+          printf ("got      ");
+          mpfr_dump (z2);
+          printf ("with inex = %d, flags =", i2);
+          flags_out (flags2);
+          exit (1);
+        }
+      mpfr_clear (z2);
+    }
+  mpfr_clear (z1);
+}
+
+/* special values of the base and of the exponent, integer exponents,
+   exact results, and the reduced exponent range */
+static void
+check_special (void)
+{
+  mpfr_pow_base_t b;
+  mpfr_t x, y;
+  mpfr_exp_t emin, emax;
+  int i, j, r;
+
+  mpfr_init2 (x, 17);
+  mpfr_init2 (y, 17);
+  for (i = 0; i < 9; i++)
+    {
+      switch (i)
+        {
+        case 0: mpfr_set_nan (x); break;
+        case 1: mpfr_set_inf (x, 1); break;
+        case 2: mpfr_set_zero (x, -1); break;
+        case 3: mpfr_set_ui (x, 1, MPFR_RNDN); break;
+        case 4: mpfr_set_si (x, -3, MPFR_RNDN); break;
+        case 5: mpfr_set_ui_2exp (x, 1, -5, MPFR_RNDN); break;
+        case 6: mpfr_set_ui (x, 9, MPFR_RNDN); break;
+        case 7: mpfr_set_ui_2exp (x, 1, 100000, MPFR_RNDN);
+          mpfr_nextabove (x); break;
+        default: mpfr_set_ui_2exp (x, 3, -7, MPFR_RNDN); break;
+        }
+      mpfr_pow_prepare (b, x);
+      for (j = 0; j < 9; j++)
+        {
+          switch (j)
+            {
+            case 0: mpfr_set_nan (y); break;
+            case 1: mpfr_set_inf (y, -1); break;
+            case 2: mpfr_set_zero (y, 1); break;
+            case 3: mpfr_set_si (y, -3, MPFR_RNDN); break;
+            case 4: mpfr_set_ui_2exp (y, 3, -1, MPFR_RNDN); break;
+            case 5: mpfr_set_si_2exp (y, -1, -1, MPFR_RNDN); break;
+            case 6: mpfr_set_ui_2exp (y, 1, 20, MPFR_RNDN);
+              mpfr_nextabove (y); break;
+            case 7: mpfr_set_si_2exp (y, -1, -90, MPFR_RNDN); break;
+            default: mpfr_set_ui_2exp (y, 17, -3, MPFR_RNDN); break;
+            }
+          RND_LOOP_NO_RNDF (r)
+            {
+              check (b, x, y, 17, (mpfr_rnd_t) r);
+              check (b, x, y, 53, (mpfr_rnd_t) r);
+            }
+          /* reduced exponent range, where mpfr_pow is used */
+          emin = mpfr_get_emin ();
+          emax = mpfr_get_emax ();
+          set_emin (-100);
+          set_emax (100);
+          if (mpfr_nan_p (x) || mpfr_inf_p (x) || mpfr_zero_p (x) ||
+              (mpfr_get_exp (x) >= -100 && mpfr_get_exp (x) <= 100))
+            check (b, x, y, 17, MPFR_RNDN);
+          set_emin (emin);
+          set_emax (emax);
+        }
+      mpfr_pow_clear (b);
+    }
+  mpfr_clear (x);
+  mpfr_clear (y);
+}
+
+/* the same base with many exponents, and increasing and decreasing
+   output precisions, so that the cached logarithm must be recomputed
+   or can be used in a larger precision */
+static void
+check_random (void)
+{
+  mpfr_pow_base_t b;
+  mpfr_t x, y;
+  mpfr_prec_t px, pz;
+  int i, j, r;
+
+  for (px = MPFR_PREC_MIN; px <= 200; px += 17)
+    {
+      mpfr_init2 (x, px);
+      mpfr_init2 (y, 40);
+      for (i = 0; i < 5; i++)
+        {
+          do
+            mpfr_urandomb (x, RANDS);
+          while (mpfr_zero_p (x));
+          mpfr_mul_2si (x, x, (int) (randlimb () % 20) - 8, MPFR_RNDN);
+          mpfr_pow_prepare (b, x);
+          for (j = 0; j < 20; j++)
+            {
+              mpfr_urandomb (y, RANDS);
+              mpfr_mul_2si (y, y, (int) (randlimb () % 16) - 6, MPFR_RNDN);
+              if (randlimb () & 1)
+                mpfr_neg (y, y, MPFR_RNDN);
+              pz = j < 10 ? MPFR_PREC_MIN + 23 * j : 300 - 23 * (j - 10);
+              RND_LOOP_NO_RNDF (r)
+                check (b, x, y, pz, (mpfr_rnd_t) r);
+            }
+          mpfr_pow_clear (b);
+        }
+      mpfr_clear (x);
+      mpfr_clear (y);
+    }
+}
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+  check_special ();
+  check_random ();
+
+  tests_end_mpfr ();
+  return 0;
+}
@@ -0,0 +1,300 @@
+/* Test file for mpfr_randinit_philox, mpfr_rand_philox_stream and
+   mpfr_rand_philox_skip.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#define _MPFR_NO_DEPRECATED_GRANDOM
+#include "mpfr-test.h"
+
+static void
+check_words (gmp_randstate_t s, const unsigned long *w, int n,
+             const char *msg)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    {
+      unsigned long v = gmp_urandomb_ui (s, 32);
+      if (v != w[i])
+        {
+          printf ("Error in %s for i=%d\n", msg, i);
+          printf ("expected %lx, got %lx\n", w[i], v);
+          exit (1);
+        }
+    }
+}
+
+/* Known-answer tests from the Random123 library (kat_vectors). The second
+   and third ones need a 64-bit unsigned long to set the counter. */
+static void
+check_kat (void)
+{
+  unsigned long w0[4] = { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 };
+  gmp_randstate_t s;
+
+  if (mpfr_randinit_philox (s, 0) != 0)
+    {
+      printf ("Error in check_kat: mpfr_randinit_philox failed\n");
+      exit (1);
+    }
+  check_words (s, w0, 4, "check_kat (0)");
+  /* reseeding resets the position */
+  gmp_urandomb_ui (s, 32);
+  gmp_randseed_ui (s, 0);
+  check_words (s, w0, 4, "check_kat (gmp_randseed_ui)");
+  gmp_randclear (s);
+
+#if ULONG_MAX > 4294967295UL
+  {
+    unsigned long w1[4] =
+      { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd };
+    unsigned long w2[4] =
+      { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 };
+    int i;
+
+    mpfr_randinit_philox (s, ULONG_MAX);
+    mpfr_rand_philox_stream (s, ULONG_MAX);
+    for (i = 0; i < 4; i++)
+      mpfr_rand_philox_skip (s, ULONG_MAX);
+    check_words (s, w1, 4, "check_kat (1)");
+    gmp_randclear (s);
+
+    mpfr_randinit_philox (s, 0x299f31d0a4093822UL);
+    mpfr_rand_philox_stream (s, 0x0370734413198a2eUL);
+    for (i = 0; i < 4; i++)
+      mpfr_rand_philox_skip (s, 0x85a308d3243f6a88UL);
+    check_words (s, w2, 4, "check_kat (2)");
+    gmp_randclear (s);
+  }
+#endif
+}
+
+/* Check that skipping k words gives the same words as reading them, and
+   that gmp_randinit_set copies the position. */
+static void
+check_skip (void)
+{
+  unsigned long w[40];
+  gmp_randstate_t s, t;
+  int i, j, k;
+
+  mpfr_randinit_philox (s, 17);
+  mpfr_rand_philox_stream (s, 42);
+  for (i = 0; i < numberof (w); i++)
+    w[i] = gmp_urandomb_ui (s, 32);
+  gmp_randclear (s);
+
+  for (k = 0; k < 20; k++)
+    for (j = 0; j <= k; j++)
+      {
+        mpfr_randinit_philox (s, 17);
+        mpfr_rand_philox_stream (s, 42);
+        /* read j words, then skip k - j words in two steps */
+        check_words (s, w, j, "check_skip (read)");
+        mpfr_rand_philox_skip (s, (k - j) / 2);
+        mpfr_rand_philox_skip (s, k - j - (k - j) / 2);
+        gmp_randinit_set (t, s);
+        check_words (s, w + k, 20, "check_skip");
+        check_words (t, w + k, 20, "check_skip (gmp_randinit_set)");
+        gmp_randclear (s);
+        gmp_randclear (t);
+      }
+}
+
+/* Check that a request of n bits consumes ceil(n/32) words. */
+static void
+check_bits (void)
+{
+  unsigned long w[8];
+  gmp_randstate_t s;
+  mpz_t z, e;
+  int i;
+
+  mpfr_randinit_philox (s, 1);
+  for (i = 0; i < numberof (w); i++)
+    w[i] = gmp_urandomb_ui (s, 32);
+  gmp_randseed_ui (s, 1);
+
+  MPFR_ASSERTN (gmp_urandomb_ui (s, 5) == (w[0] & 31));
+  MPFR_ASSERTN (gmp_urandomb_ui (s, 32) == w[1]);
+
+  /* 100 bits: words 2 to 5, the last one truncated to 4 bits */
+  mpz_init (z);
+  mpz_init (e);
+  mpz_urandomb (z, s, 100);
+  for (i = 5; i >= 2; i--)
+    {
+      mpz_mul_2exp (e, e, 32);
+      mpz_add_ui (e, e, w[i]);
+    }
+  mpz_fdiv_r_2exp (e, e, 100);
+  if (mpz_cmp (z, e) != 0)
+    {
+      printf ("Error in check_bits\n");
+      exit (1);
+    }
+  MPFR_ASSERTN (gmp_urandomb_ui (s, 32) == w[6]);
+  mpz_clear (z);
+  mpz_clear (e);
+  gmp_randclear (s);
+}
+
+/* Sample i is generated from stream i, so that the results do not depend
+   on the order in which the samples are generated, e.g., by different
+   threads. */
+#define NS 16
+
+static int
+sample (int f, mpfr_ptr x, gmp_randstate_t s, unsigned long i)
+{
+  mpfr_rand_philox_stream (s, i);
+  switch (f)
+    {
+    case 0:
+      return mpfr_urandomb (x, s);
+    case 1:
+      return mpfr_urandom (x, s, MPFR_RNDN);
+    case 2:
+      return mpfr_nrandom (x, s, MPFR_RNDN);
+    case 3:
+      return mpfr_erandom (x, s, MPFR_RNDN);
+    default:
+      return mpfr_grandom (x, NULL, s, MPFR_RNDN);
+    }
+}
+
+static void
+check_parallel (mpfr_prec_t p)
+{
+  gmp_randstate_t s, t[3];
+  mpfr_t x[NS], y[NS];
+  int f, i, k;
+
+  mpfr_randinit_philox (s, 12345);
+  for (k = 0; k < 3; k++)
+    gmp_randinit_set (t[k], s);
+  for (i = 0; i < NS; i++)
+    {
+      mpfr_init2 (x[i], p);
+      mpfr_init2 (y[i], p);
+    }
+
+  for (f = 0; f < 5; f++)
+    {
+      for (i = 0; i < NS; i++)
+        sample (f, x[i], s, i);
+      /* three "threads" taking the samples in reverse order */
+      for (i = NS - 1; i >= 0; i--)
+        sample (f, y[i], t[i % 3], i);
+      for (i = 0; i < NS; i++)
+        if (! mpfr_equal_p (x[i], y[i]) ||
+            (p >= 53 && i > 0 && mpfr_equal_p (x[i], x[i-1])))
+          {
+            printf ("Error in check_parallel for p=%ld, f=%d, i=%d\n",
+                    (long) p, f, i);
+            printf ("x[i]=");
+            mpfr_dump (x[i]);
+            printf ("y[i]=");
+            mpfr_dump (y[i]);
+            exit (1);
+          }
+    }
+
+  for (i = 0; i < NS; i++)
+    {
+      mpfr_clear (x[i]);
+      mpfr_clear (y[i]);
+    }
+  for (k = 0; k < 3; k++)
+    gmp_randclear (t[k]);
+  gmp_randclear (s);
+}
+
+/* mpfr_rand_philox_stream and mpfr_rand_philox_skip must fail on a state
+   that is not a Philox one, without changing it. */
+static void
+check_other_state (void)
+{
+  gmp_randstate_t s, t;
+
+  gmp_randinit_default (s);
+  gmp_randseed_ui (s, 17);
+  gmp_randinit_default (t);
+  gmp_randseed_ui (t, 17);
+  if (mpfr_rand_philox_stream (s, 1) == 0 || mpfr_rand_philox_skip (s, 1) == 0)
+    {
+      printf ("Error: stream and skip should have failed\n");
+      exit (1);
+    }
+  if (gmp_urandomb_ui (s, 32) != gmp_urandomb_ui (t, 32))
+    {
+      printf ("Error: the state has been changed\n");
+      exit (1);
+    }
+  gmp_randclear (s);
+  gmp_randclear (t);
+}
+
+/* Without the generator, mpfr_randinit_philox must return a non-zero
+   value and a usable state. */
+static void
+check_unavailable (void)
+{
+  gmp_randstate_t s;
+  mpfr_t x;
+
+  if (mpfr_randinit_philox (s, 17) == 0)
+    {
+      printf ("Error: mpfr_randinit_philox should have failed\n");
+      exit (1);
+    }
+  if (mpfr_rand_philox_stream (s, 1) == 0 || mpfr_rand_philox_skip (s, 1) == 0)
+    {
+      printf ("Error: stream and skip should have failed\n");
+      exit (1);
+    }
+  mpfr_init2 (x, 53);
+  mpfr_urandomb (x, s);
+  MPFR_ASSERTN (mpfr_cmp_ui (x, 1) < 0);
+  mpfr_clear (x);
+  gmp_randclear (s);
+}
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+  if (mpfr_buildopt_philox_p ())
+    {
+      check_kat ();
+      check_skip ();
+      check_bits ();
+      check_parallel (2);
+      check_parallel (53);
+      check_parallel (1000);
+    }
+  else
+    check_unavailable ();
+  check_other_state ();
+
+  tests_end_mpfr ();
+  return 0;
+}
@@ -138,6 +138,74 @@ bug20100914 (void)
 }
 #endif
 
+#ifndef MPFR_USE_MINI_GMP
+/* Check mpfr_urandomb_vec: as long as n * p <= 8192, the n results are
+   obtained from a single call to mpz_urandomb with max(n * p, 256) bits
+   (see mpfr_rand_buf_get), the i-th result being given by the bits i * p
+   to i * p + p - 1. For p > 1024, the bits are drawn directly from the
+   generator, like with mpfr_urandomb. */
+static void
+test_urandomb_vec (void)
+{
+  mpfr_prec_t p[] = { 2, 17, 53, 64, 65, 100, 128, 1000, 1500 };
+  gmp_randstate_t s1, s2;
+  mpfr_t x[40], y;
+  mpfr_ptr px[40];
+  mpz_t z, c;
+  int i, j, n;
+
+  gmp_randinit_default (s1);
+  gmp_randinit_default (s2);
+  mpz_init (z);
+  mpz_init (c);
+  for (j = 0; j < numberof (p); j++)
+    {
+      n = p[j] > 1024 ? 5 : 8192 / p[j];
+      if (n > numberof (x))
+        n = numberof (x);
+      for (i = 0; i < n; i++)
+        {
+          mpfr_init2 (x[i], p[j]);
+          px[i] = x[i];
+        }
+      mpfr_init2 (y, p[j]);
+      gmp_randseed_ui (s1, 17 + j);
+      gmp_randseed_ui (s2, 17 + j);
+      MPFR_ASSERTN (mpfr_urandomb_vec (px, n, s1) == 0);
+      if (p[j] <= 1024)
+        mpz_urandomb (z, s2, n * p[j] < 256 ? 256 : n * p[j]);
+      for (i = 0; i < n; i++)
+        {
+          if (p[j] <= 1024)
+            {
+              mpz_fdiv_q_2exp (c, z, i * p[j]);
+              mpz_fdiv_r_2exp (c, c, p[j]);
+              mpfr_set_z_2exp (y, c, - p[j], MPFR_RNDN);
+            }
+          else
+            mpfr_urandomb (y, s2);
+          if (MPFR_PREC (x[i]) != p[j] || ! mpfr_equal_p (x[i], y))
+            {
+              printf ("Error in mpfr_urandomb_vec for p=%ld, i=%d\n",
+                      (long) p[j], i);
+              printf ("Expected ");
+              mpfr_dump (y);
+              printf ("Got      ");
+              mpfr_dump (x[i]);
+              exit (1);
+            }
+        }
+      for (i = 0; i < n; i++)
+        mpfr_clear (x[i]);
+      mpfr_clear (y);
+    }
+  mpz_clear (z);
+  mpz_clear (c);
+  gmp_randclear (s1);
+  gmp_randclear (s2);
+}
+#endif
+
 int
 main (int argc, char *argv[])
 {
@@ -176,6 +244,7 @@ main (int argc, char *argv[])
      is not implemented in mini-gmp, we omit them with mini-gmp. */
 
   bug20100914 ();
+  test_urandomb_vec ();
 
 #if __MPFR_GMP(4,2,0)
   /* Get a non-zero fixed-point number whose first 32 bits are 0 with the
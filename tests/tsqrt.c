@@ -925,6 +925,83 @@ coverage (void)
 #define TEST_RANDOM_POS 8
 #include "tgeneric.c"
 
+/* check the special code for 2*GMP_NUMB_BITS < p <= 3*GMP_NUMB_BITS
+   against the generic code (used when the precisions differ), also near
+   the underflow and overflow thresholds */
+static void
+check_sqrt3 (void)
+{
+  mpfr_t r1, r2, u, u2;
+  mpfr_exp_t emin, emax, e = 0;
+  mpfr_flags_t f1, f2;
+  mpfr_prec_t p;
+  int i, j, k, r, inex1, inex2;
+
+  emin = mpfr_get_emin ();
+  emax = mpfr_get_emax ();
+  for (p = 2 * GMP_NUMB_BITS + 1; p <= 3 * GMP_NUMB_BITS; p++)
+    {
+      mpfr_inits2 (p, r1, r2, u, (mpfr_ptr) 0);
+      mpfr_init2 (u2, p + 1);
+      for (i = 0; i < 20; i++)
+        {
+          mpfr_set_ui (u, 1, MPFR_RNDN);
+          /* limbs either random, or 0, or 111...111 */
+          for (j = 0; j < MPFR_LIMB_SIZE (u); j++)
+            MPFR_MANT(u)[j] = RAND_BOOL () ? randlimb () :
+              RAND_BOOL () ? MPFR_LIMB_ZERO : MPFR_LIMB_MAX;
+          MPFR_MANT(u)[MPFR_LIMB_SIZE (u) - 1] |= MPFR_LIMB_HIGHBIT;
+          MPFR_MANT(u)[0] &= ~MPFR_LIMB_MASK (MPFR_LIMB_SIZE (u) *
+                                             GMP_NUMB_BITS - MPFR_PREC (u));
+          if (i % 4 == 0)
+            mpfr_set_ui (u, 1, MPFR_RNDN);
+          else if (i % 4 == 1)
+            {
+              mpfr_set_ui (u, 1, MPFR_RNDN);
+              mpfr_nextbelow (u);
+            }
+          mpfr_set_exp (u, (mpfr_exp_t) (randlimb () % 16) - 8);
+          mpfr_set (u2, u, MPFR_RNDN);
+          RND_LOOP_NO_RNDF (r)
+            for (k = 0; k < 5; k++)
+              {
+                if (k == 1 || k == 2)
+                  set_emin (e + k - 1);
+                else if (k == 3 || k == 4)
+                  set_emax (e + 3 - k);
+                mpfr_clear_flags ();
+                inex1 = mpfr_sqrt (r1, u, (mpfr_rnd_t) r);
+                f1 = __gmpfr_flags;
+                mpfr_clear_flags ();
+                inex2 = mpfr_sqrt (r2, u2, (mpfr_rnd_t) r);
+                f2 = __gmpfr_flags;
+                set_emin (emin);
+                set_emax (emax);
+                if (k == 0)
+                  e = mpfr_get_exp (r1);
+                if (! mpfr_equal_p (r1, r2) || ! SAME_SIGN (inex1, inex2) ||
+                    f1 != f2)
+                  {
+                    printf ("Error in check_sqrt3 for p=%ld, %s, k=%d\n",
+                            (long) p, mpfr_print_rnd_mode ((mpfr_rnd_t) r),
+                            k);
+                    printf ("u = ");
+                    mpfr_dump (u);
+                    printf ("got      ");
+                    mpfr_dump (r1);
+                    printf ("expected ");
+                    mpfr_dump (r2);
+                    printf ("inex = %d and %d, flags = %u and %u\n",
+                            inex1, inex2, (unsigned int) f1,
+                            (unsigned int) f2);
+                    exit (1);
+                  }
+              }
+        }
+      mpfr_clears (r1, r2, u, u2, (mpfr_ptr) 0);
+    }
+}
+
 int
 main (void)
 {
@@ -1063,6 +1140,7 @@ main (void)
   bug20160120 ();
   bug20160908 ();
   test_sqrt1n ();
+  check_sqrt3 ();
 
   tests_end_mpfr ();
   return 0;
@@ -0,0 +1,217 @@
+/* Test file for the arena of temporary memory blocks.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-test.h"
+
+#ifndef MPFR_HAVE_GMP_IMPL
+
+/* size of the blocks, larger than MPFR_ALLOCA_MAX so that they are not
+   allocated on the stack */
+#define BLOCK (MPFR_ALLOCA_MAX + 1000)
+
+static void
+check_stats (size_t h, size_t r, unsigned long f, const char *msg)
+{
+  size_t high, reserved;
+  unsigned long fallbacks;
+
+  mpfr_tmp_arena_stats (&high, &reserved, &fallbacks);
+  if (high != h || (r != (size_t) -1 && reserved != r) || fallbacks != f)
+    {
+      printf ("Error in %s\n", msg);
+      printf ("expected high=%lu reserved=%lu fallbacks=%lu\n",
+              (unsigned long) h, (unsigned long) r, f);
+      printf ("got      high=%lu reserved=%lu fallbacks=%lu\n",
+              (unsigned long) high, (unsigned long) reserved, fallbacks);
+      exit (1);
+    }
+}
+
+/* Fill a block of n bytes with c, so that an overlap between blocks
+   can be detected (and with valgrind, an invalid access). */
+static void
+fill (unsigned char *p, size_t n, int c)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    p[i] = c;
+}
+
+static void
+check (unsigned char *p, size_t n, int c, const char *msg)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    if (p[i] != c)
+      {
+        printf ("Error in %s: overwritten block\n", msg);
+        exit (1);
+      }
+}
+
+/* Allocate k blocks of n bytes in a new TMP scope, then recurse. */
+static void
+nested (int depth, int k, size_t n, size_t *high)
+{
+  unsigned char *p[4];
+  size_t h;
+  int i;
+  MPFR_TMP_DECL (marker);
+
+  MPFR_ASSERTN (k <= numberof (p));
+  MPFR_TMP_MARK (marker);
+  for (i = 0; i < k; i++)
+    {
+      p[i] = (unsigned char *) MPFR_TMP_ALLOC (n);
+      fill (p[i], n, depth * k + i);
+    }
+  mpfr_tmp_arena_stats (&h, NULL, NULL);
+  if (h > *high)
+    *high = h;
+  if (depth > 0)
+    nested (depth - 1, k, n, high);
+  for (i = 0; i < k; i++)
+    check (p[i], n, depth * k + i, "nested");
+  MPFR_TMP_FREE (marker);
+}
+
+/* Check that the blocks are taken from the arena and that the memory is
+   reused after MPFR_TMP_FREE. */
+static void
+check_reuse (void)
+{
+  size_t high, high2, reserved;
+  int i;
+
+  mpfr_tmp_arena_config (1 << 20);
+  mpfr_free_cache ();
+  mpfr_tmp_arena_stats_reset ();
+  check_stats (0, 0, 0, "check_reuse (initial)");
+
+  high = 0;
+  nested (3, 2, BLOCK, &high);
+  mpfr_tmp_arena_stats (&high2, &reserved, NULL);
+  MPFR_ASSERTN (high2 == high);
+  MPFR_ASSERTN (high >= 8 * BLOCK);
+  MPFR_ASSERTN (reserved >= high);
+  check_stats (high, reserved, 0, "check_reuse (nested)");
+
+  /* the same allocations do not need more memory */
+  for (i = 0; i < 10; i++)
+    {
+      high2 = 0;
+      nested (3, 2, BLOCK, &high2);
+      MPFR_ASSERTN (high2 == high);
+    }
+  check_stats (high, reserved, 0, "check_reuse (again)");
+
+  /* the reset sets the high-water mark to the current usage */
+  mpfr_tmp_arena_stats_reset ();
+  check_stats (0, reserved, 0, "check_reuse (reset)");
+
+  mpfr_free_cache ();
+  check_stats (0, 0, 0, "check_reuse (mpfr_free_cache)");
+}
+
+/* Check the limit set by mpfr_tmp_arena_config. */
+static void
+check_config (void)
+{
+  size_t high = 0;
+
+  mpfr_free_cache ();
+  mpfr_tmp_arena_stats_reset ();
+
+  /* disabled arena: all the blocks are allocated by the allocation
+     function */
+  mpfr_tmp_arena_config (0);
+  nested (1, 3, BLOCK, &high);
+  check_stats (0, 0, 6, "check_config (disabled)");
+
+  /* only 2 blocks fit in the arena */
+  mpfr_tmp_arena_stats_reset ();
+  mpfr_tmp_arena_config (2 * BLOCK + 1000);
+  nested (1, 3, BLOCK, &high);
+  check_stats (high, 2 * BLOCK + 1000, 4, "check_config (limit)");
+
+  /* a block larger than the limit */
+  mpfr_tmp_arena_stats_reset ();
+  nested (0, 1, 3 * BLOCK, &high);
+  check_stats (0, (size_t) -1, 1, "check_config (large block)");
+
+  mpfr_tmp_arena_config (1 << 20);
+  mpfr_free_cache ();
+}
+
+/* Check that the MPFR functions work with any configuration of the arena,
+   at a precision where they use temporary blocks. */
+static void
+check_functions (void)
+{
+  mpfr_t x, y, z;
+  size_t l[] = { 0, 100000, 1 << 20 };
+  size_t high;
+  int i;
+
+  mpfr_inits2 (200000, x, y, z, (mpfr_ptr) 0);
+  for (i = 0; i < numberof (l); i++)
+    {
+      mpfr_tmp_arena_config (l[i]);
+      mpfr_tmp_arena_stats_reset ();
+      mpfr_set_ui (x, 3, MPFR_RNDN);
+      mpfr_sqrt (x, x, MPFR_RNDN);
+      mpfr_mul (y, x, x, MPFR_RNDN);
+      mpfr_div (y, y, x, MPFR_RNDN);
+      mpfr_exp (y, y, MPFR_RNDN);
+      if (i > 0 && ! mpfr_equal_p (y, z))
+        {
+          printf ("Error in check_functions for max_bytes=%lu\n",
+                  (unsigned long) l[i]);
+          exit (1);
+        }
+      mpfr_set (z, y, MPFR_RNDN);
+      mpfr_tmp_arena_stats (&high, NULL, NULL);
+      MPFR_ASSERTN (high <= l[i]);
+      MPFR_ASSERTN (l[i] == 0 || high > 0);
+      mpfr_free_cache ();
+    }
+  mpfr_clears (x, y, z, (mpfr_ptr) 0);
+  mpfr_tmp_arena_config (1 << 20);
+}
+
+#endif
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+#ifndef MPFR_HAVE_GMP_IMPL
+  check_reuse ();
+  check_config ();
+  check_functions ();
+#endif
+
+  tests_end_mpfr ();
+  return 0;
+}
@@ -0,0 +1,216 @@
+/* Test file for the tuning profiles.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-test.h"
+
+static void
+check_names (void)
+{
+  const char *name;
+
+  name = mpfr_get_tune_profile ();
+  MPFR_ASSERTN (name != NULL);
+
+  if (mpfr_set_tune_profile ("default") != 0 ||
+      strcmp (mpfr_get_tune_profile (), "default") != 0)
+    {
+      printf ("Error, cannot select the default profile\n");
+      exit (1);
+    }
+
+  if (mpfr_set_tune_profile ("no such profile") == 0 ||
+      strcmp (mpfr_get_tune_profile (), "default") != 0)
+    {
+      printf ("Error, unknown profile\n");
+      exit (1);
+    }
+
+  /* automatic selection */
+  if (mpfr_set_tune_profile (NULL) != 0 ||
+      strcmp (mpfr_get_tune_profile (), name) != 0)
+    {
+      printf ("Error in automatic selection: got %s instead of %s\n",
+              mpfr_get_tune_profile (), name);
+      exit (1);
+    }
+}
+
+#if defined(MPFR_USE_TUNE_PROFILES) && \
+  (defined (__x86_64__) || defined (__amd64__) || defined (_M_X64))
+
+static int
+cpuid_emeraldrapids (char *vendor, int *family, int *model)
+{
+  strcpy (vendor, "GenuineIntel");
+  *family = 6;
+  *model = 207;
+  return 1;
+}
+
+static int
+cpuid_unknown (char *vendor, int *family, int *model)
+{
+  strcpy (vendor, "GenuineIntel");
+  *family = 6;
+  *model = 1;
+  return 1;
+}
+
+static int
+cpuid_none (char *vendor, int *family, int *model)
+{
+  return 0;
+}
+
+static void
+check_auto (int (*cpuid) (char *, int *, int *), const char *name)
+{
+  const mpfr_tune_param_t *param;
+
+  mpfr_set_tune_profile (name);
+  param = __gmpfr_tune_param;
+  mpfr_set_tune_profile ("generic");
+  __gmpfr_tune_cpuid = cpuid;
+  if (mpfr_set_tune_profile (NULL) != 0 ||
+      strcmp (mpfr_get_tune_profile (), name) != 0 ||
+      __gmpfr_tune_param != param)
+    {
+      printf ("Error in automatic selection: got %s instead of %s\n",
+              mpfr_get_tune_profile (), name);
+      exit (1);
+    }
+}
+
+/* Check the automatic selection from the CPUID information, simulating
+   several processors. */
+static void
+check_cpuid (void)
+{
+  int (*cpuid) (char *, int *, int *) = __gmpfr_tune_cpuid;
+
+  /* the environment variable has precedence over CPUID */
+  if (getenv ("MPFR_TUNE_PROFILE") != NULL)
+    return;
+
+  /* the "emeraldrapids" profile is only selected by its name */
+  check_auto (cpuid_emeraldrapids, "default");
+  check_auto (cpuid_unknown, "default");
+  check_auto (cpuid_none, "default");
+
+  __gmpfr_tune_cpuid = cpuid;
+  mpfr_set_tune_profile (NULL);
+}
+
+#else
+
+static void
+check_cpuid (void)
+{
+}
+
+#endif
+
+#define N 8
+
+/* Compute functions whose algorithm depends on the thresholds, at
+   precisions between the thresholds of the different profiles. */
+static void
+compute (mpfr_t *z, mpfr_t *y)
+{
+  mpfr_t x;
+
+  mpfr_init2 (x, 22000);
+  mpfr_const_pi (x, MPFR_RNDN);
+  mpfr_sqrt (x, x, MPFR_RNDN);
+  mpfr_set_prec (z[0], 19 * GMP_NUMB_BITS + 1);
+  mpfr_mul (z[0], x, y[0], MPFR_RNDN);
+  mpfr_set_prec (z[1], 12 * GMP_NUMB_BITS);
+  mpfr_sqr (z[1], y[1], MPFR_RNDN);
+  mpfr_set_prec (z[2], 10 * GMP_NUMB_BITS);
+  mpfr_div (z[2], y[2], x, MPFR_RNDN);
+  mpfr_set_prec (z[3], 30 * GMP_NUMB_BITS);
+  mpfr_mul (z[3], y[0], y[3], MPFR_RNDN);
+  mpfr_set_prec (z[4], 30 * GMP_NUMB_BITS);
+  mpfr_sqr (z[4], y[3], MPFR_RNDN);
+  mpfr_set_prec (z[5], 22000);
+  mpfr_exp (z[5], x, MPFR_RNDN);
+  mpfr_set_prec (z[6], 20000);
+  mpfr_set_prec (z[7], 20000);
+  mpfr_sin_cos (z[6], z[7], x, MPFR_RNDN);
+  mpfr_clear (x);
+}
+
+/* Check that all the profiles give the same results. */
+static void
+check_profiles (void)
+{
+  const char *names[] = { "default", "generic", "emeraldrapids" };
+  mpfr_t z0[N], z[N], y[4];
+  int i, j;
+
+  for (i = 0; i < N; i++)
+    {
+      mpfr_init2 (z0[i], MPFR_PREC_MIN);
+      mpfr_init2 (z[i], MPFR_PREC_MIN);
+    }
+  for (i = 0; i < 4; i++)
+    {
+      mpfr_init2 (y[i], 40 * GMP_NUMB_BITS);
+      mpfr_urandomb (y[i], RANDS);
+    }
+
+  mpfr_set_tune_profile ("default");
+  compute (z0, y);
+  for (j = 1; j < numberof (names); j++)
+    {
+      if (mpfr_set_tune_profile (names[j]) != 0)
+        continue;
+      compute (z, y);
+      for (i = 0; i < N; i++)
+        if (! mpfr_equal_p (z[i], z0[i]))
+          {
+            printf ("Error for profile %s, result %d\n", names[j], i);
+            exit (1);
+          }
+    }
+
+  for (i = 0; i < N; i++)
+    {
+      mpfr_clear (z0[i]);
+      mpfr_clear (z[i]);
+    }
+  for (i = 0; i < 4; i++)
+    mpfr_clear (y[i]);
+  mpfr_set_tune_profile (NULL);
+}
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+  check_names ();
+  check_cpuid ();
+  check_profiles ();
+
+  tests_end_mpfr ();
+  return 0;
+}
@@ -596,6 +596,65 @@ reprod_abi (void)
 #endif
 }
 
+/* Check that mpfr_urandom_vec gives numbers in [0,1] with the correct
+   ternary values, and that the results are reproducible. */
+static void
+test_urandom_vec (void)
+{
+  mpfr_prec_t p[] = { 1, 2, 53, 100, 1000, 2000 };
+  gmp_randstate_t s1, s2;
+  mpfr_t x[20], y[20];
+  mpfr_ptr px[20], py[20];
+  int inex[20], j, r;
+  unsigned long i, n = numberof (x);
+
+  gmp_randinit_default (s1);
+  gmp_randinit_default (s2);
+  for (j = 0; j < numberof (p); j++)
+    RND_LOOP_NO_RNDF (r)
+      {
+        for (i = 0; i < n; i++)
+          {
+            mpfr_init2 (x[i], p[j]);
+            mpfr_init2 (y[i], p[j]);
+            px[i] = x[i];
+            py[i] = y[i];
+          }
+        gmp_randseed_ui (s1, 17 + j);
+        gmp_randseed_ui (s2, 17 + j);
+        MPFR_ASSERTN (mpfr_urandom_vec (px, inex, n, s1, (mpfr_rnd_t) r)
+                      != 0);
+        MPFR_ASSERTN (mpfr_urandom_vec (py, NULL, n, s2, (mpfr_rnd_t) r)
+                      != 0);
+        for (i = 0; i < n; i++)
+          {
+            if (! mpfr_equal_p (x[i], y[i]) || MPFR_PREC (x[i]) != p[j] ||
+                mpfr_cmp_ui (x[i], 1) > 0 || mpfr_sgn (x[i]) <= 0 ||
+                inex[i] == 0 ||
+                (r == MPFR_RNDD || r == MPFR_RNDZ ? inex[i] > 0 :
+                 r == MPFR_RNDU || r == MPFR_RNDA ? inex[i] < 0 : 0))
+              {
+                printf ("Error in mpfr_urandom_vec for p=%ld, %s, i=%lu\n",
+                        (long) p[j], mpfr_print_rnd_mode ((mpfr_rnd_t) r),
+                        i);
+                printf ("x=");
+                mpfr_dump (x[i]);
+                printf ("y=");
+                mpfr_dump (y[i]);
+                printf ("inex=%d\n", inex[i]);
+                exit (1);
+              }
+          }
+        for (i = 0; i < n; i++)
+          {
+            mpfr_clear (x[i]);
+            mpfr_clear (y[i]);
+          }
+      }
+  gmp_randclear (s1);
+  gmp_randclear (s2);
+}
+
 #endif
 
 int
@@ -659,6 +718,7 @@ main (int argc, char *argv[])
   bug20170123 ();
   reprod_rnd_exp ();
   reprod_abi ();
+  test_urandom_vec ();
 #endif
 
   test_underflow (verbose);
@@ -239,6 +239,75 @@ intermediate_overflow (void)
   mpfr_clears (x, y1, y2, (mpfr_ptr) 0);
 }
 
+/* Check that mpfr_zeta_vec gives the same results as mpfr_zeta, with
+   points of both signs (so that both the direct and the reflection
+   branches share the same cache) and a few special values. */
+static void
+test_vec (void)
+{
+  mpfr_t x[12], y[12], z;
+  mpfr_ptr px[12], py[12];
+  int inex[12], inex2, i, n = numberof (x), r;
+  mpfr_prec_t prec;
+
+  for (prec = MPFR_PREC_MIN; prec <= 200; prec += 13)
+    RND_LOOP_NO_RNDF (r)
+      {
+        mpfr_init2 (z, prec);
+        for (i = 0; i < n; i++)
+          {
+            mpfr_init2 (x[i], 53);
+            mpfr_init2 (y[i], prec);
+            px[i] = x[i];
+            py[i] = y[i];
+            if (i < n - 3)
+              {
+                mpfr_urandomb (x[i], RANDS);
+                mpfr_mul_si (x[i], x[i], 40 * (i & 1) - 20, MPFR_RNDN);
+                mpfr_add_ui (x[i], x[i], i, MPFR_RNDN);
+              }
+          }
+        mpfr_set_ui (x[n-3], 1, MPFR_RNDN);
+        mpfr_set_si (x[n-2], -4, MPFR_RNDN);
+        mpfr_set_nan (x[n-1]);
+
+        mpfr_zeta_vec (py, inex, px, n, (mpfr_rnd_t) r);
+        for (i = 0; i < n; i++)
+          {
+            inex2 = mpfr_zeta (z, x[i], (mpfr_rnd_t) r);
+            if (! mpfr_equal_p (y[i], z) && ! (mpfr_nan_p (y[i]) &&
+                                               mpfr_nan_p (z)))
+              {
+                printf ("Error in mpfr_zeta_vec for prec = %lu, %s\nx = ",
+                        (unsigned long) prec,
+                        mpfr_print_rnd_mode ((mpfr_rnd_t) r));
+                mpfr_dump (x[i]);
+                printf ("expected ");
+                mpfr_dump (z);
+                printf ("got      ");
+                mpfr_dump (y[i]);
+                exit (1);
+              }
+            if (! SAME_SIGN (inex[i], inex2))
+              {
+                printf ("Wrong ternary value in mpfr_zeta_vec for x = ");
+                mpfr_dump (x[i]);
+                printf ("expected %d, got %d\n", inex2, inex[i]);
+                exit (1);
+              }
+          }
+        for (i = 0; i < n; i++)
+          {
+            mpfr_clear (x[i]);
+            mpfr_clear (y[i]);
+          }
+        mpfr_clear (z);
+      }
+
+  /* n = 0 and null inex */
+  MPFR_ASSERTN (mpfr_zeta_vec (py, NULL, px, 0, MPFR_RNDN) == 0);
+}
+
 #define TEST_FUNCTION mpfr_zeta
 #define TEST_RANDOM_EMIN (-48)
 #define TEST_RANDOM_EMAX 31
@@ -494,6 +563,7 @@ main (int argc, char *argv[])
      the input. */
   test_generic (MPFR_PREC_MIN, 70, 1);
   test2 ();
+  test_vec ();
 
   intermediate_overflow ();
 
@@ -23,6 +23,60 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #define TEST_FUNCTION mpfr_zeta_ui
 
+/* Check that mpfr_zeta_ui_range gives the same results as mpfr_zeta_ui,
+   with outputs of different precisions. */
+static void
+test_range (void)
+{
+  mpfr_t y[40], z;
+  mpfr_ptr py[40];
+  int inex[40], inex2, r;
+  unsigned long i, m, n = numberof (y);
+  mpfr_prec_t prec;
+  mpfr_flags_t flags;
+
+  for (prec = MPFR_PREC_MIN; prec <= 300; prec += 17)
+    for (m = 0; m < 4; m++)
+      RND_LOOP_NO_RNDF (r)
+        {
+          mpfr_init2 (z, prec + 7);
+          for (i = 0; i < n; i++)
+            {
+              mpfr_init2 (y[i], prec + (i % 8));
+              py[i] = y[i];
+            }
+          mpfr_clear_flags ();
+          mpfr_zeta_ui_range (py, inex, m, n, (mpfr_rnd_t) r);
+          flags = __gmpfr_flags;
+          for (i = 0; i < n; i++)
+            {
+              mpfr_set_prec (z, mpfr_get_prec (y[i]));
+              inex2 = mpfr_zeta_ui (z, m + i, (mpfr_rnd_t) r);
+              if (! mpfr_equal_p (y[i], z) || ! SAME_SIGN (inex[i], inex2))
+                {
+                  printf ("Error in mpfr_zeta_ui_range for n = %lu, "
+                          "prec = %lu, %s\n", m + i,
+                          (unsigned long) mpfr_get_prec (z),
+                          mpfr_print_rnd_mode ((mpfr_rnd_t) r));
+                  printf ("expected ");
+                  mpfr_dump (z);
+                  printf ("  with inex = %d\n", inex2);
+                  printf ("got      ");
+                  mpfr_dump (y[i]);
+                  printf ("  with inex = %d\n", inex[i]);
+                  exit (1);
+                }
+            }
+          MPFR_ASSERTN ((flags & MPFR_FLAGS_DIVBY0) == (m <= 1 ?
+                                                       MPFR_FLAGS_DIVBY0 : 0));
+          for (i = 0; i < n; i++)
+            mpfr_clear (y[i]);
+          mpfr_clear (z);
+        }
+
+  MPFR_ASSERTN (mpfr_zeta_ui_range (py, NULL, 2, 0, MPFR_RNDN) == 0);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -193,6 +247,8 @@ main (int argc, char *argv[])
           }
     }
 
+  test_range ();
+
  clear_and_exit:
   mpfr_clear (x);
   mpfr_clear (y);
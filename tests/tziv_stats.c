@@ -0,0 +1,133 @@
+/* Test file for mpfr_ziv_stats and mpfr_ziv_stats_reset.
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "mpfr-test.h"
+
+/* Return the index of the function f in the statistics, or -1. */
+static long
+find (const char *f, unsigned long *loops, unsigned long *iterations)
+{
+  const char *name[256];
+  unsigned long l[256], it[256];
+  size_t n, i;
+
+  n = mpfr_ziv_stats (name, l, it, numberof (name));
+  for (i = 0; i < n && i < numberof (name); i++)
+    if (strcmp (name[i], f) == 0)
+      {
+        *loops = l[i];
+        *iterations = it[i];
+        return i;
+      }
+  return -1;
+}
+
+static void
+check (void)
+{
+  mpfr_t x, y;
+  unsigned long loops, iterations;
+  size_t n;
+  int i;
+
+  /* in precision up to 2 limbs, mpfr_sin may use fixed-point code
+     without a Ziv loop */
+  mpfr_init2 (x, 53);
+  mpfr_init2 (y, 2 * GMP_NUMB_BITS + 53);
+  mpfr_set_ui (x, 1, MPFR_RNDN);
+
+  mpfr_ziv_stats_reset ();
+  if (mpfr_ziv_stats (NULL, NULL, NULL, 0) != 0)
+    {
+      printf ("Error, non-empty statistics after reset (1)\n");
+      exit (1);
+    }
+
+  /* nothing is counted while the performance counters are disabled */
+  mpfr_perf_enable (0);
+  mpfr_sin (y, x, MPFR_RNDN);
+  if (mpfr_ziv_stats (NULL, NULL, NULL, 0) != 0)
+    {
+      printf ("Error, statistics collected while disabled\n");
+      exit (1);
+    }
+
+  mpfr_perf_enable (1);
+  for (i = 0; i < 10; i++)
+    mpfr_sin (y, x, MPFR_RNDN);
+  if (find ("mpfr_sin", &loops, &iterations) < 0)
+    {
+      printf ("Error, mpfr_sin not found\n");
+      exit (1);
+    }
+  if (loops != 10 || iterations < loops)
+    {
+      printf ("Error, wrong statistics for mpfr_sin: loops=%lu,"
+              " iterations=%lu\n", loops, iterations);
+      exit (1);
+    }
+
+  /* the number of entries does not depend on the size of the arrays */
+  n = mpfr_ziv_stats (NULL, NULL, NULL, 0);
+  if (n == 0 || mpfr_ziv_stats (NULL, &loops, NULL, 1) != n)
+    {
+      printf ("Error, wrong number of entries\n");
+      exit (1);
+    }
+
+  /* the precision of log(2) increases in the loop, but only the first
+     computation at a given precision enters the Ziv loop (cache) */
+  mpfr_free_cache ();
+  mpfr_ziv_stats_reset ();
+  for (i = 0; i < 10; i++)
+    {
+      mpfr_set_prec (y, 100 + 100 * (i / 2));
+      mpfr_const_log2 (y, MPFR_RNDN);
+    }
+  if (find ("mpfr_const_log2_internal", &loops, &iterations) < 0 ||
+      loops != 5 || iterations < loops)
+    {
+      printf ("Error, wrong statistics for mpfr_const_log2_internal\n");
+      exit (1);
+    }
+
+  mpfr_ziv_stats_reset ();
+  if (mpfr_ziv_stats (NULL, NULL, NULL, 0) != 0)
+    {
+      printf ("Error, non-empty statistics after reset (2)\n");
+      exit (1);
+    }
+  mpfr_perf_enable (0);
+
+  mpfr_clear (x);
+  mpfr_clear (y);
+}
+
+int
+main (void)
+{
+  tests_start_mpfr ();
+
+  check ();
+
+  tests_end_mpfr ();
+  return 0;
+}
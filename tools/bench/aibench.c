@@ -0,0 +1,119 @@
+/* aibench.c -- timings of mpfr_ai as a function of |x| and of the precision
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+/* Usage: aibench [maxtime]
+   For each value of x in +/-{1, 10, 100, 1000, 10000} and each precision
+   in the list below, print the average time in microseconds of a call to
+   mpfr_ai. The first call for a given precision is not taken into account,
+   so that the constants (Pi, ...) are already in the cache. A call taking
+   more than maxtime seconds (default 10) is not repeated. */
+
+#include <stdlib.h>
+#include <stdio.h>
+#ifdef HAVE_GETRUSAGE
+#include <sys/time.h>
+#include <sys/resource.h>
+#else
+#include <time.h>
+#endif
+#include "mpfr.h"
+
+/* get the time in microseconds */
+static unsigned long
+get_cputime (void)
+{
+#ifdef HAVE_GETRUSAGE
+  struct rusage ru;
+
+  getrusage (RUSAGE_SELF, &ru);
+  return ru.ru_utime.tv_sec * 1000000 + ru.ru_utime.tv_usec
+       + ru.ru_stime.tv_sec * 1000000 + ru.ru_stime.tv_usec;
+#else
+  return (unsigned long) ((double) clock () / ((double) CLOCKS_PER_SEC / 1e6));
+#endif
+}
+
+static const long arrayx[] = { 1, 10, 100, 1000, 10000 };
+
+static const mpfr_prec_t arrayprec[] = { 53, 113, 256, 1024, 4096 };
+
+#define NX (sizeof (arrayx) / sizeof (arrayx[0]))
+#define NPREC (sizeof (arrayprec) / sizeof (arrayprec[0]))
+
+/* average time in microseconds of mpfr_ai(y, x) */
+static double
+time_ai (mpfr_ptr y, mpfr_srcptr x, unsigned long maxtime)
+{
+  unsigned long n, t0, t;
+
+  mpfr_ai (y, x, MPFR_RNDN);
+  for (n = 1; ; n *= 2)
+    {
+      unsigned long i;
+
+      t0 = get_cputime ();
+      for (i = 0; i < n; i++)
+        mpfr_ai (y, x, MPFR_RNDN);
+      t = get_cputime () - t0;
+      if (t >= 250000 || t >= maxtime)
+        break;
+    }
+  return (double) t / (double) n;
+}
+
+int
+main (int argc, char *argv[])
+{
+  mpfr_t x, y;
+  unsigned long maxtime = 10000000;
+  unsigned int i, j;
+  int sign;
+
+  if (argc > 1)
+    maxtime = strtoul (argv[1], NULL, 10) * 1000000;
+
+  printf ("Timings of mpfr_ai in microseconds, MPFR %s, GMP %s\n",
+          mpfr_get_version (), gmp_version);
+  printf ("%8s", "x");
+  for (j = 0; j < NPREC; j++)
+    printf (" %12ld", (long) arrayprec[j]);
+  printf ("\n");
+
+  mpfr_init2 (x, 64);
+  for (sign = 1; sign >= -1; sign -= 2)
+    for (i = 0; i < NX; i++)
+      {
+        mpfr_set_si (x, sign * arrayx[i], MPFR_RNDN);
+        printf ("%8ld", sign * arrayx[i]);
+        for (j = 0; j < NPREC; j++)
+          {
+            mpfr_init2 (y, arrayprec[j]);
+            printf (" %12.2f", time_ai (y, x, maxtime));
+            fflush (stdout);
+            mpfr_clear (y);
+          }
+        printf ("\n");
+      }
+  mpfr_clear (x);
+
+  mpfr_free_cache ();
+  return 0;
+}
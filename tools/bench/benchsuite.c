@@ -0,0 +1,883 @@
+/* benchsuite.c -- timings of MPFR functions, with comparison to a baseline
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+/* Usage: benchsuite [options]
+   For each function of the table below (arithmetic, special functions and
+   conversions), each precision and each magnitude of the arguments (the
+   arguments are random numbers in [2^(e-1),2^e) for the given exponents
+   e), print the mean time of a call in nanoseconds, with a 95% confidence
+   interval obtained from several samples.
+
+   -f text|csv|json   output format (text by default)
+   -o file            write the results to this file instead of stdout
+   -b file            compare with a baseline (the CSV output of a
+                      previous run) and report the regressions
+   -t tol             tolerance of the comparison in percent (5 by default)
+   -p p1,p2,...       precisions (from 53 to 10^6 by default)
+   -e e1,e2,...       exponents of the arguments (-10,1,10 by default)
+   -g group           only the functions of this group (arith, special
+                      or conv)
+   -F f1,f2,...       only these functions
+   -s n               number of samples (5 by default)
+   -m ms              minimum time of a sample (10 ms by default)
+   -M ms              maximum time of a call: the precisions for which a
+                      call would take longer (assuming a quadratic cost)
+                      are skipped (1000 ms by default)
+
+   The time of a call is the CPU time of a loop over 8 arguments, divided
+   by the number of calls; the number of calls of a sample is doubled
+   until its time is at least the minimum time. A result is a regression
+   if its mean is larger than the one of the baseline by more than the
+   tolerance, and if the confidence intervals are disjoint; the exit
+   status is then 1. */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#ifdef HAVE_GETRUSAGE
+#include <sys/time.h>
+#include <sys/resource.h>
+#else
+#include <time.h>
+#endif
+#include "mpfr.h"
+
+/* get the time in microseconds */
+static unsigned long
+get_cputime (void)
+{
+#ifdef HAVE_GETRUSAGE
+  struct rusage ru;
+
+  getrusage (RUSAGE_SELF, &ru);
+  return ru.ru_utime.tv_sec * 1000000 + ru.ru_utime.tv_usec
+       + ru.ru_stime.tv_sec * 1000000 + ru.ru_stime.tv_usec;
+#else
+  return (unsigned long) ((double) clock () / ((double) CLOCKS_PER_SEC / 1e6));
+#endif
+}
+
+#define N 8  /* number of arguments */
+
+/* The arguments and results of the calls for a given precision and
+   exponent: x, y and w are the arguments, z and t the results. */
+struct args {
+  mpfr_t x[N], y[N], w[N], z[N], t[N];
+  double d[N];
+  char *s[N];
+  mpz_t q[N];
+};
+
+static volatile double sink;
+
+#define BENCH_1(f)                                                      \
+  static void bench_##f (struct args *a, int k)                         \
+  { mpfr_##f (a->z[k], a->x[k], MPFR_RNDN); }
+#define BENCH_2(f)                                                      \
+  static void bench_##f (struct args *a, int k)                         \
+  { mpfr_##f (a->z[k], a->x[k], a->y[k], MPFR_RNDN); }
+#define BENCH_3(f)                                                      \
+  static void bench_##f (struct args *a, int k)                         \
+  { mpfr_##f (a->z[k], a->x[k], a->y[k], a->w[k], MPFR_RNDN); }
+#define BENCH_11(f)                                                     \
+  static void bench_##f (struct args *a, int k)                         \
+  { mpfr_##f (a->z[k], a->t[k], a->x[k], MPFR_RNDN); }
+
+BENCH_2 (add)
+BENCH_2 (sub)
+BENCH_2 (mul)
+BENCH_1 (sqr)
+BENCH_2 (div)
+BENCH_1 (sqrt)
+BENCH_3 (fma)
+BENCH_3 (fms)
+
+static void
+bench_fmma (struct args *a, int k)
+{
+  mpfr_fmma (a->z[k], a->x[k], a->y[k], a->w[k], a->x[k], MPFR_RNDN);
+}
+
+static void
+bench_mul_ui (struct args *a, int k)
+{
+  mpfr_mul_ui (a->z[k], a->x[k], 17, MPFR_RNDN);
+}
+
+static void
+bench_div_ui (struct args *a, int k)
+{
+  mpfr_div_ui (a->z[k], a->x[k], 17, MPFR_RNDN);
+}
+
+BENCH_1 (cbrt)
+BENCH_1 (rec_sqrt)
+BENCH_1 (rsqrt)
+
+static void
+bench_rootn_ui (struct args *a, int k)
+{
+  mpfr_rootn_ui (a->z[k], a->x[k], 3, MPFR_RNDN);
+}
+
+BENCH_1 (exp)
+BENCH_1 (exp2)
+BENCH_1 (exp10)
+BENCH_1 (expm1)
+BENCH_1 (exp2m1)
+BENCH_1 (exp10m1)
+BENCH_11 (exp_recip)
+BENCH_1 (log)
+BENCH_1 (log2)
+BENCH_1 (log10)
+BENCH_1 (log1p)
+BENCH_1 (log2p1)
+BENCH_1 (log10p1)
+BENCH_2 (pow)
+BENCH_2 (powr)
+BENCH_2 (compound)
+
+static void
+bench_pow_ui (struct args *a, int k)
+{
+  mpfr_pow_ui (a->z[k], a->x[k], 17, MPFR_RNDN);
+}
+
+BENCH_1 (sin)
+BENCH_1 (cos)
+BENCH_1 (tan)
+BENCH_11 (sin_cos)
+BENCH_1 (sec)
+BENCH_1 (csc)
+BENCH_1 (cot)
+BENCH_1 (sinpi)
+BENCH_1 (cospi)
+BENCH_1 (tanpi)
+BENCH_1 (asin)
+BENCH_1 (acos)
+BENCH_1 (atan)
+BENCH_2 (atan2)
+BENCH_1 (asinpi)
+BENCH_1 (acospi)
+BENCH_1 (atanpi)
+BENCH_1 (sinh)
+BENCH_1 (cosh)
+BENCH_1 (tanh)
+BENCH_11 (sinh_cosh)
+BENCH_1 (sech)
+BENCH_1 (csch)
+BENCH_1 (coth)
+BENCH_1 (asinh)
+BENCH_1 (acosh)
+BENCH_1 (atanh)
+BENCH_2 (hypot)
+BENCH_2 (agm)
+BENCH_1 (gamma)
+BENCH_1 (lngamma)
+
+static void
+bench_lgamma (struct args *a, int k)
+{
+  int sign;
+
+  mpfr_lgamma (a->z[k], &sign, a->x[k], MPFR_RNDN);
+}
+
+BENCH_2 (gamma_inc)
+BENCH_2 (beta)
+BENCH_1 (digamma)
+BENCH_1 (trigamma)
+BENCH_1 (zeta)
+BENCH_1 (erf)
+BENCH_1 (erfc)
+BENCH_1 (eint)
+BENCH_1 (li2)
+BENCH_1 (j0)
+BENCH_1 (j1)
+BENCH_1 (y0)
+BENCH_1 (y1)
+
+static void
+bench_jn (struct args *a, int k)
+{
+  mpfr_jn (a->z[k], 5, a->x[k], MPFR_RNDN);
+}
+
+static void
+bench_yn (struct args *a, int k)
+{
+  mpfr_yn (a->z[k], 5, a->x[k], MPFR_RNDN);
+}
+
+static void
+bench_legendre (struct args *a, int k)
+{
+  mpfr_legendre (a->z[k], 5, a->x[k], MPFR_RNDN);
+}
+
+BENCH_1 (ai)
+
+static void
+bench_get_d (struct args *a, int k)
+{
+  sink = mpfr_get_d (a->x[k], MPFR_RNDN);
+}
+
+static void
+bench_set_d (struct args *a, int k)
+{
+  mpfr_set_d (a->z[k], a->d[k], MPFR_RNDN);
+}
+
+static void
+bench_get_ld (struct args *a, int k)
+{
+  sink = (double) mpfr_get_ld (a->x[k], MPFR_RNDN);
+}
+
+static void
+bench_get_str (struct args *a, int k)
+{
+  mpfr_exp_t e;
+
+  mpfr_free_str (mpfr_get_str (NULL, &e, 10, 0, a->x[k], MPFR_RNDN));
+}
+
+static void
+bench_set_str (struct args *a, int k)
+{
+  mpfr_set_str (a->z[k], a->s[k], 10, MPFR_RNDN);
+}
+
+static void
+bench_get_z (struct args *a, int k)
+{
+  mpfr_get_z_2exp (a->q[k], a->x[k]);
+}
+
+static void
+bench_set_z (struct args *a, int k)
+{
+  mpfr_set_z (a->z[k], a->q[k], MPFR_RNDN);
+}
+
+/* domain of the first argument */
+#define DOM_ANY  0  /* x in [2^(e-1),2^e) */
+#define DOM_UNIT 1  /* idem, only for e <= 0 */
+#define DOM_GE1  2  /* 1 + x */
+
+/* arguments needed by the conversions, besides x */
+#define NEED_D 1
+#define NEED_S 2
+#define NEED_Z 4
+
+static const struct {
+  const char *group;
+  const char *name;
+  void (*f) (struct args *, int);
+  int dom;
+  int need;
+} funcs[] = {
+  { "arith", "add", bench_add, DOM_ANY, 0 },
+  { "arith", "sub", bench_sub, DOM_ANY, 0 },
+  { "arith", "mul", bench_mul, DOM_ANY, 0 },
+  { "arith", "sqr", bench_sqr, DOM_ANY, 0 },
+  { "arith", "div", bench_div, DOM_ANY, 0 },
+  { "arith", "sqrt", bench_sqrt, DOM_ANY, 0 },
+  { "arith", "fma", bench_fma, DOM_ANY, 0 },
+  { "arith", "fms", bench_fms, DOM_ANY, 0 },
+  { "arith", "fmma", bench_fmma, DOM_ANY, 0 },
+  { "arith", "mul_ui", bench_mul_ui, DOM_ANY, 0 },
+  { "arith", "div_ui", bench_div_ui, DOM_ANY, 0 },
+  { "special", "cbrt", bench_cbrt, DOM_ANY, 0 },
+  { "special", "rec_sqrt", bench_rec_sqrt, DOM_ANY, 0 },
+  { "special", "rsqrt", bench_rsqrt, DOM_ANY, 0 },
+  { "special", "rootn_ui", bench_rootn_ui, DOM_ANY, 0 },
+  { "special", "exp", bench_exp, DOM_ANY, 0 },
+  { "special", "exp2", bench_exp2, DOM_ANY, 0 },
+  { "special", "exp10", bench_exp10, DOM_ANY, 0 },
+  { "special", "expm1", bench_expm1, DOM_ANY, 0 },
+  { "special", "exp2m1", bench_exp2m1, DOM_ANY, 0 },
+  { "special", "exp10m1", bench_exp10m1, DOM_ANY, 0 },
+  { "special", "exp_recip", bench_exp_recip, DOM_ANY, 0 },
+  { "special", "log", bench_log, DOM_ANY, 0 },
+  { "special", "log2", bench_log2, DOM_ANY, 0 },
+  { "special", "log10", bench_log10, DOM_ANY, 0 },
+  { "special", "log1p", bench_log1p, DOM_ANY, 0 },
+  { "special", "log2p1", bench_log2p1, DOM_ANY, 0 },
+  { "special", "log10p1", bench_log10p1, DOM_ANY, 0 },
+  { "special", "pow", bench_pow, DOM_ANY, 0 },
+  { "special", "powr", bench_powr, DOM_ANY, 0 },
+  { "special", "pow_ui", bench_pow_ui, DOM_ANY, 0 },
+  { "special", "compound", bench_compound, DOM_ANY, 0 },
+  { "special", "sin", bench_sin, DOM_ANY, 0 },
+  { "special", "cos", bench_cos, DOM_ANY, 0 },
+  { "special", "tan", bench_tan, DOM_ANY, 0 },
+  { "special", "sin_cos", bench_sin_cos, DOM_ANY, 0 },
+  { "special", "sec", bench_sec, DOM_ANY, 0 },
+  { "special", "csc", bench_csc, DOM_ANY, 0 },
+  { "special", "cot", bench_cot, DOM_ANY, 0 },
+  { "special", "sinpi", bench_sinpi, DOM_ANY, 0 },
+  { "special", "cospi", bench_cospi, DOM_ANY, 0 },
+  { "special", "tanpi", bench_tanpi, DOM_ANY, 0 },
+  { "special", "asin", bench_asin, DOM_UNIT, 0 },
+  { "special", "acos", bench_acos, DOM_UNIT, 0 },
+  { "special", "atan", bench_atan, DOM_ANY, 0 },
+  { "special", "atan2", bench_atan2, DOM_ANY, 0 },
+  { "special", "asinpi", bench_asinpi, DOM_UNIT, 0 },
+  { "special", "acospi", bench_acospi, DOM_UNIT, 0 },
+  { "special", "atanpi", bench_atanpi, DOM_ANY, 0 },
+  { "special", "sinh", bench_sinh, DOM_ANY, 0 },
+  { "special", "cosh", bench_cosh, DOM_ANY, 0 },
+  { "special", "tanh", bench_tanh, DOM_ANY, 0 },
+  { "special", "sinh_cosh", bench_sinh_cosh, DOM_ANY, 0 },
+  { "special", "sech", bench_sech, DOM_ANY, 0 },
+  { "special", "csch", bench_csch, DOM_ANY, 0 },
+  { "special", "coth", bench_coth, DOM_ANY, 0 },
+  { "special", "asinh", bench_asinh, DOM_ANY, 0 },
+  { "special", "acosh", bench_acosh, DOM_GE1, 0 },
+  { "special", "atanh", bench_atanh, DOM_UNIT, 0 },
+  { "special", "hypot", bench_hypot, DOM_ANY, 0 },
+  { "special", "agm", bench_agm, DOM_ANY, 0 },
+  { "special", "gamma", bench_gamma, DOM_ANY, 0 },
+  { "special", "lngamma", bench_lngamma, DOM_ANY, 0 },
+  { "special", "lgamma", bench_lgamma, DOM_ANY, 0 },
+  { "special", "gamma_inc", bench_gamma_inc, DOM_ANY, 0 },
+  { "special", "beta", bench_beta, DOM_ANY, 0 },
+  { "special", "digamma", bench_digamma, DOM_ANY, 0 },
+  { "special", "trigamma", bench_trigamma, DOM_ANY, 0 },
+  { "special", "zeta", bench_zeta, DOM_ANY, 0 },
+  { "special", "erf", bench_erf, DOM_ANY, 0 },
+  { "special", "erfc", bench_erfc, DOM_ANY, 0 },
+  { "special", "eint", bench_eint, DOM_ANY, 0 },
+  { "special", "li2", bench_li2, DOM_ANY, 0 },
+  { "special", "j0", bench_j0, DOM_ANY, 0 },
+  { "special", "j1", bench_j1, DOM_ANY, 0 },
+  { "special", "jn", bench_jn, DOM_ANY, 0 },
+  { "special", "y0", bench_y0, DOM_ANY, 0 },
+  { "special", "y1", bench_y1, DOM_ANY, 0 },
+  { "special", "yn", bench_yn, DOM_ANY, 0 },
+  { "special", "legendre", bench_legendre, DOM_UNIT, 0 },
+  { "special", "ai", bench_ai, DOM_ANY, 0 },
+  { "conv", "get_d", bench_get_d, DOM_ANY, 0 },
+  { "conv", "set_d", bench_set_d, DOM_ANY, NEED_D },
+  { "conv", "get_ld", bench_get_ld, DOM_ANY, 0 },
+  { "conv", "get_str", bench_get_str, DOM_ANY, 0 },
+  { "conv", "set_str", bench_set_str, DOM_ANY, NEED_S },
+  { "conv", "get_z", bench_get_z, DOM_ANY, 0 },
+  { "conv", "set_z", bench_set_z, DOM_ANY, NEED_Z }
+};
+
+#define NFUNCS (sizeof (funcs) / sizeof (funcs[0]))
+
+static mpfr_prec_t precs[64] =
+  { 53, 64, 113, 128, 192, 256, 512, 1024, 4096, 16384, 65536, 262144,
+    1000000 };
+static int nprecs = 13;
+static long exps[64] = { -10, 1, 10 };
+static int nexps = 3;
+
+static const char *format = "text";
+static const char *group = NULL;
+static const char *only = NULL;
+static int nsamples = 5;
+static unsigned long mintime = 10000, maxcall = 1000000;  /* in us */
+static double tol = 5.0;
+static FILE *out;
+
+/* A result: the mean time of a call in nanoseconds and its confidence
+   interval, or mean < 0 if skipped. */
+struct result {
+  char name[32];
+  mpfr_prec_t prec;
+  long e;
+  double mean, lo, hi;
+};
+
+static struct result *base;
+static int nbase;
+static int first = 1, nregressions = 0;
+
+/* quantiles of order 0.975 of the Student t distribution with 1 to 30
+   degrees of freedom */
+static const double student[] =
+  { 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+
+static void
+init_args (struct args *a, mpfr_prec_t p, long e, int dom, int need,
+           gmp_randstate_t state)
+{
+  mpfr_t *v[3];
+  int j, k;
+
+  v[0] = a->x;
+  v[1] = a->y;
+  v[2] = a->w;
+  /* the same arguments at each run, whatever the selected functions */
+  gmp_randseed_ui (state, 17 + p + e);
+  for (k = 0; k < N; k++)
+    {
+      for (j = 0; j < 3; j++)
+        {
+          mpfr_init2 (v[j][k], p);
+          mpfr_urandomb (v[j][k], state);
+          if (mpfr_zero_p (v[j][k]))
+            mpfr_set_ui_2exp (v[j][k], 1, -1, MPFR_RNDN);
+          mpfr_set_exp (v[j][k], e);
+        }
+      if (dom == DOM_GE1)
+        mpfr_add_ui (a->x[k], a->x[k], 1, MPFR_RNDN);
+      mpfr_init2 (a->z[k], p);
+      mpfr_init2 (a->t[k], p);
+      a->d[k] = (need & NEED_D) ? mpfr_get_d (a->x[k], MPFR_RNDN) : 0.0;
+      if (need & NEED_S)
+        mpfr_asprintf (&a->s[k], "%Re", a->x[k]);
+      mpz_init (a->q[k]);
+      if (need & NEED_Z)
+        mpfr_get_z_2exp (a->q[k], a->x[k]);
+    }
+}
+
+static void
+clear_args (struct args *a, int need)
+{
+  int k;
+
+  for (k = 0; k < N; k++)
+    {
+      mpfr_clear (a->x[k]);
+      mpfr_clear (a->y[k]);
+      mpfr_clear (a->w[k]);
+      mpfr_clear (a->z[k]);
+      mpfr_clear (a->t[k]);
+      if (need & NEED_S)
+        mpfr_free_str (a->s[k]);
+      mpz_clear (a->q[k]);
+    }
+}
+
+/* time in microseconds of n calls of f */
+static unsigned long
+run (void (*f) (struct args *, int), struct args *a, unsigned long n)
+{
+  unsigned long i, t0;
+
+  t0 = get_cputime ();
+  for (i = 0; i < n; i++)
+    f (a, i % N);
+  return get_cputime () - t0;
+}
+
+/* Measure the function i in precision p, for arguments of exponent e. */
+static void
+measure (struct result *r, int i, mpfr_prec_t p, long e,
+         gmp_randstate_t state)
+{
+  struct args a;
+  unsigned long n, t;
+  double s, s2, v;
+  int j;
+
+  init_args (&a, p, e, funcs[i].dom, funcs[i].need, state);
+  for (n = 1; ; n *= 2)
+    {
+      t = run (funcs[i].f, &a, n);
+      if (t >= mintime || (n == 1 && t >= maxcall))
+        break;
+    }
+  if (n == 1 && t >= maxcall)
+    {
+      /* a single sample, without confidence interval */
+      r->mean = r->lo = r->hi = 1e3 * t;
+      clear_args (&a, funcs[i].need);
+      return;
+    }
+  s = s2 = 0.0;
+  for (j = 0; j < nsamples; j++)
+    {
+      v = 1e3 * run (funcs[i].f, &a, n) / n;
+      s += v;
+      s2 += v * v;
+    }
+  r->mean = s / nsamples;
+  if (nsamples > 1)
+    {
+      v = (s2 - s * r->mean) / (nsamples - 1);
+      v = (v > 0.0) ? sqrt (v / nsamples) : 0.0;
+      v *= nsamples <= 31 ? student[nsamples - 2] : 1.960;
+    }
+  else
+    v = 0.0;
+  r->lo = r->mean - v;
+  r->hi = r->mean + v;
+  clear_args (&a, funcs[i].need);
+}
+
+/* Read the results of a previous run from a CSV file. */
+static void
+read_baseline (const char *file)
+{
+  FILE *f;
+  char line[256], g[32], name[32];
+  unsigned long p;
+  long e;
+  double mean, lo, hi;
+  int size = 0;
+
+  f = fopen (file, "r");
+  if (f == NULL)
+    {
+      fprintf (stderr, "Cannot open %s\n", file);
+      exit (2);
+    }
+  while (fgets (line, sizeof (line), f) != NULL)
+    {
+      if (sscanf (line, "%31[^,],%31[^,],%lu,%ld,%lf,%lf,%lf",
+                  g, name, &p, &e, &mean, &lo, &hi) != 7)
+        continue;  /* comment, header or skipped result */
+      if (nbase == size)
+        {
+          size = 2 * size + 256;
+          base = (struct result *) realloc (base, size * sizeof (*base));
+          if (base == NULL)
+            {
+              fprintf (stderr, "Cannot allocate memory\n");
+              exit (2);
+            }
+        }
+      strcpy (base[nbase].name, name);
+      base[nbase].prec = p;
+      base[nbase].e = e;
+      base[nbase].mean = mean;
+      base[nbase].lo = lo;
+      base[nbase].hi = hi;
+      nbase++;
+    }
+  fclose (f);
+}
+
+/* Compare r with the baseline, and return the status of r. */
+static const char *
+compare (struct result *r, struct result **b)
+{
+  int i;
+
+  for (i = 0; i < nbase; i++)
+    if (strcmp (base[i].name, r->name) == 0 && base[i].prec == r->prec &&
+        base[i].e == r->e)
+      break;
+  if (i == nbase)
+    {
+      *b = NULL;
+      return r->mean < 0.0 ? "skipped" : "new";
+    }
+  *b = base + i;
+  if (r->mean < 0.0 ||
+      (r->mean > base[i].mean * (1.0 + tol / 100.0) && r->lo > base[i].hi))
+    {
+      nregressions++;
+      return "regression";
+    }
+  if (r->mean < base[i].mean * (1.0 - tol / 100.0) && r->hi < base[i].lo)
+    return "improvement";
+  return "ok";
+}
+
+static void
+print_header (void)
+{
+  if (strcmp (format, "csv") == 0)
+    {
+      fprintf (out, "# MPFR %s, GMP %s, tuning profile %s\n",
+               mpfr_get_version (), gmp_version, mpfr_get_tune_profile ());
+      fprintf (out, "group,function,prec,exp,ns,ci_low,ci_high");
+      if (base != NULL)
+        fprintf (out, ",baseline_ns,change,status");
+      fprintf (out, "\n");
+    }
+  else if (strcmp (format, "json") == 0)
+    fprintf (out, "{\n  \"mpfr\": \"%s\",\n  \"gmp\": \"%s\",\n"
+             "  \"profile\": \"%s\",\n  \"results\": [",
+             mpfr_get_version (), gmp_version, mpfr_get_tune_profile ());
+  else
+    {
+      fprintf (out, "MPFR %s, GMP %s, tuning profile %s\n",
+               mpfr_get_version (), gmp_version, mpfr_get_tune_profile ());
+      fprintf (out, "%-8s %-10s %8s %4s %14s %8s", "group", "function",
+               "prec", "exp", "ns/call", "ci 95%");
+      if (base != NULL)
+        fprintf (out, " %14s %8s", "baseline", "change");
+      fprintf (out, "\n");
+    }
+}
+
+static void
+print_result (int i, struct result *r)
+{
+  struct result *b = NULL;
+  const char *status = NULL;
+  double change = 0.0;
+
+  if (base != NULL)
+    {
+      status = compare (r, &b);
+      if (b != NULL && r->mean >= 0.0)
+        change = 100.0 * (r->mean / b->mean - 1.0);
+    }
+
+  if (strcmp (format, "csv") == 0)
+    {
+      fprintf (out, "%s,%s,%lu,%ld,", funcs[i].group, r->name,
+               (unsigned long) r->prec, r->e);
+      if (r->mean >= 0.0)
+        fprintf (out, "%.1f,%.1f,%.1f", r->mean, r->lo, r->hi);
+      else
+        fprintf (out, ",,");
+      if (status != NULL)
+        {
+          if (b != NULL)
+            fprintf (out, ",%.1f,%.1f,%s", b->mean, change, status);
+          else
+            fprintf (out, ",,,%s", status);
+        }
+      fprintf (out, "\n");
+    }
+  else if (strcmp (format, "json") == 0)
+    {
+      fprintf (out, "%s\n    { \"group\": \"%s\", \"function\": \"%s\", "
+               "\"prec\": %lu, \"exp\": %ld, ", first ? "" : ",",
+               funcs[i].group, r->name, (unsigned long) r->prec, r->e);
+      if (r->mean >= 0.0)
+        fprintf (out, "\"ns\": %.1f, \"ci_low\": %.1f, \"ci_high\": %.1f",
+                 r->mean, r->lo, r->hi);
+      else
+        fprintf (out, "\"ns\": null, \"ci_low\": null, \"ci_high\": null");
+      if (status != NULL)
+        {
+          if (b != NULL)
+            fprintf (out, ", \"baseline_ns\": %.1f, \"change\": %.1f",
+                     b->mean, change);
+          fprintf (out, ", \"status\": \"%s\"", status);
+        }
+      fprintf (out, " }");
+    }
+  else
+    {
+      fprintf (out, "%-8s %-10s %8lu %4ld ", funcs[i].group, r->name,
+               (unsigned long) r->prec, r->e);
+      if (r->mean >= 0.0)
+        fprintf (out, "%14.1f %7.1f%%", r->mean,
+                 100.0 * (r->hi - r->mean) / r->mean);
+      else
+        fprintf (out, "%14s %8s", "skipped", "");
+      if (b != NULL)
+        fprintf (out, " %14.1f %+7.1f%%", b->mean, change);
+      if (status != NULL && strcmp (status, "ok") != 0 &&
+          strcmp (status, "skipped") != 0)
+        fprintf (out, " %s", status);
+      fprintf (out, "\n");
+    }
+  fflush (out);
+  first = 0;
+}
+
+static void
+print_footer (void)
+{
+  if (strcmp (format, "json") == 0)
+    {
+      fprintf (out, "\n  ]");
+      if (base != NULL)
+        fprintf (out, ",\n  \"regressions\": %d", nregressions);
+      fprintf (out, "\n}\n");
+    }
+  else if (strcmp (format, "text") == 0 && base != NULL)
+    fprintf (out, "%d regression(s)\n", nregressions);
+}
+
+/* Return non-zero if name is in the comma-separated list l. */
+static int
+in_list (const char *name, const char *l)
+{
+  size_t n = strlen (name);
+
+  while (l != NULL)
+    {
+      if (strncmp (l, name, n) == 0 && (l[n] == ',' || l[n] == '\0'))
+        return 1;
+      l = strchr (l, ',');
+      if (l != NULL)
+        l++;
+    }
+  return 0;
+}
+
+/* Parse a comma-separated list of integers. */
+static int
+parse_list (const char *s, long *v, int max)
+{
+  int n = 0;
+  char *end;
+
+  while (n < max)
+    {
+      v[n++] = strtol (s, &end, 10);
+      if (end == s || (*end != ',' && *end != '\0'))
+        {
+          fprintf (stderr, "Invalid list: %s\n", s);
+          exit (2);
+        }
+      if (*end == '\0')
+        break;
+      s = end + 1;
+    }
+  return n;
+}
+
+static void
+usage (void)
+{
+  fprintf (stderr, "Usage: benchsuite [-f text|csv|json] [-o file] "
+           "[-b baseline.csv] [-t tol]\n"
+           "       [-p p1,p2,...] [-e e1,e2,...] [-g group] "
+           "[-F f1,f2,...]\n"
+           "       [-s samples] [-m mintime_ms] [-M maxcall_ms]\n");
+  exit (2);
+}
+
+int
+main (int argc, char *argv[])
+{
+  gmp_randstate_t state;
+  struct result r;
+  long v[64];
+  int i, j, k;
+
+  out = stdout;
+  for (i = 1; i < argc; i++)
+    {
+      const char *opt = argv[i], *arg;
+
+      if (opt[0] != '-' || opt[1] == '\0' || opt[2] != '\0' || i + 1 == argc)
+        usage ();
+      arg = argv[++i];
+      switch (opt[1])
+        {
+        case 'f':
+          format = arg;
+          if (strcmp (format, "text") != 0 && strcmp (format, "csv") != 0 &&
+              strcmp (format, "json") != 0)
+            usage ();
+          break;
+        case 'o':
+          out = fopen (arg, "w");
+          if (out == NULL)
+            {
+              fprintf (stderr, "Cannot open %s\n", arg);
+              exit (2);
+            }
+          break;
+        case 'b':
+          read_baseline (arg);
+          if (base == NULL)
+            {
+              fprintf (stderr, "No result in %s\n", arg);
+              exit (2);
+            }
+          break;
+        case 't':
+          tol = atof (arg);
+          break;
+        case 'p':
+          nprecs = parse_list (arg, v, 64);
+          for (j = 0; j < nprecs; j++)
+            {
+              if (v[j] < MPFR_PREC_MIN)
+                usage ();
+              precs[j] = v[j];
+            }
+          break;
+        case 'e':
+          nexps = parse_list (arg, exps, 64);
+          break;
+        case 'g':
+          group = arg;
+          break;
+        case 'F':
+          only = arg;
+          break;
+        case 's':
+          nsamples = atoi (arg);
+          if (nsamples < 1)
+            usage ();
+          break;
+        case 'm':
+          mintime = 1000 * strtoul (arg, NULL, 10);
+          break;
+        case 'M':
+          maxcall = 1000 * strtoul (arg, NULL, 10);
+          break;
+        default:
+          usage ();
+        }
+    }
+
+  gmp_randinit_default (state);
+  print_header ();
+  for (i = 0; i < (int) NFUNCS; i++)
+    {
+      if ((group != NULL && strcmp (funcs[i].group, group) != 0) ||
+          (only != NULL && ! in_list (funcs[i].name, only)))
+        continue;
+      strcpy (r.name, funcs[i].name);
+      for (k = 0; k < nexps; k++)
+        {
+          double last = 0.0, ratio;
+
+          if (funcs[i].dom == DOM_UNIT && exps[k] > 0)
+            continue;
+          for (j = 0; j < nprecs; j++)
+            {
+              r.prec = precs[j];
+              r.e = exps[k];
+              /* skip this precision and the next ones if a call would
+                 take more than maxcall, assuming a quadratic cost */
+              ratio = j > 0 ? (double) precs[j] / precs[j - 1] : 1.0;
+              if (last < 0.0 || last * ratio * ratio >= 1e3 * maxcall)
+                r.mean = r.lo = r.hi = -1.0;
+              else
+                measure (&r, i, precs[j], exps[k], state);
+              last = r.mean;
+              print_result (i, &r);
+            }
+        }
+    }
+  print_footer ();
+  gmp_randclear (state);
+  mpfr_free_cache ();
+  if (out != stdout)
+    fclose (out);
+  free (base);
+  return nregressions != 0;
+}
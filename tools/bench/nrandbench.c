@@ -0,0 +1,124 @@
+/* nrandbench.c -- number of normal random deviates generated per second
+
+Copyright 2026 Free Software Foundation, Inc.
+Contributed by the Pascaline and Caramba projects, INRIA.
+
+This file is part of the GNU MPFR Library.
+
+The GNU MPFR Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The GNU MPFR Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the GNU MPFR Library; see the file COPYING.LESSER.
+If not, see <https://www.gnu.org/licenses/>. */
+
+/* Usage: nrandbench [mintime]
+   For each version of mpfr_nrandom (and mpfr_erandom for comparison) and
+   each precision in the list below, print the number of samples generated
+   per second, with the default GMP random generator. The number of samples
+   is doubled until the time is at least mintime seconds (1 by default). */
+
+#include <stdlib.h>
+#include <stdio.h>
+#ifdef HAVE_GETRUSAGE
+#include <sys/time.h>
+#include <sys/resource.h>
+#else
+#include <time.h>
+#endif
+#include "mpfr.h"
+
+/* get the time in microseconds */
+static unsigned long
+get_cputime (void)
+{
+#ifdef HAVE_GETRUSAGE
+  struct rusage ru;
+
+  getrusage (RUSAGE_SELF, &ru);
+  return ru.ru_utime.tv_sec * 1000000 + ru.ru_utime.tv_usec
+       + ru.ru_stime.tv_sec * 1000000 + ru.ru_stime.tv_usec;
+#else
+  return (unsigned long) ((double) clock () / ((double) CLOCKS_PER_SEC / 1e6));
+#endif
+}
+
+static const struct {
+  const char *name;
+  int (*f) (mpfr_ptr, gmp_randstate_t, mpfr_rnd_t);
+} funcs[] = {
+  { "nrandom_v1", mpfr_nrandom_v1 },
+  { "nrandom_v2", mpfr_nrandom_v2 },
+  { "nrandom_v3", mpfr_nrandom_v3 },
+  { "erandom", mpfr_erandom }
+};
+
+static const mpfr_prec_t arrayprec[] = { 53, 113, 1000 };
+
+#define NFUNCS (sizeof (funcs) / sizeof (funcs[0]))
+#define NPREC (sizeof (arrayprec) / sizeof (arrayprec[0]))
+
+/* number of samples per second of f in precision prec */
+static double
+rate (int (*f) (mpfr_ptr, gmp_randstate_t, mpfr_rnd_t), mpfr_prec_t prec,
+      gmp_randstate_t state, unsigned long mintime)
+{
+  mpfr_t x;
+  unsigned long n, t0, t;
+
+  mpfr_init2 (x, prec);
+  for (n = 1024; ; n *= 2)
+    {
+      unsigned long i;
+
+      t0 = get_cputime ();
+      for (i = 0; i < n; i++)
+        f (x, state, MPFR_RNDN);
+      t = get_cputime () - t0;
+      if (t >= mintime)
+        break;
+    }
+  mpfr_clear (x);
+  return (double) n * 1e6 / (double) t;
+}
+
+int
+main (int argc, char *argv[])
+{
+  gmp_randstate_t state;
+  unsigned long mintime = 1000000;
+  unsigned int i, j;
+
+  if (argc > 1)
+    mintime = strtoul (argv[1], NULL, 10) * 1000000;
+
+  printf ("Samples per second, MPFR %s, GMP %s\n",
+          mpfr_get_version (), gmp_version);
+  printf ("%-12s", "precision");
+  for (j = 0; j < NPREC; j++)
+    printf (" %12ld", (long) arrayprec[j]);
+  printf ("\n");
+
+  gmp_randinit_default (state);
+  for (i = 0; i < NFUNCS; i++)
+    {
+      printf ("%-12s", funcs[i].name);
+      for (j = 0; j < NPREC; j++)
+        {
+          printf (" %12.0f", rate (funcs[i].f, arrayprec[j], state, mintime));
+          fflush (stdout);
+        }
+      printf ("\n");
+    }
+  gmp_randclear (state);
+
+  mpfr_free_cache ();
+  return 0;
+}
@@ -730,6 +730,12 @@ tune_simple_func_in_some_direction (long int *threshold1,
 #define MPFR_MULHIGH_TAB_SIZE MPFR_MULHIGH_SIZE
 #define MPFR_SQRHIGH_TAB_SIZE MPFR_SQRHIGH_SIZE
 #define MPFR_DIVHIGH_TAB_SIZE MPFR_DIVHIGH_SIZE
+/* The threshold of mpn_div_q is tuned in bits, like the other ones, but
+   it is used in limbs. It is disabled while the tables are tuned. */
+mpfr_prec_t mpfr_div_q_threshold = MPFR_PREC_MAX;
+#undef  MPFR_DIV_Q_THRESHOLD
+#define MPFR_DIV_Q_THRESHOLD \
+  ((mp_size_t) ((mpfr_div_q_threshold - 1) / GMP_NUMB_BITS + 1))
 #include "mulders.c"
 
 static double
@@ -992,7 +998,7 @@ speed_mpfr_ai (struct speed_params *s)
  * Warning: tune the function in their dependent order!*
  *******************************************************/
 static void
-all (const char *filename)
+all (const char *filename, int profile)
 {
   FILE *f;
   time_t  start_time, end_time;
@@ -1050,9 +1056,28 @@ all (const char *filename)
   fprintf (f, "system compiler */\n");
 #endif
   fprintf (f, "\n\n");
-  fprintf (f, "#ifndef MPFR_TUNE_CASE\n");
-  fprintf (f, "#define MPFR_TUNE_CASE \"src/mparam.h\"\n");
-  fprintf (f, "#endif\n\n");
+  if (profile)
+    {
+      char vendor[13];
+      int family, model;
+
+      /* A tuning profile (see src/tune_profile.c) for this processor.
+         Other models can be added to MPFR_TUNE_PROFILE_MODELS. */
+      if (mpfr_tune_cpuid (vendor, &family, &model) == 0)
+        {
+          fprintf (stderr, "Can't identify the processor.\n");
+          abort ();
+        }
+      fprintf (f, "#define MPFR_TUNE_PROFILE_VENDOR \"%s\"\n", vendor);
+      fprintf (f, "#define MPFR_TUNE_PROFILE_FAMILY %d\n", family);
+      fprintf (f, "#define MPFR_TUNE_PROFILE_MODELS %d\n\n", model);
+    }
+  else
+    {
+      fprintf (f, "#ifndef MPFR_TUNE_CASE\n");
+      fprintf (f, "#define MPFR_TUNE_CASE \"src/mparam.h\"\n");
+      fprintf (f, "#endif\n\n");
+    }
 
   /* Tune mulhigh */
   tune_mul_mulders (f);
@@ -1088,6 +1113,14 @@ all (const char *filename)
   fprintf (f, "#define MPFR_DIV_THRESHOLD %lu /* limbs */\n",
            (unsigned long) (mpfr_div_threshold - 1) / GMP_NUMB_BITS + 1);
 
+  /* Tune the use of mpn_div_q in mpfr_div */
+  if (verbose)
+    printf ("Tuning mpfr_div for large precisions...\n");
+  tune_simple_func (&mpfr_div_q_threshold, speed_mpfr_div,
+                    1000*GMP_NUMB_BITS);
+  fprintf (f, "#define MPFR_DIV_Q_THRESHOLD %lu /* limbs */\n",
+           (unsigned long) (mpfr_div_q_threshold - 1) / GMP_NUMB_BITS + 1);
+
   /* Tune mpfr_exp_2 */
   if (verbose)
     printf ("Tuning mpfr_exp_2...\n");
@@ -1171,20 +1204,28 @@ all (const char *filename)
 }
 
 
-/* Main function */
+/* Main function. Any argument other than -p makes the output verbose.
+   With -p, the parameters are output as a tuning profile for the current
+   processor (see src/tune_profile.c). */
 int main (int argc, char *argv[])
 {
+  int i, profile = 0;
+
   /* Unbuffered so if output is redirected to a file it isn't lost if the
      program is killed part way through.  */
   setbuf (stdout, NULL);
   setbuf (stderr, NULL);
 
-  verbose = argc > 1;
+  for (i = 1; i < argc; i++)
+    if (strcmp (argv[i], "-p") == 0)
+      profile = 1;
+    else
+      verbose = 1;
 
   if (verbose)
     printf ("Tuning MPFR (Coffee time?)...\n");
 
-  all ("mparam.h");
+  all ("mparam.h", profile);
 
   return 0;
 }